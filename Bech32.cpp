@@ -119,6 +119,41 @@ int bech32_decode_nocheck(uint8_t *data, size_t *data_len, const char *input) {
 
 }
 
+int bech32_mask_nocheck(uint8_t *mask, uint8_t *value, const char *input) {
+
+  memset(mask, 0, 20);
+  memset(value, 0, 20);
+
+  size_t input_len = strlen(input);
+  if (input_len > 32)
+    return false;
+
+  for (int i = 0; i < input_len; i++) {
+
+    if (input[i] == '?')
+      continue;
+
+    // Addresses are lower case
+    if ((input[i] & 0x80) || (input[i] >= 'A' && input[i] <= 'Z'))
+      return false;
+
+    int8_t c = charset_rev[input[i]];
+    if (c < 0)
+      return false;
+
+    for (int b = 0; b < 5; b++) {
+      int bit = 5 * i + b;
+      mask[bit >> 3] |= 0x80 >> (bit & 7);
+      if (c & (0x10 >> b))
+        value[bit >> 3] |= 0x80 >> (bit & 7);
+    }
+
+  }
+
+  return true;
+
+}
+
 int bech32_decode(char* hrp, uint8_t *data, size_t *data_len, const char *input) {
   uint32_t chk = 1;
   size_t i;
@@ -100,4 +100,14 @@ int bech32_decode(
 
 int bech32_decode_nocheck(uint8_t *data, size_t *data_len, const char *input);
 
+/** Bit mask and value over a witness program of 20 bytes
+ *
+ *  Out: mask:  Pointer to a buffer of 20 bytes, bits fixed by input.
+ *       value: Pointer to a buffer of 20 bytes, value of the fixed bits.
+ *  In: input:  Pointer to the null-terminated data part prefix (at most 32
+ *              lower case characters, '?' matches any character).
+ *  Returns 1 if succesful.
+ */
+int bech32_mask_nocheck(uint8_t *mask, uint8_t *value, const char *input);
+
 #endif
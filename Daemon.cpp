@@ -0,0 +1,506 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Daemon.h"
+#include "Timer.h"
+#include <string.h>
+#include <stdlib.h>
+#include <signal.h>
+
+using namespace std;
+
+// ----------------------------------------------------------------------------
+// Daemon
+//
+// Line based protocol, in clear text (found private keys included):
+//   daemon -> client  AUTH nonce
+//   client -> daemon  AUTH sha256(nonce:token)
+//   daemon -> client  OK | ERR message
+//   client -> daemon  SUBMIT [-c] [-u|-b] [-quota n] prefix [prefix ...]
+//   daemon -> client  JOB id | ERR message
+//   client -> daemon  CANCEL id
+//   daemon -> client  OK | ERR message
+//   client -> daemon  STATUS [id]
+//   daemon -> client  JOB id state nbFound (one line per job), END
+//   client -> daemon  RESULT id | WAIT id (waits for the end of the job)
+//   daemon -> client  JOB id state nbFound, FOUND id address privAddr privHex ..., END
+//   client -> daemon  QUIT
+// ----------------------------------------------------------------------------
+
+static const char *stateNames[] = { "queued","running","done","cancelled","failed" };
+
+// SIGINT/SIGTERM cancel the running job and stop the daemon, Search() installs its
+// own handler during a job and restores this one on return
+static volatile sig_atomic_t daemonStop = 0;
+
+static void sigDaemon(int sig) {
+
+  daemonStop = 1;
+
+}
+
+typedef struct {
+
+  Daemon *obj;
+  TcpSocket *sock;
+
+} CLIENT_PARAM;
+
+#ifdef WIN64
+DWORD WINAPI _AcceptClients(LPVOID lpParam) {
+#else
+void *_AcceptClients(void *lpParam) {
+#endif
+  ((Daemon *)lpParam)->AcceptClients();
+  return 0;
+}
+
+#ifdef WIN64
+DWORD WINAPI _ServeClient(LPVOID lpParam) {
+#else
+void *_ServeClient(void *lpParam) {
+#endif
+  CLIENT_PARAM *p = (CLIENT_PARAM *)lpParam;
+  p->obj->ServeClient(p->sock);
+  delete p;
+  return 0;
+}
+
+static void splitLine(string &line, vector<string> &args) {
+
+  args.clear();
+  size_t pos = 0;
+  while (pos < line.length()) {
+    size_t end = line.find(' ', pos);
+    if (end == string::npos)
+      end = line.length();
+    if (end > pos)
+      args.push_back(line.substr(pos, end - pos));
+    pos = end + 1;
+  }
+
+}
+
+Daemon::Daemon(Secp256K1 *secp, bool useGpu, vector<int> gpuId, vector<int> gridSize, int nbCPUThread,
+               bool useSSE, bool useAVX, int cpuGrpSize, uint32_t maxFound, string outputFile,
+               int outputFormat, int outputSync) {
+
+  this->secp = secp;
+  this->useGpu = useGpu;
+  this->gpuId = gpuId;
+  this->gridSize = gridSize;
+  this->nbCPUThread = nbCPUThread;
+  this->useSSE = useSSE;
+  this->useAVX = useAVX;
+  this->cpuGrpSize = cpuGrpSize;
+  this->maxFound = maxFound;
+  this->outputFile = outputFile;
+  this->outputFormat = outputFormat;
+  this->outputSync = outputSync;
+  listener = NULL;
+  current = NULL;
+  currentJob = NULL;
+  nextId = 1;
+  nbClient = 0;
+
+#ifdef WIN64
+  mutex = CreateMutex(NULL, FALSE, NULL);
+#else
+  pthread_mutex_init(&mutex, NULL);
+#endif
+
+#ifdef WITHGPU
+  // Engines are reset and reused by the next job
+  GPUDevice::SetPooling(true);
+#endif
+
+}
+
+void Daemon::lock() {
+
+#ifdef WIN64
+  WaitForSingleObject(mutex, INFINITE);
+#else
+  pthread_mutex_lock(&mutex);
+#endif
+
+}
+
+void Daemon::unlock() {
+
+#ifdef WIN64
+  ReleaseMutex(mutex);
+#else
+  pthread_mutex_unlock(&mutex);
+#endif
+
+}
+
+JOB *Daemon::getJob(int id) {
+
+  for (int i = 0; i < (int)jobs.size(); i++)
+    if (jobs[i]->id == id)
+      return jobs[i];
+  return NULL;
+
+}
+
+void Daemon::getResults(JOB *job, vector<string> &r) {
+
+  // A cancelled job is still searched until runJob() copies its results
+  if (current && currentJob == job)
+    current->GetResults(r);
+  else
+    r = job->results;
+
+}
+
+string Daemon::getStatus(JOB *job) {
+
+  vector<string> r;
+  getResults(job, r);
+  char tmp[128];
+  sprintf(tmp, "JOB %d %s %d", job->id, stateNames[job->state], (int)r.size());
+  return string(tmp);
+
+}
+
+bool Daemon::submit(vector<string> &args, string &reply) {
+
+  JOB *job = new JOB();
+  job->state = JOB_QUEUED;
+  job->finished = false;
+  job->searchMode = SEARCH_COMPRESSED;
+  job->caseSensitive = true;
+  job->quota = 1;
+
+  for (int i = 1; i < (int)args.size(); i++) {
+    if (args[i] == "-c") {
+      job->caseSensitive = false;
+    } else if (args[i] == "-u") {
+      job->searchMode = SEARCH_UNCOMPRESSED;
+    } else if (args[i] == "-b") {
+      job->searchMode = SEARCH_BOTH;
+    } else if (args[i] == "-quota" && i + 1 < (int)args.size()) {
+      job->quota = (uint32_t)strtoul(args[++i].c_str(), NULL, 10);
+    } else if (args[i][0] == '-') {
+      reply = "ERR invalid option " + args[i];
+      delete job;
+      return false;
+    } else {
+      job->prefixes.push_back(args[i]);
+    }
+  }
+
+  if (job->prefixes.size() == 0 || job->quota == 0) {
+    reply = (job->quota == 0) ? "ERR invalid quota" : "ERR no prefix";
+    delete job;
+    return false;
+  }
+
+  lock();
+
+  int nbQueued = 0;
+  for (int i = 0; i < (int)jobs.size(); i++)
+    if (jobs[i]->state == JOB_QUEUED) nbQueued++;
+  if (nbQueued >= DAEMON_MAX_QUEUED) {
+    unlock();
+    reply = "ERR too many queued jobs";
+    delete job;
+    return false;
+  }
+
+  job->id = nextId++;
+  jobs.push_back(job);
+
+  // Drop the oldest finished jobs, a cancelled job may still be used by runJob()
+  int nbFinished = 0;
+  for (int i = 0; i < (int)jobs.size(); i++)
+    if (jobs[i]->finished) nbFinished++;
+  for (int i = 0; i < (int)jobs.size() && nbFinished > DAEMON_MAX_JOB;) {
+    if (jobs[i]->finished) {
+      delete jobs[i];
+      jobs.erase(jobs.begin() + i);
+      nbFinished--;
+    } else {
+      i++;
+    }
+  }
+
+  char tmp[64];
+  sprintf(tmp, "JOB %d", job->id);
+  reply = string(tmp);
+
+  unlock();
+
+  return true;
+
+}
+
+bool Daemon::cancel(int id) {
+
+  bool ok = false;
+
+  lock();
+  JOB *job = getJob(id);
+  if (job && job->state == JOB_QUEUED) {
+    // Never run
+    job->state = JOB_CANCELLED;
+    job->finished = true;
+    ok = true;
+  } else if (job && job->state == JOB_RUNNING) {
+    job->state = JOB_CANCELLED;
+    if (current)
+      current->Stop();
+    ok = true;
+  }
+  unlock();
+
+  return ok;
+
+}
+
+void Daemon::runJob(JOB *job) {
+
+  printf("\nDaemon: job #%d started (%d prefixes)\n", job->id, (int)job->prefixes.size());
+
+  Point startPubKey;
+  startPubKey.Clear();
+  VanitySearch *v = new VanitySearch(secp, job->prefixes, "", job->searchMode, useGpu, true, outputFile, useSSE,
+    useAVX, cpuGrpSize, maxFound, 0, job->caseSensitive, startPubKey, false, "");
+
+  if (!v->IsValid()) {
+    delete v;
+    printf("Daemon: job #%d failed\n", job->id);
+    lock();
+    job->state = JOB_FAILED;
+    job->finished = true;
+    unlock();
+    return;
+  }
+
+  v->SetOutputFormat(outputFormat, outputSync);
+  v->KeepResults(true);
+  if (job->quota > 1)
+    v->SetQuota(job->quota);
+
+  lock();
+  current = v;
+  currentJob = job;
+  bool cancelled = (job->state != JOB_RUNNING) || daemonStop;
+  unlock();
+
+  if (!cancelled)
+    v->Search(nbCPUThread, gpuId, gridSize);
+
+  // A signal during the search stops the daemon
+  if (v->IsInterrupted())
+    daemonStop = 1;
+
+  lock();
+  v->GetResults(job->results);
+  current = NULL;
+  currentJob = NULL;
+  if (job->state == JOB_RUNNING)
+    job->state = daemonStop ? JOB_CANCELLED : JOB_DONE;
+  printf("\nDaemon: job #%d %s (%d found)\n", job->id, stateNames[job->state], (int)job->results.size());
+  job->finished = true;
+  unlock();
+
+  delete v;
+
+}
+
+void Daemon::Run(int port, string bindAddr, string token) {
+
+  this->token = token;
+  if (this->token.length() == 0) {
+    this->token = TcpSocket::NewToken();
+    printf("Daemon: token %s (give it to the clients)\n", this->token.c_str());
+  }
+
+  listener = new TcpSocket();
+  if (!listener->Listen(port, bindAddr))
+    exit(-1);
+  printf("Daemon: listening on %s:%d\n", bindAddr.c_str(), port);
+
+#ifdef WIN64
+  DWORD thread_id;
+  CreateThread(NULL, 0, _AcceptClients, (void*)this, 0, &thread_id);
+#else
+  setvbuf(stdout, NULL, _IONBF, 0);
+  pthread_t thread_id;
+  pthread_create(&thread_id, NULL, &_AcceptClients, (void*)this);
+#endif
+
+  daemonStop = 0;
+  signal(SIGINT, sigDaemon);
+  signal(SIGTERM, sigDaemon);
+
+  // Run the queued jobs in submission order
+  while (!daemonStop) {
+
+    JOB *job = NULL;
+    lock();
+    for (int i = 0; i < (int)jobs.size() && job == NULL; i++) {
+      if (jobs[i]->state == JOB_QUEUED)
+        job = jobs[i];
+    }
+    if (job)
+      job->state = JOB_RUNNING;
+    unlock();
+
+    if (job)
+      runJob(job);
+    else
+      Timer::SleepMillis(10);
+
+  }
+
+  printf("\nDaemon: stopped\n");
+
+}
+
+void Daemon::AcceptClients() {
+
+  TcpSocket *sock;
+  while ((sock = listener->Accept()) != NULL) {
+
+    lock();
+    bool full = (nbClient >= DAEMON_MAX_CLIENT);
+    if (!full)
+      nbClient++;
+    unlock();
+    if (full) {
+      sock->WriteLine("ERR too many clients");
+      delete sock;
+      continue;
+    }
+
+    CLIENT_PARAM *p = new CLIENT_PARAM;
+    p->obj = this;
+    p->sock = sock;
+#ifdef WIN64
+    DWORD thread_id;
+    CreateThread(NULL, 0, _ServeClient, (void*)p, 0, &thread_id);
+#else
+    pthread_t thread_id;
+    pthread_create(&thread_id, NULL, &_ServeClient, (void*)p);
+    pthread_detach(thread_id);
+#endif
+
+  }
+
+}
+
+void Daemon::ServeClient(TcpSocket *sock) {
+
+  string line;
+  vector<string> args;
+
+  // Challenge response authentication, as the distributed search, an idle
+  // client is dropped after TCP_AUTH_TIMEOUT
+  sock->SetTimeout(TCP_AUTH_TIMEOUT);
+  string nonce = TcpSocket::NewToken();
+  bool auth = sock->WriteLine("AUTH " + nonce) && sock->ReadLine(line);
+  if (auth) {
+    splitLine(line, args);
+    auth = (args.size() == 2 && args[0] == "AUTH" &&
+            TcpSocket::SameDigest(args[1], TcpSocket::AuthDigest(nonce, token)));
+    sock->WriteLine(auth ? "OK" : "ERR authentication failed");
+    if (!auth)
+      printf("\nDaemon: authentication failed from %s\n", sock->GetPeerName().c_str());
+  }
+  sock->SetTimeout(0);
+
+  while (auth && sock->ReadLine(line)) {
+
+    splitLine(line, args);
+    if (args.size() == 0)
+      continue;
+
+    string &cmd = args[0];
+    string reply;
+    vector<string> lines;
+    int id = (args.size() > 1) ? atoi(args[1].c_str()) : 0;
+
+    if (cmd == "SUBMIT") {
+
+      submit(args, reply);
+      lines.push_back(reply);
+
+    } else if (cmd == "CANCEL" && args.size() == 2) {
+
+      lines.push_back(cancel(id) ? "OK" : "ERR unknown or finished job");
+
+    } else if (cmd == "STATUS") {
+
+      lock();
+      for (int i = 0; i < (int)jobs.size(); i++)
+        if (args.size() == 1 || jobs[i]->id == id)
+          lines.push_back(getStatus(jobs[i]));
+      unlock();
+      lines.push_back("END");
+
+    } else if ((cmd == "RESULT" || cmd == "WAIT") && args.size() == 2) {
+
+      JOB *job;
+      bool wait = (cmd == "WAIT");
+      do {
+        lock();
+        job = getJob(id);
+        if (job && (!wait || job->finished)) {
+          vector<string> r;
+          getResults(job, r);
+          lines.push_back(getStatus(job));
+          for (int i = 0; i < (int)r.size(); i++)
+            lines.push_back("FOUND " + args[1] + " " + r[i]);
+          lines.push_back("END");
+          wait = false;
+        }
+        unlock();
+        if (wait && job)
+          Timer::SleepMillis(10);
+      } while (wait && job);
+      if (job == NULL)
+        lines.push_back("ERR unknown job");
+
+    } else if (cmd == "QUIT") {
+
+      break;
+
+    } else {
+
+      lines.push_back("ERR unknown command");
+
+    }
+
+    // Replies are sent outside the lock
+    bool ok = true;
+    for (int i = 0; i < (int)lines.size() && ok; i++)
+      ok = sock->WriteLine(lines[i]);
+    if (!ok)
+      break;
+
+  }
+
+  delete sock;
+  lock();
+  nbClient--;
+  unlock();
+
+}
@@ -0,0 +1,112 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef DAEMONH
+#define DAEMONH
+
+#include <string>
+#include <vector>
+#include "Vanity.h"
+#include "Network.h"
+
+// Job states
+#define JOB_QUEUED    0
+#define JOB_RUNNING   1
+#define JOB_DONE      2
+#define JOB_CANCELLED 3
+#define JOB_FAILED    4 // Invalid input
+
+// Finished jobs kept for STATUS and RESULT
+#define DAEMON_MAX_JOB 1024
+
+// Jobs waiting to run, further SUBMIT are refused
+#define DAEMON_MAX_QUEUED 256
+
+// Simultaneous client connections
+#define DAEMON_MAX_CLIENT 32
+
+typedef struct {
+
+  int id;
+  int state;
+  bool finished;                      // Results copied, not used by runJob() any more, can be deleted
+  int searchMode;
+  bool caseSensitive;
+  uint32_t quota;
+  std::vector<std::string> prefixes;
+  std::vector<std::string> results;   // "address privAddr privHex"
+
+} JOB;
+
+// Long running search service (-daemon). Jobs are queued by the clients and run one
+// at a time with the options given on the command line. The generator tables, the
+// device contexts and the GPU engines (engine pool) are kept warm between jobs.
+// Clients authenticate with the shared token, results (private keys) are sent in
+// clear text.
+class Daemon {
+
+public:
+
+  Daemon(Secp256K1 *secp, bool useGpu, std::vector<int> gpuId, std::vector<int> gridSize, int nbCPUThread,
+         bool useSSE, bool useAVX, int cpuGrpSize, uint32_t maxFound, std::string outputFile,
+         int outputFormat, int outputSync);
+
+  void Run(int port, std::string bindAddr, std::string token);
+  void AcceptClients();
+  void ServeClient(TcpSocket *sock);
+
+private:
+
+  void runJob(JOB *job);
+  bool submit(std::vector<std::string> &args, std::string &reply);
+  bool cancel(int id);
+  JOB *getJob(int id);
+  std::string getStatus(JOB *job);
+  void getResults(JOB *job, std::vector<std::string> &r);
+  void lock();
+  void unlock();
+
+  Secp256K1 *secp;
+  bool useGpu;
+  std::vector<int> gpuId;
+  std::vector<int> gridSize;
+  int nbCPUThread;
+  bool useSSE;
+  bool useAVX;
+  int cpuGrpSize;
+  uint32_t maxFound;
+  std::string outputFile;
+  int outputFormat;
+  int outputSync;
+
+  TcpSocket *listener;
+  std::string token;
+  int nbClient;
+  std::vector<JOB *> jobs;
+  VanitySearch *current;
+  JOB *currentJob;                    // Job searched by current
+  int nextId;
+
+#ifdef WIN64
+  HANDLE mutex;
+#else
+  pthread_mutex_t mutex;
+#endif
+
+};
+
+#endif // DAEMONH
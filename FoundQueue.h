@@ -0,0 +1,125 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FOUNDQUEUEH
+#define FOUNDQUEUEH
+
+#include "Int.h"
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+
+// Candidate sent by the search threads to the verification threads
+typedef struct {
+
+  Int key;             // Base key of the search thread at the time of the hit
+  int32_t incr;
+  int16_t endo;
+  bool mode;
+  int8_t type;         // P2PKH (public key hash160) or P2SH (script hash160)
+  int prefIdx;
+  uint8_t hash160[20];
+
+} FOUND_ITEM;
+
+// Bounded lock-free multi-producer multi-consumer queue
+// (D. Vyukov algorithm, one sequence number per cell)
+class FoundQueue {
+
+public:
+
+  FoundQueue(uint32_t size) {
+    // size must be a power of 2
+    mask = size - 1;
+    cells = new CELL[size];
+    for (uint32_t i = 0; i < size; i++)
+      cells[i].seq.store(i, std::memory_order_relaxed);
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+  }
+
+  ~FoundQueue() {
+    delete[] cells;
+  }
+
+  // Return false when the queue is full
+  bool Push(FOUND_ITEM &item) {
+
+    CELL *c;
+    uint64_t pos = tail.load(std::memory_order_relaxed);
+    for (;;) {
+      c = &cells[pos & mask];
+      uint64_t seq = c->seq.load(std::memory_order_acquire);
+      int64_t dif = (int64_t)seq - (int64_t)pos;
+      if (dif == 0) {
+        if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      } else if (dif < 0) {
+        return false;
+      } else {
+        pos = tail.load(std::memory_order_relaxed);
+      }
+    }
+    c->item = item;
+    c->seq.store(pos + 1, std::memory_order_release);
+    return true;
+
+  }
+
+  // Return false when the queue is empty
+  bool Pop(FOUND_ITEM &item) {
+
+    CELL *c;
+    uint64_t pos = head.load(std::memory_order_relaxed);
+    for (;;) {
+      c = &cells[pos & mask];
+      uint64_t seq = c->seq.load(std::memory_order_acquire);
+      int64_t dif = (int64_t)seq - (int64_t)(pos + 1);
+      if (dif == 0) {
+        if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      } else if (dif < 0) {
+        return false;
+      } else {
+        pos = head.load(std::memory_order_relaxed);
+      }
+    }
+    item = c->item;
+    c->seq.store(pos + mask + 1, std::memory_order_release);
+    return true;
+
+  }
+
+  bool IsEmpty() {
+    return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+  }
+
+private:
+
+  typedef struct {
+    std::atomic<uint64_t> seq;
+    FOUND_ITEM item;
+  } CELL;
+
+  CELL *cells;
+  uint64_t mask;
+  std::atomic<uint64_t> head;
+  std::atomic<uint64_t> tail;
+
+};
+
+#endif // FOUNDQUEUEH
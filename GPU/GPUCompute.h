@@ -18,88 +18,193 @@
 // CUDA Kernel main function
 // Compute SecpK1 keys and calculate RIPEMD160(SHA256(key)) then check prefix
 // For the kernel, we use a 16 bits prefix lookup table which correspond to ~3 Base58 characters
-// A second level lookup table contains 32 bits prefix (if used)
+// A second level lookup table contains 32 bits prefix (full addresses) or hash160 intervals (prefixes)
 // (The CPU computes the full address and check the full prefix)
 //
 // We use affine coordinates for elliptic curve point (ie Z=1)
+//
+// Kernels are specialized at compile time on the search mode, the address type
+// and the lookup kind, so the key loop does not branch on them.
+
+// Lookup kinds
+#define LOOKUP16       0  // 16 bits prefix table only
+#define LOOKUP32       1  // 16 bits prefix table and sorted 32 bits prefixes
+#define LOOKUP_PATTERN 2  // Pattern automaton (given as lookup32)
+#define LOOKUP_RANGE   3  // 16 bits prefix table and sorted hash160 intervals (64 bits)
+#define LOOKUP_MASK    4  // Bech32 masks over the hash160 (given as lookup32)
+
+// Bloom filter location in lookup32 (0 when not used)
+__device__ __constant__ uint32_t _bloomOffset = 0;
+__device__ __constant__ uint32_t _bloomMask = 0;
+
+// Case folded automaton of the case unsensitive prefixes (NULL when not used)
+__device__ __constant__ uint16_t *_foldPattern = NULL;
+
+// Public key hash160 of uncompressed points checked (P2PKH searched)
+__device__ __constant__ uint32_t _uncompKeyHash = 1;
+
+__device__ __forceinline__ bool BloomCheck(uint32_t *lookup32, uint32_t *_h) {
+
+  uint32_t *bloom = lookup32 + _bloomOffset;
+  for (uint32_t i = 0; i < BLOOM_NB_HASH; i++) {
+    uint32_t b = BLOOM_HASH(_h[1], _h[2], i) & _bloomMask;
+    if ((bloom[b >> 5] & (1U << (b & 31))) == 0)
+      return false;
+  }
+  return true;
+
+}
+
+// Item: thread id, (incr << 16) | (compressed << 15) | (script hash160 << 14) | endo, hash160
+template<int type>
+__device__ __forceinline__ void AddItem(uint32_t *_h, int32_t incr, int32_t endo, int32_t mode, uint32_t maxFound, uint32_t *out) {
+
+  uint32_t tid = (blockIdx.x*blockDim.x) + threadIdx.x;
+  uint32_t pos = atomicAdd(out, 1);
+  if (pos < maxFound) {
+    out[pos*ITEM_SIZE32 + 1] = tid;
+    out[pos*ITEM_SIZE32 + 2] = (uint32_t)(incr << 16) | (uint32_t)(mode << 15) | (uint32_t)((type == P2SH) << 14) | (uint32_t)(endo);
+    out[pos*ITEM_SIZE32 + 3] = _h[0];
+    out[pos*ITEM_SIZE32 + 4] = _h[1];
+    out[pos*ITEM_SIZE32 + 5] = _h[2];
+    out[pos*ITEM_SIZE32 + 6] = _h[3];
+    out[pos*ITEM_SIZE32 + 7] = _h[4];
+  }
+
+}
 
-__device__ __noinline__ void CheckPoint(uint32_t *_h, int32_t incr, int32_t endo, int32_t mode,prefix_t *prefix,
-                                        uint32_t *lookup32, uint32_t maxFound, uint32_t *out,int type) {
+template<int type>
+__device__ __noinline__ void CheckPattern(uint32_t *_h, int32_t incr, int32_t endo, int32_t mode,
+                                          uint16_t *pattern, uint32_t maxFound, uint32_t *out) {
+
+  // No lookup compute address
+  char add[48];
+  _GetAddress(type, _h, add);
+  if (_Match(add, pattern))
+    AddItem<type>(_h, incr, endo, mode, maxFound, out);
+
+}
+
+// Case unsensitive prefixes: only their first letters are in the lookup tables,
+// the address is compared case folded (LOOKUP16 and LOOKUP_RANGE)
+template<int type>
+__device__ __noinline__ bool CheckFold(uint32_t *_h) {
+
+  char add[48];
+  _GetAddress(type, _h, add);
+  return _Match(add, _foldPattern);
+
+}
+
+// The lookup kind is known at compile time, the lookup code is inlined in the key loop
+template<int type, int lookup>
+__device__ __forceinline__ void CheckPoint(uint32_t *_h, int32_t incr, int32_t endo, int32_t mode, prefix_t *prefix,
+                                           uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
 
   uint32_t   off;
   prefixl_t  l32;
   prefix_t   pr0;
   prefix_t   hit;
-  uint32_t   pos;
   uint32_t   st;
   uint32_t   ed;
   uint32_t   mi;
   uint32_t   lmi;
-  uint32_t   tid = (blockIdx.x*blockDim.x) + threadIdx.x;
-  char       add[48];
 
-  if (prefix == NULL) {
+  if (lookup == LOOKUP_PATTERN) {
+    CheckPattern<type>(_h, incr, endo, mode, (uint16_t *)lookup32, maxFound, out);
+    return;
+  }
 
-    // No lookup compute address and return
-    char *pattern = (char *)lookup32;
-    _GetAddress(type, _h, add);
-    if (_Match(add, pattern)) {
-      // found
-      goto addItem;
+  if (lookup == LOOKUP_MASK) {
+    // Number of masks followed by (mask[5], value[5]) items, no address encoding
+    uint32_t *m = lookup32 + 1;
+    for (st = 0; st < lookup32[0]; st++, m += 10) {
+      if ((_h[0] & m[0]) == m[5] && (_h[1] & m[1]) == m[6] && (_h[2] & m[2]) == m[7] &&
+          (_h[3] & m[3]) == m[8] && (_h[4] & m[4]) == m[9]) {
+        AddItem<type>(_h, incr, endo, mode, maxFound, out);
+        return;
+      }
     }
+    return;
+  }
 
-  } else {
-
-    // Lookup table
-    pr0 = *(prefix_t *)(_h);
-    hit = prefix[pr0];
-
-    if (hit) {
-
-      if (lookup32) {
-        off = lookup32[pr0];
-        l32 = _h[0];
-        st = off;
-        ed = off + hit - 1;
-        while (st <= ed) {
-          mi = (st + ed) / 2;
-          lmi = lookup32[mi];
-          if (l32 < lmi) {
-            ed = mi - 1;
-          } else if (l32 == lmi) {
-            // found
-            goto addItem;
-          } else {
-            st = mi + 1;
-          }
-        }
+  // Lookup table
+  pr0 = *(prefix_t *)(_h);
+  hit = prefix[pr0];
+  if (!hit)
+    return;
+
+  if (lookup == LOOKUP_RANGE) {
+    // Last interval starting at or below the first 64 bits of the hash (big endian)
+    uint64_t key = ((uint64_t)__byte_perm(_h[0], 0, 0x0123) << 32) | (uint64_t)__byte_perm(_h[1], 0, 0x0123);
+    uint64_t *r = (uint64_t *)(lookup32 + lookup32[pr0]);
+    st = 0;
+    ed = hit;
+    while (st < ed) {
+      mi = (st + ed) / 2;
+      if (r[2 * mi] <= key)
+        st = mi + 1;
+      else
+        ed = mi;
+    }
+    if (st > 0 && key <= r[2 * st - 1]) {
+      if (_foldPattern && !CheckFold<type>(_h))
         return;
-      }
+      AddItem<type>(_h, incr, endo, mode, maxFound, out);
+    }
+    return;
+  }
 
-    addItem:
-
-      pos = atomicAdd(out, 1);
-      if (pos < maxFound) {
-        out[pos*ITEM_SIZE32 + 1] = tid;
-        out[pos*ITEM_SIZE32 + 2] = (uint32_t)(incr << 16) | (uint32_t)(mode << 15) | (uint32_t)(endo);
-        out[pos*ITEM_SIZE32 + 3] = _h[0];
-        out[pos*ITEM_SIZE32 + 4] = _h[1];
-        out[pos*ITEM_SIZE32 + 5] = _h[2];
-        out[pos*ITEM_SIZE32 + 6] = _h[3];
-        out[pos*ITEM_SIZE32 + 7] = _h[4];
+  if (lookup == LOOKUP32) {
+    off = lookup32[pr0];
+    l32 = _h[0];
+    st = off;
+    ed = off + hit - 1;
+    while (st <= ed) {
+      mi = (st + ed) / 2;
+      lmi = lookup32[mi];
+      if (l32 < lmi) {
+        ed = mi - 1;
+      } else if (l32 == lmi) {
+        // found (the Bloom filter drops most of the 32 bits collisions)
+        if (!_bloomMask || BloomCheck(lookup32, _h))
+          AddItem<type>(_h, incr, endo, mode, maxFound, out);
+        return;
+      } else {
+        st = mi + 1;
       }
-
     }
-
+    return;
   }
 
+  if (_foldPattern && !CheckFold<type>(_h))
+    return;
+  AddItem<type>(_h, incr, endo, mode, maxFound, out);
+
 }
 
 // -----------------------------------------------------------------------------------------
 
-#define CHECK_POINT(_h,incr,endo,mode)  CheckPoint(_h,incr,endo,mode,prefix,lookup32,maxFound,out,P2PKH)
-#define CHECK_POINT_P2SH(_h,incr,endo,mode)  CheckPoint(_h,incr,endo,mode,prefix,lookup32,maxFound,out,P2SH)
+// Check the public key hash160 (P2PKH, BECH32) and/or the script hash160 (P2SH)
+// derived from it, P2PKH_P2SH checks both with a single EC computation
+template<int type, int lookup>
+__device__ __forceinline__ void CheckKeyHash(uint32_t *h, int32_t incr, int32_t endo, int32_t mode, prefix_t *prefix,
+                                             uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
+
+  uint32_t sh[5];
+
+  if (type != P2SH && (mode || _uncompKeyHash))
+    CheckPoint<P2PKH, lookup>(h, incr, endo, mode, prefix, lookup32, maxFound, out);
+  if (type == P2SH || type == P2PKH_P2SH) {
+    _GetScriptHash160(h, (uint8_t *)sh);
+    CheckPoint<P2SH, lookup>(sh, incr, endo, mode, prefix, lookup32, maxFound, out);
+  }
+
+}
+
+#define CHECK_POINT(_h,incr,endo,mode)  CheckKeyHash<type, lookup>(_h,incr,endo,mode,prefix,lookup32,maxFound,out)
 
+template<int type, int lookup>
 __device__ __noinline__ void CheckHashComp(prefix_t *prefix, uint64_t *px, uint8_t isOdd, int32_t incr,
                                            uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
 
@@ -123,36 +228,9 @@ __device__ __noinline__ void CheckHashComp(prefix_t *prefix, uint64_t *px, uint8
   _GetHash160Comp(pe2x, !isOdd, (uint8_t *)h);
   CHECK_POINT(h, -incr, 2, true);
 
-
 }
 
-__device__ __noinline__ void CheckHashP2SHComp(prefix_t *prefix, uint64_t *px, uint8_t isOdd, int32_t incr,
-  uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
-
-  uint32_t   h[5];
-  uint64_t   pe1x[4];
-  uint64_t   pe2x[4];
-
-  _GetHash160P2SHComp(px, isOdd, (uint8_t *)h);
-  CHECK_POINT_P2SH(h, incr, 0, true);
-  _ModMult(pe1x, px, _beta);
-  _GetHash160P2SHComp(pe1x, isOdd, (uint8_t *)h);
-  CHECK_POINT_P2SH(h, incr, 1, true);
-  _ModMult(pe2x, px, _beta2);
-  _GetHash160P2SHComp(pe2x, isOdd, (uint8_t *)h);
-  CHECK_POINT_P2SH(h, incr, 2, true);
-
-  _GetHash160P2SHComp(px, !isOdd, (uint8_t *)h);
-  CHECK_POINT_P2SH(h, -incr, 0, true);
-  _GetHash160P2SHComp(pe1x, !isOdd, (uint8_t *)h);
-  CHECK_POINT_P2SH(h, -incr, 1, true);
-  _GetHash160P2SHComp(pe2x, !isOdd, (uint8_t *)h);
-  CHECK_POINT_P2SH(h, -incr, 2, true);
-
-}
-
-// -----------------------------------------------------------------------------------------
-
+template<int type, int lookup>
 __device__ __noinline__ void CheckHashUncomp(prefix_t *prefix, uint64_t *px, uint64_t *py, int32_t incr,
                                              uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
 
@@ -181,80 +259,35 @@ __device__ __noinline__ void CheckHashUncomp(prefix_t *prefix, uint64_t *px, uin
 
 }
 
-__device__ __noinline__ void CheckHashP2SHUncomp(prefix_t *prefix, uint64_t *px, uint64_t *py, int32_t incr,
-  uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
-
-  uint32_t   h[5];
-  uint64_t   pe1x[4];
-  uint64_t   pe2x[4];
-  uint64_t   pyn[4];
-
-  _GetHash160P2SHUncomp(px, py, (uint8_t *)h);
-  CHECK_POINT_P2SH(h, incr, 0, false);
-  _ModMult(pe1x, px, _beta);
-  _GetHash160P2SHUncomp(pe1x, py, (uint8_t *)h);
-  CHECK_POINT_P2SH(h, incr, 1, false);
-  _ModMult(pe2x, px, _beta2);
-  _GetHash160P2SHUncomp(pe2x, py, (uint8_t *)h);
-  CHECK_POINT_P2SH(h, incr, 2, false);
-
-  ModNeg256(pyn, py);
-
-  _GetHash160P2SHUncomp(px, pyn, (uint8_t *)h);
-  CHECK_POINT_P2SH(h, -incr, 0, false);
-  _GetHash160P2SHUncomp(pe1x, pyn, (uint8_t *)h);
-  CHECK_POINT_P2SH(h, -incr, 1, false);
-  _GetHash160P2SHUncomp(pe2x, pyn, (uint8_t *)h);
-  CHECK_POINT_P2SH(h, -incr, 2, false);
-
-}
-
 // -----------------------------------------------------------------------------------------
 
-__device__ __noinline__ void CheckHash(uint32_t mode, prefix_t *prefix, uint64_t *px, uint64_t *py, int32_t incr,
-                                       uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
-
-  switch (mode) {
-  case SEARCH_COMPRESSED:
-    CheckHashComp(prefix, px, (uint8_t)(py[0] & 1), incr, lookup32, maxFound, out);
-    break;
-  case SEARCH_UNCOMPRESSED:
-    CheckHashUncomp(prefix, px, py, incr, lookup32, maxFound, out);
-    break;
-  case SEARCH_BOTH:
-    CheckHashComp(prefix, px, (uint8_t)(py[0] & 1), incr, lookup32, maxFound, out);
-    CheckHashUncomp(prefix, px, py, incr, lookup32, maxFound, out);
-    break;
-  }
+template<int mode, int type, int lookup>
+__device__ __forceinline__ void CheckHash(prefix_t *prefix, uint64_t *px, uint64_t *py, int32_t incr,
+                                          uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
 
-}
-
-__device__ __noinline__ void CheckP2SHHash(uint32_t mode, prefix_t *prefix, uint64_t *px, uint64_t *py, int32_t incr,
-  uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
-
-  switch (mode) {
-  case SEARCH_COMPRESSED:
-    CheckHashP2SHComp(prefix, px, (uint8_t)(py[0] & 1), incr, lookup32, maxFound, out);
-    break;
-  case SEARCH_UNCOMPRESSED:
-    CheckHashP2SHUncomp(prefix, px, py, incr, lookup32, maxFound, out);
-    break;
-  case SEARCH_BOTH:
-    CheckHashP2SHComp(prefix, px, (uint8_t)(py[0] & 1), incr, lookup32, maxFound, out);
-    CheckHashP2SHUncomp(prefix, px, py, incr, lookup32, maxFound, out);
-    break;
-  }
+  if (mode == SEARCH_COMPRESSED || mode == SEARCH_BOTH)
+    CheckHashComp<type, lookup>(prefix, px, (uint8_t)(py[0] & 1), incr, lookup32, maxFound, out);
+  if (mode == SEARCH_UNCOMPRESSED || mode == SEARCH_BOTH)
+    CheckHashUncomp<type, lookup>(prefix, px, py, incr, lookup32, maxFound, out);
 
 }
 
-#define CHECK_PREFIX(incr) CheckHash(mode, sPrefix, px, py, j*GRP_SIZE + (incr), lookup32, maxFound, out)
+#define CHECK_PREFIX(incr) CheckHash<mode, type, lookup>(sPrefix, px, py, j*grp + (incr), lookup32, maxFound, out)
 
 // -----------------------------------------------------------------------------------------
 
-__device__ void ComputeKeys(uint32_t mode, uint64_t *startx, uint64_t *starty,
-                            prefix_t *sPrefix, uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
+// Generator table in constant memory, or staged in shared memory by the block kernel
+#define GX(i) (kernel == GPU_KERNEL_BLOCK ? sGx[i] : Gx[i])
+#define GY(i) (kernel == GPU_KERNEL_BLOCK ? sGy[i] : Gy[i])
 
-  uint64_t dx[GRP_SIZE/2+1][4];
+// The group size grp sizes the per thread dx[] array, the kernels are
+// instantiated for each size of -gpugroup (256, 512 or 1024)
+template<int mode, int type, int lookup, int kernel, int grp>
+__device__ void ComputeKeys(uint64_t *startx, uint64_t *starty,
+                            prefix_t *sPrefix, uint32_t *lookup32, uint32_t maxFound, uint32_t *out,
+                            uint64_t (*sGx)[4] = NULL, uint64_t (*sGy)[4] = NULL, uint64_t *sInv = NULL) {
+
+  uint64_t dx[grp/2+1][4];
   uint64_t px[4];
   uint64_t py[4];
   uint64_t pyn[4];
@@ -263,7 +296,6 @@ __device__ void ComputeKeys(uint32_t mode, uint64_t *startx, uint64_t *starty,
   uint64_t dy[4];
   uint64_t _s[4];
   uint64_t _p2[4];
-  char pattern[48];
 
   // Load starting key
   __syncthreads();
@@ -272,28 +304,28 @@ __device__ void ComputeKeys(uint32_t mode, uint64_t *startx, uint64_t *starty,
   Load256(px, sx);
   Load256(py, sy);
 
-  if (sPrefix == NULL) {
-    memcpy(pattern,lookup32,48);
-    lookup32 = (uint32_t *)pattern;
-  }
-
-  for (uint32_t j = 0; j < STEP_SIZE / GRP_SIZE; j++) {
+  for (uint32_t j = 0; j < STEP_SIZE / grp; j++) {
 
     // Fill group with delta x
     uint32_t i;
     for (i = 0; i < HSIZE; i++)
-      ModSub256(dx[i], Gx[i], sx);
-    ModSub256(dx[i] , Gx[i], sx);  // For the first point
+      ModSub256(dx[i], GX(i), sx);
+    ModSub256(dx[i] , GX(i), sx);  // For the first point
     ModSub256(dx[i+1],_2Gnx, sx);  // For the next center point
 
     // Compute modular inverse
-    _ModInvGrouped(dx);
+#ifdef GPU_BLOCK_KERNEL
+    if (kernel == GPU_KERNEL_BLOCK)
+      _ModInvGroupedBlock<grp>(dx, sInv);
+    else
+#endif
+      _ModInvGrouped<grp>(dx);
 
     // We use the fact that P + i*G and P - i*G has the same deltax, so the same inverse
     // We compute key in the positive and negative way from the center of the group
 
     // Check starting point
-    CHECK_PREFIX(GRP_SIZE / 2);
+    CHECK_PREFIX(grp / 2);
 
     ModNeg256(pyn,py);
 
@@ -302,59 +334,59 @@ __device__ void ComputeKeys(uint32_t mode, uint64_t *startx, uint64_t *starty,
       // P = StartPoint + i*G
       Load256(px, sx);
       Load256(py, sy);
-      ModSub256(dy, Gy[i], py);
+      ModSub256(dy, GY(i), py);
 
       _ModMult(_s, dy, dx[i]);      //  s = (p2.y-p1.y)*inverse(p2.x-p1.x)
       _ModSqr(_p2, _s);             // _p2 = pow2(s)
 
       ModSub256(px, _p2,px);
-      ModSub256(px, Gx[i]);         // px = pow2(s) - p1.x - p2.x;
+      ModSub256(px, GX(i));         // px = pow2(s) - p1.x - p2.x;
 
-      ModSub256(py, Gx[i], px);
+      ModSub256(py, GX(i), px);
       _ModMult(py, _s);             // py = - s*(ret.x-p2.x)
-      ModSub256(py, Gy[i]);         // py = - p2.y - s*(ret.x-p2.x);
+      ModSub256(py, GY(i));         // py = - p2.y - s*(ret.x-p2.x);
 
-      CHECK_PREFIX(GRP_SIZE / 2 + (i + 1));
+      CHECK_PREFIX(grp / 2 + (i + 1));
 
       // P = StartPoint - i*G, if (x,y) = i*G then (x,-y) = -i*G
       Load256(px, sx);
-      ModSub256(dy,pyn,Gy[i]);
+      ModSub256(dy,pyn,GY(i));
 
       _ModMult(_s, dy, dx[i]);      //  s = (p2.y-p1.y)*inverse(p2.x-p1.x)
       _ModSqr(_p2, _s);             // _p = pow2(s)
 
       ModSub256(px, _p2, px);
-      ModSub256(px, Gx[i]);         // px = pow2(s) - p1.x - p2.x;
+      ModSub256(px, GX(i));         // px = pow2(s) - p1.x - p2.x;
 
-      ModSub256(py, px, Gx[i]);
+      ModSub256(py, px, GX(i));
       _ModMult(py, _s);             // py = s*(ret.x-p2.x)
-      ModSub256(py, Gy[i], py);     // py = - p2.y - s*(ret.x-p2.x);
+      ModSub256(py, GY(i), py);     // py = - p2.y - s*(ret.x-p2.x);
 
-      CHECK_PREFIX(GRP_SIZE / 2 - (i + 1));
+      CHECK_PREFIX(grp / 2 - (i + 1));
 
     }
 
     // First point (startP - (GRP_SZIE/2)*G)
     Load256(px, sx);
     Load256(py, sy);
-    ModNeg256(dy, Gy[i]);
+    ModNeg256(dy, GY(i));
     ModSub256(dy, py);
 
     _ModMult(_s, dy, dx[i]);      //  s = (p2.y-p1.y)*inverse(p2.x-p1.x)
     _ModSqr(_p2,_s);              // _p = pow2(s)
 
     ModSub256(px, _p2, px);
-    ModSub256(px, Gx[i]);         // px = pow2(s) - p1.x - p2.x;
+    ModSub256(px, GX(i));         // px = pow2(s) - p1.x - p2.x;
 
-    ModSub256(py, px, Gx[i]);
+    ModSub256(py, px, GX(i));
     _ModMult(py, _s);             // py = s*(ret.x-p2.x)
-    ModSub256(py, Gy[i], py);     // py = - p2.y - s*(ret.x-p2.x);
+    ModSub256(py, GY(i), py);     // py = - p2.y - s*(ret.x-p2.x);
 
     CHECK_PREFIX(0);
 
     i++;
 
-    // Next start point (startP + GRP_SIZE*G)
+    // Next start point (startP + grp*G)
     Load256(px, sx);
     Load256(py, sy);
     ModSub256(dy, _2Gny, py);
@@ -379,13 +411,26 @@ __device__ void ComputeKeys(uint32_t mode, uint64_t *startx, uint64_t *starty,
 }
 
 // -----------------------------------------------------------------------------------------
+// Optimized kernel for compressed P2PKH address only
 
-#define CHECK_PREFIX_P2SH(incr) CheckP2SHHash(mode, sPrefix, px, py, j*GRP_SIZE + (incr), lookup32, maxFound, out)
+#define CHECK_P2PKH_POINT(_incr) {                                             \
+_GetHash160CompSym(px, (uint8_t *)h1, (uint8_t *)h2);                          \
+CheckPoint<P2PKH, lookup>(h1, (_incr), 0, true, sPrefix, lookup32, maxFound, out);  \
+CheckPoint<P2PKH, lookup>(h2, -(_incr), 0, true, sPrefix, lookup32, maxFound, out); \
+_ModMult(pe1x, px, _beta);                                                     \
+_GetHash160CompSym(pe1x, (uint8_t *)h1, (uint8_t *)h2);                        \
+CheckPoint<P2PKH, lookup>(h1, (_incr), 1, true, sPrefix, lookup32, maxFound, out);  \
+CheckPoint<P2PKH, lookup>(h2, -(_incr), 1, true, sPrefix, lookup32, maxFound, out); \
+_ModMult(pe2x, px, _beta2);                                                    \
+_GetHash160CompSym(pe2x, (uint8_t *)h1, (uint8_t *)h2);                        \
+CheckPoint<P2PKH, lookup>(h1, (_incr), 2, true, sPrefix, lookup32, maxFound, out);  \
+CheckPoint<P2PKH, lookup>(h2, -(_incr), 2, true, sPrefix, lookup32, maxFound, out); \
+}
 
-__device__ void ComputeKeysP2SH(uint32_t mode, uint64_t *startx, uint64_t *starty,
-  prefix_t *sPrefix, uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
+template<int lookup, int grp>
+__device__ void ComputeKeysComp(uint64_t *startx, uint64_t *starty, prefix_t *sPrefix, uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
 
-  uint64_t dx[GRP_SIZE / 2 + 1][4];
+  uint64_t dx[grp/2+1][4];
   uint64_t px[4];
   uint64_t py[4];
   uint64_t pyn[4];
@@ -394,7 +439,10 @@ __device__ void ComputeKeysP2SH(uint32_t mode, uint64_t *startx, uint64_t *start
   uint64_t dy[4];
   uint64_t _s[4];
   uint64_t _p2[4];
-  char pattern[48];
+  uint32_t   h1[5];
+  uint32_t   h2[5];
+  uint64_t   pe1x[4];
+  uint64_t   pe2x[4];
 
   // Load starting key
   __syncthreads();
@@ -403,32 +451,27 @@ __device__ void ComputeKeysP2SH(uint32_t mode, uint64_t *startx, uint64_t *start
   Load256(px, sx);
   Load256(py, sy);
 
-  if (sPrefix == NULL) {
-    memcpy(pattern, lookup32, 48);
-    lookup32 = (uint32_t *)pattern;
-  }
-
-  for (uint32_t j = 0; j < STEP_SIZE / GRP_SIZE; j++) {
+  for (uint32_t j = 0; j < STEP_SIZE / grp; j++) {
 
     // Fill group with delta x
     uint32_t i;
     for (i = 0; i < HSIZE; i++)
       ModSub256(dx[i], Gx[i], sx);
-    ModSub256(dx[i], Gx[i], sx);  // For the first point
-    ModSub256(dx[i + 1], _2Gnx, sx);  // For the next center point
+    ModSub256(dx[i] , Gx[i], sx);  // For the first point
+    ModSub256(dx[i+1],_2Gnx, sx);  // For the next center point
 
     // Compute modular inverse
-    _ModInvGrouped(dx);
+    _ModInvGrouped<grp>(dx);
 
     // We use the fact that P + i*G and P - i*G has the same deltax, so the same inverse
     // We compute key in the positive and negative way from the center of the group
 
     // Check starting point
-    CHECK_PREFIX_P2SH(GRP_SIZE / 2);
+    CHECK_P2PKH_POINT(j*grp + (grp/2));
 
-    ModNeg256(pyn, py);
+    ModNeg256(pyn,py);
 
-    for (i = 0; i < HSIZE; i++) {
+    for(i = 0; i < HSIZE; i++) {
 
       __syncthreads();
       // P = StartPoint + i*G
@@ -439,19 +482,15 @@ __device__ void ComputeKeysP2SH(uint32_t mode, uint64_t *startx, uint64_t *start
       _ModMult(_s, dy, dx[i]);      //  s = (p2.y-p1.y)*inverse(p2.x-p1.x)
       _ModSqr(_p2, _s);             // _p2 = pow2(s)
 
-      ModSub256(px, _p2, px);
+      ModSub256(px, _p2,px);
       ModSub256(px, Gx[i]);         // px = pow2(s) - p1.x - p2.x;
 
-      ModSub256(py, Gx[i], px);
-      _ModMult(py, _s);             // py = - s*(ret.x-p2.x)
-      ModSub256(py, Gy[i]);         // py = - p2.y - s*(ret.x-p2.x);
-
-      CHECK_PREFIX_P2SH(GRP_SIZE / 2 + (i + 1));
+      CHECK_P2PKH_POINT(j*grp + (grp/2 + (i + 1)));
 
       __syncthreads();
       // P = StartPoint - i*G, if (x,y) = i*G then (x,-y) = -i*G
       Load256(px, sx);
-      ModSub256(dy, pyn, Gy[i]);
+      ModSub256(dy,pyn,Gy[i]);
 
       _ModMult(_s, dy, dx[i]);      //  s = (p2.y-p1.y)*inverse(p2.x-p1.x)
       _ModSqr(_p2, _s);             // _p = pow2(s)
@@ -459,11 +498,7 @@ __device__ void ComputeKeysP2SH(uint32_t mode, uint64_t *startx, uint64_t *start
       ModSub256(px, _p2, px);
       ModSub256(px, Gx[i]);         // px = pow2(s) - p1.x - p2.x;
 
-      ModSub256(py,px, Gx[i]);
-      _ModMult(py, _s);             // py = s*(ret.x-p2.x)
-      ModSub256(py, Gy[i], py);     // py = - p2.y - s*(ret.x-p2.x);
-
-      CHECK_PREFIX_P2SH(GRP_SIZE / 2 - (i + 1));
+      CHECK_P2PKH_POINT(j*grp + (grp/2 - (i + 1)));
 
     }
 
@@ -475,21 +510,17 @@ __device__ void ComputeKeysP2SH(uint32_t mode, uint64_t *startx, uint64_t *start
     ModSub256(dy, py);
 
     _ModMult(_s, dy, dx[i]);      //  s = (p2.y-p1.y)*inverse(p2.x-p1.x)
-    _ModSqr(_p2, _s);              // _p = pow2(s)
+    _ModSqr(_p2,_s);              // _p = pow2(s)
 
     ModSub256(px, _p2, px);
     ModSub256(px, Gx[i]);         // px = pow2(s) - p1.x - p2.x;
 
-    ModSub256(py,px , Gx[i]);
-    _ModMult(py, _s);             // py = s*(ret.x-p2.x)
-    ModSub256(py, Gy[i], py);     // py = - p2.y - s*(ret.x-p2.x);
-
-    CHECK_PREFIX_P2SH(0);
+    CHECK_P2PKH_POINT(j*grp + (0));
 
     i++;
 
     __syncthreads();
-    // Next start point (startP + GRP_SIZE*G)
+    // Next start point (startP + grp*G)
     Load256(px, sx);
     Load256(py, sy);
     ModSub256(dy, _2Gny, py);
@@ -514,133 +545,49 @@ __device__ void ComputeKeysP2SH(uint32_t mode, uint64_t *startx, uint64_t *start
 }
 
 // -----------------------------------------------------------------------------------------
-// Optimized kernel for compressed P2PKH address only
-
-#define CHECK_P2PKH_POINT(_incr) {                                             \
-_GetHash160CompSym(px, (uint8_t *)h1, (uint8_t *)h2);                          \
-CheckPoint(h1, (_incr), 0, true, sPrefix, lookup32, maxFound, out, P2PKH);     \
-CheckPoint(h2, -(_incr), 0, true, sPrefix, lookup32, maxFound, out, P2PKH);    \
-_ModMult(pe1x, px, _beta);                                                     \
-_GetHash160CompSym(pe1x, (uint8_t *)h1, (uint8_t *)h2);                        \
-CheckPoint(h1, (_incr), 1, true, sPrefix, lookup32, maxFound, out, P2PKH);     \
-CheckPoint(h2, -(_incr), 1, true, sPrefix, lookup32, maxFound, out, P2PKH);    \
-_ModMult(pe2x, px, _beta2);                                                    \
-_GetHash160CompSym(pe2x, (uint8_t *)h1, (uint8_t *)h2);                        \
-CheckPoint(h1, (_incr), 2, true, sPrefix, lookup32, maxFound, out, P2PKH);     \
-CheckPoint(h2, -(_incr), 2, true, sPrefix, lookup32, maxFound, out, P2PKH);    \
-}
+// Starting point of thread tid: table[0] + sum of table[k+1] for each bit k set in tid.
+// table holds affine points (x[4],y[4]), table[k+1] = 2^k*stride.
 
-__device__ void ComputeKeysComp(uint64_t *startx, uint64_t *starty, prefix_t *sPrefix, uint32_t *lookup32, uint32_t maxFound, uint32_t *out) {
+__device__ void ComputeStartKey(uint64_t *table, uint32_t nbBit, uint32_t tid, uint64_t *startx, uint64_t *starty) {
 
-  uint64_t dx[GRP_SIZE/2+1][4];
+  uint64_t dx[5];
+  uint64_t dy[4];
   uint64_t px[4];
   uint64_t py[4];
-  uint64_t pyn[4];
-  uint64_t sx[4];
-  uint64_t sy[4];
-  uint64_t dy[4];
+  uint64_t rx[4];
   uint64_t _s[4];
   uint64_t _p2[4];
-  uint32_t   h1[5];
-  uint32_t   h2[5];
-  uint64_t   pe1x[4];
-  uint64_t   pe2x[4];
-
-  // Load starting key
-  __syncthreads();
-  Load256A(sx, startx);
-  Load256A(sy, starty);
-  Load256(px, sx);
-  Load256(py, sy);
-
-  for (uint32_t j = 0; j < STEP_SIZE / GRP_SIZE; j++) {
-
-    // Fill group with delta x
-    uint32_t i;
-    for (i = 0; i < HSIZE; i++)
-      ModSub256(dx[i], Gx[i], sx);
-    ModSub256(dx[i] , Gx[i], sx);  // For the first point
-    ModSub256(dx[i+1],_2Gnx, sx);  // For the next center point
-
-    // Compute modular inverse
-    _ModInvGrouped(dx);
-
-    // We use the fact that P + i*G and P - i*G has the same deltax, so the same inverse
-    // We compute key in the positive and negative way from the center of the group
-
-    // Check starting point
-    CHECK_P2PKH_POINT(j*GRP_SIZE + (GRP_SIZE/2));
-
-    ModNeg256(pyn,py);
-
-    for(i = 0; i < HSIZE; i++) {
-
-      __syncthreads();
-      // P = StartPoint + i*G
-      Load256(px, sx);
-      Load256(py, sy);
-      ModSub256(dy, Gy[i], py);
-
-      _ModMult(_s, dy, dx[i]);      //  s = (p2.y-p1.y)*inverse(p2.x-p1.x)
-      _ModSqr(_p2, _s);             // _p2 = pow2(s)
-
-      ModSub256(px, _p2,px);
-      ModSub256(px, Gx[i]);         // px = pow2(s) - p1.x - p2.x;
-
-      CHECK_P2PKH_POINT(j*GRP_SIZE + (GRP_SIZE/2 + (i + 1)));
-
-      __syncthreads();
-      // P = StartPoint - i*G, if (x,y) = i*G then (x,-y) = -i*G
-      Load256(px, sx);
-      ModSub256(dy,pyn,Gy[i]);
-
-      _ModMult(_s, dy, dx[i]);      //  s = (p2.y-p1.y)*inverse(p2.x-p1.x)
-      _ModSqr(_p2, _s);             // _p = pow2(s)
-
-      ModSub256(px, _p2, px);
-      ModSub256(px, Gx[i]);         // px = pow2(s) - p1.x - p2.x;
-
-      CHECK_P2PKH_POINT(j*GRP_SIZE + (GRP_SIZE/2 - (i + 1)));
 
-    }
+  Load256(px, table);
+  Load256(py, table + 4);
 
-    __syncthreads();
-    // First point (startP - (GRP_SZIE/2)*G)
-    Load256(px, sx);
-    Load256(py, sy);
-    ModNeg256(dy, Gy[i]);
-    ModSub256(dy, py);
-
-    _ModMult(_s, dy, dx[i]);      //  s = (p2.y-p1.y)*inverse(p2.x-p1.x)
-    _ModSqr(_p2,_s);              // _p = pow2(s)
-
-    ModSub256(px, _p2, px);
-    ModSub256(px, Gx[i]);         // px = pow2(s) - p1.x - p2.x;
+  for (uint32_t k = 0; k < nbBit; k++) {
 
-    CHECK_P2PKH_POINT(j*GRP_SIZE + (0));
+    if ((tid & (1U << k)) == 0)
+      continue;
 
-    i++;
+    uint64_t *qx = table + 8 * (k + 1);
+    uint64_t *qy = qx + 4;
 
-    __syncthreads();
-    // Next start point (startP + GRP_SIZE*G)
-    Load256(px, sx);
-    Load256(py, sy);
-    ModSub256(dy, _2Gny, py);
+    // We need 320bit signed int for ModInv
+    ModSub256(dx, qx, px);
+    dx[4] = 0;
+    _ModInv(dx);
+    ModSub256(dy, qy, py);
 
-    _ModMult(_s, dy, dx[i]);      //  s = (p2.y-p1.y)*inverse(p2.x-p1.x)
+    _ModMult(_s, dy, dx);         //  s = (q.y-p.y)*inverse(q.x-p.x)
     _ModSqr(_p2, _s);             // _p2 = pow2(s)
 
-    ModSub256(px, _p2, px);
-    ModSub256(px, _2Gnx);         // px = pow2(s) - p1.x - p2.x;
+    ModSub256(rx, _p2, px);
+    ModSub256(rx, qx);            // rx = pow2(s) - p.x - q.x
 
-    ModSub256(py, _2Gnx, px);
-    _ModMult(py, _s);             // py = - s*(ret.x-p2.x)
-    ModSub256(py, _2Gny);         // py = - p2.y - s*(ret.x-p2.x);
+    ModSub256(dy, px, rx);
+    _ModMult(dy, _s);             // dy = s*(p.x-rx)
+    ModSub256(py, dy, py);        // py = s*(p.x-rx) - p.y
+    Load256(px, rx);
 
   }
 
-  // Update starting point
-  __syncthreads();
   Store256A(startx, px);
   Store256A(starty, py);
 
@@ -0,0 +1,354 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GPUEngine.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef WIN64
+#include <Windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// ----------------------------------------------------------------------------
+
+GPUDevice *GPUDevice::Create(int backend, int nbThreadGroup, int nbThreadPerGroup, int gpuId, uint32_t maxFound, bool rekey) {
+
+  switch (backend) {
+  case GPU_BACKEND:
+    return new GPUEngine(nbThreadGroup, nbThreadPerGroup, gpuId, maxFound, rekey);
+  }
+
+  printf("GPUDevice: backend %d not compiled\n", backend);
+  return NULL;
+
+}
+
+// ----------------------------------------------------------------------------
+// Backend wide functions
+
+void GPUDevice::PrintDeviceInfo(int backend) {
+
+  switch (backend) {
+  case GPU_BACKEND:
+    GPUEngine::PrintCudaInfo();
+    return;
+  }
+
+  printf("GPUDevice: backend %d not compiled\n", backend);
+
+}
+
+bool GPUDevice::GetDeviceInfo(int backend, int gpuId, std::string &key, int *nbMP, int *maxThreadPerGroup) {
+
+  switch (backend) {
+  case GPU_BACKEND:
+    return GPUEngine::GetDeviceInfo(gpuId, key, nbMP, maxThreadPerGroup);
+  }
+
+  printf("GPUDevice: backend %d not compiled\n", backend);
+  return false;
+
+}
+
+void GPUDevice::InitGroupTable(int backend, Secp256K1 *secp) {
+
+  switch (backend) {
+  case GPU_BACKEND:
+    GPUEngine::InitGroupTable(secp);
+    break;
+  }
+
+}
+
+void GPUDevice::SetSyncMode(int backend, int mode) {
+
+  switch (backend) {
+  case GPU_BACKEND:
+    GPUEngine::SetSyncMode(mode);
+    break;
+  }
+
+}
+
+void GPUDevice::SetKernelMode(int backend, int mode) {
+
+  switch (backend) {
+  case GPU_BACKEND:
+    GPUEngine::SetKernelMode(mode);
+    break;
+  }
+
+}
+
+void GPUDevice::SetGroupSize(int backend, int size) {
+
+  switch (backend) {
+  case GPU_BACKEND:
+    GPUEngine::SetGroupSize(size);
+    break;
+  }
+
+}
+
+bool GPUDevice::HasKernelMode(int backend, int mode) {
+
+  switch (backend) {
+  case GPU_BACKEND:
+    return GPUEngine::HasKernelMode(mode);
+  }
+
+  return false;
+
+}
+
+void *GPUDevice::HostAlloc(int backend, uint64_t size) {
+
+  switch (backend) {
+  case GPU_BACKEND:
+    return GPUEngine::HostAlloc(size);
+  }
+
+  return NULL;
+
+}
+
+void GPUDevice::HostFree(int backend, void *p) {
+
+  switch (backend) {
+  case GPU_BACKEND:
+    GPUEngine::HostFree(p);
+    break;
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+// Shared prefix tables
+
+GPUPrefixTable::GPUPrefixTable(int backend) {
+
+  this->backend = backend;
+  lookup16 = NULL;
+  lookup32 = NULL;
+  lookupSize = 0;
+  bloomOffset = 0;
+  bloomMask = 0;
+  hasRange = false;
+
+}
+
+GPUPrefixTable::~GPUPrefixTable() {
+
+  if(lookup16) delete[] lookup16;
+  if(lookup32) GPUDevice::HostFree(backend, lookup32);
+
+}
+
+bool GPUPrefixTable::Build(std::vector<RPREFIX> &prefixes, uint32_t totalRange) {
+
+  // 16 bits prefix offsets followed by (min,max) pairs of 64 bits
+  lookupSize = (uint64_t)(_64K + totalRange * 4) * 4;
+  lookup32 = (uint32_t *)GPUDevice::HostAlloc(backend, lookupSize);
+  if (lookup32 == NULL) {
+    printf("GPUPrefixTable: Allocate prefix range host memory failed\n");
+    return false;
+  }
+  lookup16 = new prefix_t[_64K];
+
+  uint32_t offset = _64K;
+  memset(lookup16, 0, _64K * 2);
+  memset(lookup32, 0, _64K * 4);
+  for (int i = 0; i < (int)prefixes.size(); i++) {
+    int nbRange = (int)prefixes[i].ranges.size();
+    if (nbRange > 0xFFFF) {
+      printf("GPUPrefixTable: %d ranges for prefix %04X, 65535 max\n", nbRange, prefixes[i].sPrefix);
+      return false;
+    }
+    lookup16[prefixes[i].sPrefix] = (uint16_t)nbRange;
+    lookup32[prefixes[i].sPrefix] = offset;
+    uint64_t *r = (uint64_t *)(lookup32 + offset);
+    for (int j = 0; j < nbRange; j++) {
+      r[2 * j] = prefixes[i].ranges[j].min;
+      r[2 * j + 1] = prefixes[i].ranges[j].max;
+    }
+    offset += nbRange * 4;
+  }
+
+  if (offset > (_64K + totalRange * 4)) {
+    printf("GPUPrefixTable: Wrong totalRange %d<%d!\n", totalRange, (offset - _64K) / 4);
+    return false;
+  }
+
+  bloomOffset = (uint32_t)(lookupSize / 4);
+  bloomMask = 0;
+  hasRange = true;
+  return true;
+
+}
+
+bool GPUPrefixTable::Build(std::vector<LPREFIX> &prefixes, uint32_t totalPrefix, std::vector<uint64_t> &bloomKeys) {
+
+  // Bloom filter size (power of 2 number of bits)
+  uint32_t bloomSize = 0;
+  if (bloomKeys.size() > 0) {
+    uint64_t nbBit = 1024;
+    while (nbBit < (uint64_t)bloomKeys.size() * BLOOM_BITS_PER_ITEM)
+      nbBit <<= 1;
+    if (nbBit <= 0x80000000ULL)
+      bloomSize = (uint32_t)(nbBit / 32);
+    else
+      printf("GPUPrefixTable: Bloom filter disabled (%.0f keys, more than 2^31 bits)\n", (double)bloomKeys.size());
+  }
+
+  // Second level of lookup tables
+  lookupSize = (uint64_t)(_64K + totalPrefix + bloomSize) * 4;
+  lookup32 = (uint32_t *)GPUDevice::HostAlloc(backend, lookupSize);
+  if (lookup32 == NULL && bloomSize) {
+    printf("GPUPrefixTable: Bloom filter disabled (cannot allocate %.0f MB)\n", (double)bloomSize * 4.0 / (1024.0 * 1024.0));
+    bloomSize = 0;
+    lookupSize = (uint64_t)(_64K + totalPrefix) * 4;
+    lookup32 = (uint32_t *)GPUDevice::HostAlloc(backend, lookupSize);
+  }
+  if (lookup32 == NULL) {
+    printf("GPUPrefixTable: Allocate prefix lookup host memory failed\n");
+    return false;
+  }
+  lookup16 = new prefix_t[_64K];
+
+  uint32_t offset = _64K;
+  memset(lookup16, 0, _64K * 2);
+  memset(lookup32, 0, _64K * 4);
+  for (int i = 0; i < (int)prefixes.size(); i++) {
+    int nbLPrefix = (int)prefixes[i].lPrefixes.size();
+    lookup16[prefixes[i].sPrefix] = (uint16_t)nbLPrefix;
+    lookup32[prefixes[i].sPrefix] = offset;
+    for (int j = 0; j < nbLPrefix; j++) {
+      lookup32[offset++]=prefixes[i].lPrefixes[j];
+    }
+  }
+
+  if (offset != (_64K+totalPrefix)) {
+    printf("GPUPrefixTable: Wrong totalPrefix %d!=%d!\n",offset- _64K, totalPrefix);
+    return false;
+  }
+
+  // Bloom filter right after the 32 bits prefixes
+  bloomOffset = offset;
+  bloomMask = 0;
+  if (bloomSize) {
+    uint32_t *bloom = lookup32 + offset;
+    bloomMask = bloomSize * 32 - 1;
+    memset(bloom, 0, bloomSize * 4);
+    for (int i = 0; i < (int)bloomKeys.size(); i++) {
+      uint32_t a = (uint32_t)bloomKeys[i];
+      uint32_t b = (uint32_t)(bloomKeys[i] >> 32);
+      for (uint32_t j = 0; j < BLOOM_NB_HASH; j++) {
+        uint32_t bit = BLOOM_HASH(a, b, j) & bloomMask;
+        bloom[bit >> 5] |= 1U << (bit & 31);
+      }
+    }
+  }
+
+  hasRange = false;
+  return true;
+
+}
+
+// ----------------------------------------------------------------------------
+// Engine pool
+
+static bool pooling = false;
+static std::vector<GPUDevice *> pool;
+#ifdef WIN64
+static HANDLE poolMutex = CreateMutex(NULL, FALSE, NULL);
+#else
+static pthread_mutex_t poolMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static void lockPool() {
+
+#ifdef WIN64
+  WaitForSingleObject(poolMutex, INFINITE);
+#else
+  pthread_mutex_lock(&poolMutex);
+#endif
+
+}
+
+static void unlockPool() {
+
+#ifdef WIN64
+  ReleaseMutex(poolMutex);
+#else
+  pthread_mutex_unlock(&poolMutex);
+#endif
+
+}
+
+void GPUDevice::SetPooling(bool enable) {
+  pooling = enable;
+}
+
+GPUDevice *GPUDevice::Acquire(int backend, int nbThreadGroup, int nbThreadPerGroup, int gpuId, uint32_t maxFound, bool rekey) {
+
+  char tmp[128];
+  sprintf(tmp, "%d %d %d %d %u %d", backend, nbThreadGroup, nbThreadPerGroup, gpuId, maxFound, (int)rekey);
+  std::string cfg(tmp);
+
+  if (pooling) {
+
+    GPUDevice *g = NULL;
+    lockPool();
+    for (size_t i = 0; i < pool.size() && g == NULL; i++) {
+      if (pool[i]->config == cfg) {
+        g = pool[i];
+        pool.erase(pool.begin() + i);
+      }
+    }
+    unlockPool();
+
+    if (g) {
+      if (g->Reset())
+        return g;
+      delete g;
+    }
+
+  }
+
+  GPUDevice *g = Create(backend, nbThreadGroup, nbThreadPerGroup, gpuId, maxFound, rekey);
+  if (g)
+    g->config = cfg;
+  return g;
+
+}
+
+void GPUDevice::Release(GPUDevice *g) {
+
+  if (g == NULL)
+    return;
+
+  if (!pooling) {
+    delete g;
+    return;
+  }
+
+  lockPool();
+  pool.push_back(g);
+  unlockPool();
+
+}
@@ -0,0 +1,163 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GPUDEVICEH
+#define GPUDEVICEH
+
+#include <vector>
+#include <string>
+#include "../SECP256k1.h"
+
+// GPU backends (implementations of GPUDevice). The host code calls the backend
+// through GPUDevice, a new backend adds its case to the GPUDevice dispatchers
+// (GPUDevice.cpp). GPUEngine.cu is built either by nvcc (CUDA) or by hipcc
+// (HIP, WITHHIP), GPU_BACKEND is the backend compiled in.
+#define GPU_BACKEND_CUDA 0
+#define GPU_BACKEND_HIP  1
+
+#ifdef WITHHIP
+#define GPU_BACKEND GPU_BACKEND_HIP
+#else
+#define GPU_BACKEND GPU_BACKEND_CUDA
+#endif
+
+typedef uint16_t prefix_t;
+typedef uint32_t prefixl_t;
+
+// Kernel type searching both the public key hash160 (P2PKH, BECH32)
+// and the script hash160 (P2SH) of each point
+#define P2PKH_P2SH 3
+
+typedef struct {
+  uint32_t thId;
+  int16_t  incr;
+  int16_t  endo;
+  uint8_t  *hash;
+  bool mode;
+  int type;   // P2PKH (public key hash160) or P2SH (script hash160)
+} ITEM;
+
+// Second level lookup
+typedef struct {
+  prefix_t sPrefix;
+  std::vector<prefixl_t> lPrefixes;
+} LPREFIX;
+
+// Hash160 interval, first 64 bits (big endian)
+typedef struct {
+  uint64_t min;
+  uint64_t max;
+} HRANGE;
+
+// Second level lookup on hash160 intervals (sorted, disjoint)
+typedef struct {
+  prefix_t sPrefix;
+  std::vector<HRANGE> ranges;
+} RPREFIX;
+
+// Prefix lookup tables built once on the host and shared by all the engines.
+// lookup32 is host memory of the backend (pinned, portable), each device
+// uploads it directly.
+class GPUPrefixTable {
+
+public:
+
+  GPUPrefixTable(int backend);
+  ~GPUPrefixTable();
+  bool Build(std::vector<LPREFIX> &prefixes,uint32_t totalPrefix,std::vector<uint64_t> &bloomKeys);
+  bool Build(std::vector<RPREFIX> &prefixes,uint32_t totalRange);
+
+  prefix_t *lookup16;   // 64K entries
+  uint32_t *lookup32;   // 16 bits offsets, second level items, Bloom filter
+  uint64_t lookupSize;  // lookup32 size in bytes
+  uint32_t bloomOffset; // lookup32 index of the Bloom filter
+  uint32_t bloomMask;   // 0 when no Bloom filter
+  bool hasRange;
+
+private:
+
+  int backend;
+
+};
+
+// Device engine interface driven by the search threads. A backend runs the
+// ComputeKeys/CheckHash kernels (STEP_SIZE keys per thread and per launch)
+// and returns the matching points as ITEM (hash points to the 20 bytes hash160).
+class GPUDevice {
+
+public:
+
+  virtual ~GPUDevice() {}
+  virtual void SetPrefix(std::vector<prefix_t> prefixes) = 0;
+  virtual void SetPrefix(GPUPrefixTable *table) = 0;
+  virtual void DisablePrefix(std::vector<prefix_t> &prefixes) = 0;
+  virtual bool SetKeys(Point *p) = 0;
+  virtual bool SetKeys(std::vector<Point> &table) = 0;
+  virtual void SetSearchMode(int searchMode) = 0;
+  virtual void SetSearchType(int searchType) = 0;
+  // Check the public key hash160 of uncompressed points, only P2PKH addresses
+  // use uncompressed keys (BECH32 hits from them are invalid)
+  virtual void SetUncompressedKeyHash(bool enable) = 0;
+  virtual void SetPattern(std::vector<uint16_t> &table) = 0;
+  virtual void SetBech32Mask(std::vector<uint32_t> &table) = 0;
+  virtual void SetFoldPattern(std::vector<uint16_t> &table) = 0;
+  virtual bool Launch(std::vector<ITEM> &prefixFound,bool spinWait=false) = 0;
+  // Results of the oldest queued launch without queuing a new one, used to
+  // collect the items of the previous keys before SetKeys()
+  virtual bool Drain(std::vector<ITEM> &prefixFound) = 0;
+  virtual int GetNbPending() = 0;
+  virtual int GetNbThread() = 0;
+  virtual int GetGroupSize() = 0;
+  virtual uint64_t GetLostCount() = 0;
+  virtual bool Check(Secp256K1 *secp) = 0;
+
+  // Clear the search tables and the queued kernels so that the engine can be used for another search
+  virtual bool Reset() = 0;
+
+  std::string deviceName;
+
+  // Create an engine of the given backend, NULL if the backend is not compiled
+  static GPUDevice *Create(int backend,int nbThreadGroup,int nbThreadPerGroup,int gpuId,uint32_t maxFound,bool rekey);
+
+  // Engine pool (daemon): when enabled, released engines are kept warm and Acquire()
+  // returns an idle engine created with the same parameters instead of a new one
+  static void SetPooling(bool enable);
+  static GPUDevice *Acquire(int backend,int nbThreadGroup,int nbThreadPerGroup,int gpuId,uint32_t maxFound,bool rekey);
+  static void Release(GPUDevice *g);
+
+  // Backend wide functions, called before the engines are created
+  static void PrintDeviceInfo(int backend);
+  static bool GetDeviceInfo(int backend,int gpuId,std::string &key,int *nbMP,int *maxThreadPerGroup);
+  static void InitGroupTable(int backend,Secp256K1 *secp);
+  static void SetSyncMode(int backend,int mode);
+  static void SetKernelMode(int backend,int mode);
+  // False when the kernel of the given mode is not compiled in the backend
+  static bool HasKernelMode(int backend,int mode);
+  // Keys per group of the next engines, call InitGroupTable() after it
+  static void SetGroupSize(int backend,int size);
+
+  // Host memory read directly by all the devices of the backend, NULL on failure
+  static void *HostAlloc(int backend,uint64_t size);
+  static void HostFree(int backend,void *p);
+
+protected:
+
+  std::string config; // Creation parameters (engine pool)
+
+};
+
+#endif // GPUDEVICEH
@@ -21,13 +21,19 @@
 #endif
 
 #include "GPUEngine.h"
+#ifdef WITHHIP
+#include "GPUHip.h"
+#else
 #include <cuda.h>
 #include <cuda_runtime.h>
+#endif
 
 #include <stdint.h>
 #include "../hash/sha256.h"
 #include "../hash/ripemd160.h"
 #include "../Timer.h"
+#include "../Wildcard.h"
+#include "../Profile.h"
 
 #include "GPUGroup.h"
 #include "GPUMath.h"
@@ -38,43 +44,244 @@
 
 // ---------------------------------------------------------------------------------------
 
-__global__ void comp_keys(uint32_t mode,prefix_t *prefix, uint32_t *lookup32, uint64_t *keys, uint32_t maxFound, uint32_t *found) {
+template<int mode, int type, int lookup, int grp>
+__global__ void comp_keys(prefix_t *prefix, uint32_t *lookup32, uint64_t *keys, uint32_t maxFound, uint32_t *found) {
 
   int xPtr = (blockIdx.x*blockDim.x) * 8;
   int yPtr = xPtr + 4 * blockDim.x;
-  ComputeKeys(mode, keys + xPtr, keys + yPtr, prefix, lookup32, maxFound, found);
+  ComputeKeys<mode, type, lookup, GPU_KERNEL_THREAD, grp>(keys + xPtr, keys + yPtr, prefix, lookup32, maxFound, found);
 
 }
 
-__global__ void comp_keys_p2sh(uint32_t mode, prefix_t *prefix, uint32_t *lookup32, uint64_t *keys, uint32_t maxFound, uint32_t *found) {
+#ifdef GPU_BLOCK_KERNEL
+
+template<int mode, int type, int lookup, int grp>
+__global__ void comp_keys_block(prefix_t *prefix, uint32_t *lookup32, uint64_t *keys, uint32_t maxFound, uint32_t *found) {
+
+  // Stage the generator table in shared memory (32KB at 1024), sInv holds the warp products
+  __shared__ uint64_t sGx[grp / 2][4];
+  __shared__ uint64_t sGy[grp / 2][4];
+  __shared__ uint64_t sInv[2 * 32 * 4];
+  for (uint32_t i = threadIdx.x; i < grp / 2; i += blockDim.x) {
+    Load256(sGx[i], Gx[i]);
+    Load256(sGy[i], Gy[i]);
+  }
+  __syncthreads();
 
   int xPtr = (blockIdx.x*blockDim.x) * 8;
   int yPtr = xPtr + 4 * blockDim.x;
-  ComputeKeysP2SH(mode, keys + xPtr, keys + yPtr, prefix, lookup32, maxFound, found);
+  ComputeKeys<mode, type, lookup, GPU_KERNEL_BLOCK, grp>(keys + xPtr, keys + yPtr, prefix, lookup32, maxFound, found, sGx, sGy, sInv);
 
 }
 
+#endif // GPU_BLOCK_KERNEL
+
+template<int lookup, int grp>
 __global__ void comp_keys_comp(prefix_t *prefix, uint32_t *lookup32, uint64_t *keys, uint32_t maxFound, uint32_t *found) {
 
   int xPtr = (blockIdx.x*blockDim.x) * 8;
   int yPtr = xPtr + 4 * blockDim.x;
-  ComputeKeysComp(keys + xPtr, keys + yPtr, prefix, lookup32, maxFound, found);
+  ComputeKeysComp<lookup, grp>(keys + xPtr, keys + yPtr, prefix, lookup32, maxFound, found);
 
 }
 
-__global__ void comp_keys_pattern(uint32_t mode, prefix_t *pattern, uint64_t *keys,  uint32_t maxFound, uint32_t *found) {
+__global__ void setup_keys(uint64_t *table, uint32_t nbBit, uint64_t *keys) {
 
   int xPtr = (blockIdx.x*blockDim.x) * 8;
   int yPtr = xPtr + 4 * blockDim.x;
-  ComputeKeys(mode, keys + xPtr, keys + yPtr, NULL, (uint32_t *)pattern, maxFound, found);
+  uint32_t tid = (blockIdx.x*blockDim.x) + threadIdx.x;
+  ComputeStartKey(table, nbBit, tid, keys + xPtr, keys + yPtr);
 
 }
 
-__global__ void comp_keys_p2sh_pattern(uint32_t mode, prefix_t *pattern, uint64_t *keys, uint32_t maxFound, uint32_t *found) {
+template<int mode, int type, int grp>
+__global__ void comp_keys_pattern(uint16_t *pattern, uint32_t sharedSize, uint64_t *keys, uint32_t maxFound, uint32_t *found) {
+
+  // Load the pattern automaton in shared memory when it fits
+  extern __shared__ uint16_t sPattern[];
+  if (sharedSize) {
+    for (uint32_t i = threadIdx.x; i < sharedSize; i += blockDim.x)
+      sPattern[i] = pattern[i];
+    pattern = sPattern;
+    __syncthreads();
+  }
 
   int xPtr = (blockIdx.x*blockDim.x) * 8;
   int yPtr = xPtr + 4 * blockDim.x;
-  ComputeKeysP2SH(mode, keys + xPtr, keys + yPtr, NULL, (uint32_t *)pattern, maxFound, found);
+  ComputeKeys<mode, type, LOOKUP_PATTERN, GPU_KERNEL_THREAD, grp>(keys + xPtr, keys + yPtr, NULL, (uint32_t *)pattern, maxFound, found);
+
+}
+
+// ---------------------------------------------------------------------------------------
+// Kernel instantiation for the search mode and address type (BECH32 uses the P2PKH hash160,
+// P2PKH_P2SH checks the P2PKH and the P2SH hash160 of each point), and the group size
+
+#ifdef GPU_BLOCK_KERNEL
+#define LAUNCH_KEYS(_mode,_type) \
+  if (kernel == GPU_KERNEL_BLOCK) \
+    comp_keys_block<_mode, _type, lookup, grp> << < grid, block, 0, stream >> > (prefix, lookup32, keys, maxFound, out); \
+  else \
+    comp_keys<_mode, _type, lookup, grp> << < grid, block, 0, stream >> > (prefix, lookup32, keys, maxFound, out)
+#else
+#define LAUNCH_KEYS(_mode,_type) \
+  comp_keys<_mode, _type, lookup, grp> << < grid, block, 0, stream >> > (prefix, lookup32, keys, maxFound, out)
+#endif
+
+template<int lookup, int grp>
+void launchKeys(int kernel, uint32_t mode, uint32_t type, dim3 grid, dim3 block, cudaStream_t stream,
+                prefix_t *prefix, uint32_t *lookup32, uint64_t *keys, uint32_t maxFound, uint32_t *out) {
+
+  if (type == P2SH) {
+    switch (mode) {
+    case SEARCH_COMPRESSED:
+      LAUNCH_KEYS(SEARCH_COMPRESSED, P2SH);
+      break;
+    case SEARCH_UNCOMPRESSED:
+      LAUNCH_KEYS(SEARCH_UNCOMPRESSED, P2SH);
+      break;
+    case SEARCH_BOTH:
+      LAUNCH_KEYS(SEARCH_BOTH, P2SH);
+      break;
+    }
+  } else if (type == P2PKH_P2SH) {
+    switch (mode) {
+    case SEARCH_COMPRESSED:
+      LAUNCH_KEYS(SEARCH_COMPRESSED, P2PKH_P2SH);
+      break;
+    case SEARCH_UNCOMPRESSED:
+      LAUNCH_KEYS(SEARCH_UNCOMPRESSED, P2PKH_P2SH);
+      break;
+    case SEARCH_BOTH:
+      LAUNCH_KEYS(SEARCH_BOTH, P2PKH_P2SH);
+      break;
+    }
+  } else {
+    switch (mode) {
+    case SEARCH_COMPRESSED:
+      if (kernel == GPU_KERNEL_BLOCK) {
+        LAUNCH_KEYS(SEARCH_COMPRESSED, P2PKH);
+      } else {
+        comp_keys_comp<lookup, grp> << < grid, block, 0, stream >> > (prefix, lookup32, keys, maxFound, out);
+      }
+      break;
+    case SEARCH_UNCOMPRESSED:
+      LAUNCH_KEYS(SEARCH_UNCOMPRESSED, P2PKH);
+      break;
+    case SEARCH_BOTH:
+      LAUNCH_KEYS(SEARCH_BOTH, P2PKH);
+      break;
+    }
+  }
+
+}
+
+#define LAUNCH_PATTERN(_mode,_type) \
+  comp_keys_pattern<_mode, _type, grp> << < grid, block, sharedSize * 2, stream >> > (pattern, sharedSize, keys, maxFound, out)
+
+template<int grp>
+void launchPattern(uint32_t mode, uint32_t type, dim3 grid, dim3 block, cudaStream_t stream,
+                   uint16_t *pattern, uint32_t sharedSize, uint64_t *keys, uint32_t maxFound, uint32_t *out) {
+
+  if (type == P2SH) {
+    switch (mode) {
+    case SEARCH_COMPRESSED:
+      LAUNCH_PATTERN(SEARCH_COMPRESSED, P2SH);
+      break;
+    case SEARCH_UNCOMPRESSED:
+      LAUNCH_PATTERN(SEARCH_UNCOMPRESSED, P2SH);
+      break;
+    case SEARCH_BOTH:
+      LAUNCH_PATTERN(SEARCH_BOTH, P2SH);
+      break;
+    }
+  } else {
+    switch (mode) {
+    case SEARCH_COMPRESSED:
+      LAUNCH_PATTERN(SEARCH_COMPRESSED, P2PKH);
+      break;
+    case SEARCH_UNCOMPRESSED:
+      LAUNCH_PATTERN(SEARCH_UNCOMPRESSED, P2PKH);
+      break;
+    case SEARCH_BOTH:
+      LAUNCH_PATTERN(SEARCH_BOTH, P2PKH);
+      break;
+    }
+  }
+
+}
+
+// Group size (runtime) to kernel instantiation
+
+template<int lookup>
+void launchKeys(int grpSize, int kernel, uint32_t mode, uint32_t type, dim3 grid, dim3 block, cudaStream_t stream,
+                prefix_t *prefix, uint32_t *lookup32, uint64_t *keys, uint32_t maxFound, uint32_t *out) {
+
+  switch (grpSize) {
+  case 256:
+    launchKeys<lookup, 256>(kernel, mode, type, grid, block, stream, prefix, lookup32, keys, maxFound, out);
+    break;
+  case 512:
+    launchKeys<lookup, 512>(kernel, mode, type, grid, block, stream, prefix, lookup32, keys, maxFound, out);
+    break;
+  default:
+    launchKeys<lookup, 1024>(kernel, mode, type, grid, block, stream, prefix, lookup32, keys, maxFound, out);
+    break;
+  }
+
+}
+
+void launchPattern(int grpSize, uint32_t mode, uint32_t type, dim3 grid, dim3 block, cudaStream_t stream,
+                   uint16_t *pattern, uint32_t sharedSize, uint64_t *keys, uint32_t maxFound, uint32_t *out) {
+
+  switch (grpSize) {
+  case 256:
+    launchPattern<256>(mode, type, grid, block, stream, pattern, sharedSize, keys, maxFound, out);
+    break;
+  case 512:
+    launchPattern<512>(mode, type, grid, block, stream, pattern, sharedSize, keys, maxFound, out);
+    break;
+  default:
+    launchPattern<1024>(mode, type, grid, block, stream, pattern, sharedSize, keys, maxFound, out);
+    break;
+  }
+
+}
+
+template<int grp>
+void setPatternCacheConfig() {
+
+  cudaFuncSetCacheConfig(comp_keys_pattern<SEARCH_COMPRESSED, P2PKH, grp>, cudaFuncCachePreferShared);
+  cudaFuncSetCacheConfig(comp_keys_pattern<SEARCH_UNCOMPRESSED, P2PKH, grp>, cudaFuncCachePreferShared);
+  cudaFuncSetCacheConfig(comp_keys_pattern<SEARCH_BOTH, P2PKH, grp>, cudaFuncCachePreferShared);
+  cudaFuncSetCacheConfig(comp_keys_pattern<SEARCH_COMPRESSED, P2SH, grp>, cudaFuncCachePreferShared);
+  cudaFuncSetCacheConfig(comp_keys_pattern<SEARCH_UNCOMPRESSED, P2SH, grp>, cudaFuncCachePreferShared);
+  cudaFuncSetCacheConfig(comp_keys_pattern<SEARCH_BOTH, P2SH, grp>, cudaFuncCachePreferShared);
+
+}
+
+// Register usage of the search kernels may limit the block size
+template<int grp>
+int getMaxThread(int maxThread, int kernel) {
+
+  cudaFuncAttributes attr;
+  if (cudaFuncGetAttributes(&attr, comp_keys<SEARCH_BOTH, P2PKH, LOOKUP32, grp>) == cudaSuccess && attr.maxThreadsPerBlock < maxThread)
+    maxThread = attr.maxThreadsPerBlock;
+  if (cudaFuncGetAttributes(&attr, comp_keys<SEARCH_BOTH, P2SH, LOOKUP32, grp>) == cudaSuccess && attr.maxThreadsPerBlock < maxThread)
+    maxThread = attr.maxThreadsPerBlock;
+  if (cudaFuncGetAttributes(&attr, comp_keys<SEARCH_BOTH, P2PKH_P2SH, LOOKUP32, grp>) == cudaSuccess && attr.maxThreadsPerBlock < maxThread)
+    maxThread = attr.maxThreadsPerBlock;
+  if (cudaFuncGetAttributes(&attr, comp_keys_comp<LOOKUP32, grp>) == cudaSuccess && attr.maxThreadsPerBlock < maxThread)
+    maxThread = attr.maxThreadsPerBlock;
+#ifdef GPU_BLOCK_KERNEL
+  if (kernel == GPU_KERNEL_BLOCK) {
+    if (cudaFuncGetAttributes(&attr, comp_keys_block<SEARCH_BOTH, P2PKH, LOOKUP32, grp>) == cudaSuccess && attr.maxThreadsPerBlock < maxThread)
+      maxThread = attr.maxThreadsPerBlock;
+    if (cudaFuncGetAttributes(&attr, comp_keys_block<SEARCH_BOTH, P2PKH_P2SH, LOOKUP32, grp>) == cudaSuccess && attr.maxThreadsPerBlock < maxThread)
+      maxThread = attr.maxThreadsPerBlock;
+    maxThread &= ~31; // Whole warps
+  }
+#endif
+  return maxThread;
 
 }
 
@@ -130,6 +337,11 @@ std::string toHex(unsigned char *data, int length) {
 
 int _ConvertSMVer2Cores(int major, int minor) {
 
+#ifdef WITHHIP
+  // 64 stream processors per AMD compute unit
+  return 64;
+#endif
+
   // Defines for GPU Architecture types (using the SM version to determine
   // the # of cores per SM
   typedef struct {
@@ -177,6 +389,9 @@ GPUEngine::GPUEngine(int nbThreadGroup, int nbThreadPerGroup, int gpuId, uint32_
   // Initialise CUDA
   this->rekey = rekey;
   this->nbThreadPerGroup = nbThreadPerGroup;
+  this->gpuId = gpuId;
+  this->kernel = kernelMode;
+  this->grpSize = groupSize;
   initialised = false;
   cudaError_t err;
 
@@ -200,15 +415,37 @@ GPUEngine::GPUEngine(int nbThreadGroup, int nbThreadPerGroup, int gpuId, uint32_
     return;
   }
 
+  if (syncMode != GPU_SYNC_POLL) {
+    // Fails when the device context already exists (another engine),
+    // blocking sync events still make the host thread sleep
+    err = cudaSetDeviceFlags(syncMode == GPU_SYNC_BLOCK ? cudaDeviceScheduleBlockingSync : cudaDeviceScheduleSpin);
+    if (err != cudaSuccess)
+      cudaGetLastError();
+  }
+
   cudaDeviceProp deviceProp;
   cudaGetDeviceProperties(&deviceProp, gpuId);
 
   if (nbThreadGroup == -1)
     nbThreadGroup = deviceProp.multiProcessorCount * 8;
 
+  if (!HasKernelMode(kernel)) {
+    printf("GPUEngine: Warning, block kernel not compiled (needs CUDA 9 or above, not available with HIP), using thread kernel\n");
+    kernel = GPU_KERNEL_THREAD;
+  }
+  if (kernel == GPU_KERNEL_BLOCK && (nbThreadPerGroup % 32) != 0) {
+    printf("GPUEngine: Warning, block kernel needs a multiple of 32 threads per group, using thread kernel\n");
+    kernel = GPU_KERNEL_THREAD;
+  }
+  if (kernel == GPU_KERNEL_BLOCK && deviceProp.major < 3) {
+    printf("GPUEngine: Warning, block kernel needs compute capability 3.0 or above, using thread kernel\n");
+    kernel = GPU_KERNEL_THREAD;
+  }
+
   this->nbThread = nbThreadGroup * nbThreadPerGroup;
   this->maxFound = maxFound;
   this->outputSize = (maxFound*ITEM_SIZE + 4);
+  this->nbLost = 0;
 
   char tmp[512];
   sprintf(tmp,"GPU #%d %s (%dx%d cores) Grid(%dx%d)",
@@ -217,8 +454,26 @@ GPUEngine::GPUEngine(int nbThreadGroup, int nbThreadPerGroup, int gpuId, uint32_
                       nbThread / nbThreadPerGroup,
                       nbThreadPerGroup);
   deviceName = std::string(tmp);
+  if (kernel == GPU_KERNEL_BLOCK)
+    deviceName.append(" [Block]");
 
-  // Prefer L1 (We do not use __shared__ at all)
+  // Generator table
+  if (groupTable == NULL) {
+    printf("GPUEngine: Generator table not initialised\n");
+    return;
+  }
+  grpSize = groupTable->GetSize();
+  uint64_t *gx = new uint64_t[grpSize * 2];
+  uint64_t *gy = new uint64_t[grpSize * 2];
+  groupTable->GetC64(gx, gy);
+  cudaMemcpyToSymbol(Gx, gx, grpSize * 16);
+  cudaMemcpyToSymbol(Gy, gy, grpSize * 16);
+  cudaMemcpyToSymbol(_2Gnx, groupTable->_2Gn.x.bits64, 32);
+  cudaMemcpyToSymbol(_2Gny, groupTable->_2Gn.y.bits64, 32);
+  delete[] gx;
+  delete[] gy;
+
+  // Prefer L1 (Only the pattern kernels use __shared__)
   err = cudaDeviceSetCacheConfig(cudaFuncCachePreferL1);
   if (err != cudaSuccess) {
     printf("GPUEngine: %s\n", cudaGetErrorString(err));
@@ -268,28 +523,138 @@ GPUEngine::GPUEngine(int nbThreadGroup, int nbThreadPerGroup, int gpuId, uint32_
     printf("GPUEngine: Allocate input pinned memory: %s\n", cudaGetErrorString(err));
     return;
   }
-  err = cudaMalloc((void **)&outputPrefix, outputSize);
-  if (err != cudaSuccess) {
-    printf("GPUEngine: Allocate output memory: %s\n", cudaGetErrorString(err));
-    return;
+  inputKeyTable = NULL;
+  if (rekey) {
+    err = cudaMalloc((void **)&inputKeyTable, KEY_TABLE_SIZE * 32 * 2);
+    if (err != cudaSuccess) {
+      printf("GPUEngine: Allocate key table memory: %s\n", cudaGetErrorString(err));
+      return;
+    }
+  }
+  for (int i = 0; i < NB_OUTPUT_BUFFER; i++) {
+    err = cudaMalloc((void **)&outputPrefix[i], outputSize);
+    if (err != cudaSuccess) {
+      printf("GPUEngine: Allocate output memory: %s\n", cudaGetErrorString(err));
+      return;
+    }
+    err = cudaHostAlloc(&outputPrefixPinned[i], outputSize, cudaHostAllocMapped);
+    if (err != cudaSuccess) {
+      printf("GPUEngine: Allocate output pinned memory: %s\n", cudaGetErrorString(err));
+      return;
+    }
+    err = cudaEventCreateWithFlags(&outputEvent[i], cudaEventDisableTiming | (syncMode == GPU_SYNC_BLOCK ? cudaEventBlockingSync : 0));
+    if (err != cudaSuccess) {
+      printf("GPUEngine: Create output event: %s\n", cudaGetErrorString(err));
+      return;
+    }
+    // Starting keys of the kernel call, to run it again when its output overflows
+    err = cudaMalloc((void **)&inputKeyBackup[i], nbThread * 32 * 2);
+    if (err != cudaSuccess) {
+      printf("GPUEngine: Allocate key backup memory: %s (items may be lost)\n", cudaGetErrorString(err));
+      cudaGetLastError();
+      inputKeyBackup[i] = NULL;
+    }
   }
-  err = cudaHostAlloc(&outputPrefixPinned, outputSize, cudaHostAllocMapped);
+  spillPrefix = NULL;
+  spillPrefixPinned = NULL;
+  spillSize = 0;
+
+  // Kernels and result counters go to computeStream, found items are
+  // read back on copyStream so they do not wait for the queued kernels.
+  err = cudaStreamCreateWithFlags(&computeStream, cudaStreamNonBlocking);
+  if (err == cudaSuccess)
+    err = cudaStreamCreateWithFlags(&copyStream, cudaStreamNonBlocking);
   if (err != cudaSuccess) {
-    printf("GPUEngine: Allocate output pinned memory: %s\n", cudaGetErrorString(err));
+    printf("GPUEngine: Create stream: %s\n", cudaGetErrorString(err));
     return;
   }
+  nbPending = 0;
+  currentOutput = 0;
 
   searchMode = SEARCH_COMPRESSED;
   searchType = P2PKH;
   initialised = true;
-  pattern = "";
+  inputPattern = NULL;
+  patternShared = 0;
   hasPattern = false;
+  hasRange = false;
+  hasMask = false;
   inputPrefixLookUp = NULL;
 
 }
 
+GroupTable *GPUEngine::groupTable = NULL;
+int GPUEngine::syncMode = GPU_SYNC_POLL;
+int GPUEngine::kernelMode = GPU_KERNEL_THREAD;
+int GPUEngine::groupSize = GRP_SIZE;
+
+void GPUEngine::SetSyncMode(int mode) {
+  syncMode = mode;
+}
+
+void GPUEngine::SetKernelMode(int mode) {
+  kernelMode = mode;
+}
+
+bool GPUEngine::HasKernelMode(int mode) {
+#ifdef GPU_BLOCK_KERNEL
+  return true;
+#else
+  return mode != GPU_KERNEL_BLOCK;
+#endif
+}
+
+void GPUEngine::SetGroupSize(int size) {
+  groupSize = size;
+}
+
+void GPUEngine::InitGroupTable(Secp256K1 *secp) {
+
+  // Built again when the group size changes, the engines keep their device copy
+  if (groupTable == NULL || groupTable->GetSize() != groupSize) {
+    if (groupTable == NULL)
+      groupTable = new GroupTable();
+    groupTable->Init(secp, groupSize);
+  }
+
+}
+
 int GPUEngine::GetGroupSize() {
-  return GRP_SIZE;
+  return grpSize;
+}
+
+bool GPUEngine::GetDeviceInfo(int gpuId, std::string &key, int *nbMP, int *maxThreadPerGroup) {
+
+  cudaError_t err = cudaSetDevice(gpuId);
+  if (err != cudaSuccess) {
+    printf("GPUEngine: %s\n", cudaGetErrorString(err));
+    return false;
+  }
+
+  cudaDeviceProp deviceProp;
+  cudaGetDeviceProperties(&deviceProp, gpuId);
+
+  char tmp[512];
+  sprintf(tmp, "%s (Cap %d.%d)", deviceProp.name, deviceProp.major, deviceProp.minor);
+  key = std::string(tmp);
+  *nbMP = deviceProp.multiProcessorCount;
+
+  int maxThread = deviceProp.maxThreadsPerBlock;
+  switch (groupSize) {
+  case 256:
+    maxThread = getMaxThread<256>(maxThread, kernelMode);
+    break;
+  case 512:
+    maxThread = getMaxThread<512>(maxThread, kernelMode);
+    break;
+  default:
+    maxThread = getMaxThread<1024>(maxThread, kernelMode);
+    break;
+  }
+  *maxThreadPerGroup = maxThread;
+
+  return true;
+
 }
 
 void GPUEngine::PrintCudaInfo() {
@@ -342,11 +707,24 @@ void GPUEngine::PrintCudaInfo() {
 
 GPUEngine::~GPUEngine() {
 
+  cudaStreamSynchronize(computeStream);
   cudaFree(inputKey);
+  if(inputKeyPinned) cudaFreeHost(inputKeyPinned);
+  if(inputKeyTable) cudaFree(inputKeyTable);
   cudaFree(inputPrefix);
+  if(inputPrefixPinned) cudaFreeHost(inputPrefixPinned);
   if(inputPrefixLookUp) cudaFree(inputPrefixLookUp);
-  cudaFreeHost(outputPrefixPinned);
-  cudaFree(outputPrefix);
+  if(inputPattern) cudaFree(inputPattern);
+  for (int i = 0; i < NB_OUTPUT_BUFFER; i++) {
+    cudaFreeHost(outputPrefixPinned[i]);
+    cudaFree(outputPrefix[i]);
+    if(inputKeyBackup[i]) cudaFree(inputKeyBackup[i]);
+    cudaEventDestroy(outputEvent[i]);
+  }
+  if(spillPrefix) cudaFree(spillPrefix);
+  if(spillPrefixPinned) cudaFreeHost(spillPrefixPinned);
+  cudaStreamDestroy(computeStream);
+  cudaStreamDestroy(copyStream);
 
 }
 
@@ -354,6 +732,68 @@ int GPUEngine::GetNbThread() {
   return nbThread;
 }
 
+uint64_t GPUEngine::GetLostCount() {
+  return nbLost;
+}
+
+bool GPUEngine::Reset() {
+
+  if (!initialised)
+    return false;
+
+  // The engine may be reused by another host thread
+  cudaError_t err = cudaSetDevice(gpuId);
+  if (err != cudaSuccess) {
+    printf("GPUEngine: Reset: %s\n", cudaGetErrorString(err));
+    return false;
+  }
+
+  // Drop the queued kernels, the pending copies and the tables of the previous search
+  cudaStreamSynchronize(computeStream);
+  cudaStreamSynchronize(copyStream);
+  nbPending = 0;
+  currentOutput = 0;
+  if (inputPrefixLookUp) cudaFree(inputPrefixLookUp);
+  if (inputPattern) cudaFree(inputPattern);
+  inputPrefixLookUp = NULL;
+  inputPattern = NULL;
+  patternShared = 0;
+  hasPattern = false;
+  hasRange = false;
+  hasMask = false;
+  nbLost = 0;
+  uint32_t zero = 0;
+  cudaMemcpyToSymbol(_foldPattern, &inputPattern, sizeof(uint16_t *));
+  cudaMemcpyToSymbol(_bloomMask, &zero, 4);
+  SetUncompressedKeyHash(true);
+
+  // Pinned inputs released by SetPattern(), SetBech32Mask() or SetKeys()
+  if (inputPrefixPinned == NULL) {
+    err = cudaHostAlloc(&inputPrefixPinned, _64K * 2, cudaHostAllocWriteCombined | cudaHostAllocMapped);
+    if (err != cudaSuccess) {
+      printf("GPUEngine: Allocate prefix pinned memory: %s\n", cudaGetErrorString(err));
+      inputPrefixPinned = NULL;
+      return false;
+    }
+  }
+  if (inputKeyPinned == NULL) {
+    err = cudaHostAlloc(&inputKeyPinned, nbThread * 32 * 2, cudaHostAllocWriteCombined | cudaHostAllocMapped);
+    if (err != cudaSuccess) {
+      printf("GPUEngine: Allocate input pinned memory: %s\n", cudaGetErrorString(err));
+      inputKeyPinned = NULL;
+      return false;
+    }
+  }
+
+  err = cudaGetLastError();
+  if (err != cudaSuccess) {
+    printf("GPUEngine: Reset: %s\n", cudaGetErrorString(err));
+    return false;
+  }
+  return true;
+
+}
+
 void GPUEngine::SetSearchMode(int searchMode) {
   this->searchMode = searchMode;
 }
@@ -362,18 +802,19 @@ void GPUEngine::SetSearchType(int searchType) {
   this->searchType = searchType;
 }
 
+void GPUEngine::SetUncompressedKeyHash(bool enable) {
+  uint32_t v = enable ? 1 : 0;
+  cudaMemcpyToSymbol(_uncompKeyHash, &v, 4);
+}
+
 void GPUEngine::SetPrefix(std::vector<prefix_t> prefixes) {
 
   memset(inputPrefixPinned, 0, _64K * 2);
   for(int i=0;i<(int)prefixes.size();i++)
     inputPrefixPinned[prefixes[i]]=1;
 
-  // Fill device memory
+  // Fill device memory, the pinned copy is kept for DisablePrefix()
   cudaMemcpy(inputPrefix, inputPrefixPinned, _64K * 2, cudaMemcpyHostToDevice);
-
-  // We do not need the input pinned memory anymore
-  cudaFreeHost(inputPrefixPinned);
-  inputPrefixPinned = NULL;
   lostWarning = false;
 
   cudaError_t err = cudaGetLastError();
@@ -383,19 +824,58 @@ void GPUEngine::SetPrefix(std::vector<prefix_t> prefixes) {
 
 }
 
-void GPUEngine::SetPattern(const char *pattern) {
+void GPUEngine::DisablePrefix(std::vector<prefix_t> &prefixes) {
 
-  strcpy((char *)inputPrefixPinned,pattern);
+  if (inputPrefixPinned == NULL || prefixes.size() == 0)
+    return;
 
-  // Fill device memory
-  cudaMemcpy(inputPrefix, inputPrefixPinned, _64K * 2, cudaMemcpyHostToDevice);
+  // Entries only go to 0, so a copy still reading the pinned
+  // table while it is modified uploads a valid table
+  for (int i = 0; i < (int)prefixes.size(); i++)
+    inputPrefixPinned[prefixes[i]] = 0;
+
+  // Queued after the pending kernels, the host does not wait
+  cudaMemcpyAsync(inputPrefix, inputPrefixPinned, _64K * 2, cudaMemcpyHostToDevice, computeStream);
+
+  cudaError_t err = cudaGetLastError();
+  if (err != cudaSuccess) {
+    printf("GPUEngine: DisablePrefix: %s\n", cudaGetErrorString(err));
+  }
+
+}
+
+void GPUEngine::SetPattern(std::vector<uint16_t> &table) {
+
+  // Pattern automaton
+  cudaError_t err = cudaMalloc((void **)&inputPattern, table.size() * 2);
+  if (err != cudaSuccess) {
+    printf("GPUEngine: Allocate pattern memory: %s\n", cudaGetErrorString(err));
+    return;
+  }
+  cudaMemcpy(inputPattern, table.data(), table.size() * 2, cudaMemcpyHostToDevice);
+
+  // Small automatons are copied in shared memory by each block
+  if (table.size() * 2 <= MAX_SHARED_PATTERN) {
+    patternShared = (uint32_t)table.size();
+    switch (grpSize) {
+    case 256:
+      setPatternCacheConfig<256>();
+      break;
+    case 512:
+      setPatternCacheConfig<512>();
+      break;
+    default:
+      setPatternCacheConfig<1024>();
+      break;
+    }
+  }
 
   // We do not need the input pinned memory anymore
   cudaFreeHost(inputPrefixPinned);
   inputPrefixPinned = NULL;
   lostWarning = false;
 
-  cudaError_t err = cudaGetLastError();
+  err = cudaGetLastError();
   if (err != cudaSuccess) {
     printf("GPUEngine: SetPattern: %s\n", cudaGetErrorString(err));
   }
@@ -404,48 +884,101 @@ void GPUEngine::SetPattern(const char *pattern) {
 
 }
 
-void GPUEngine::SetPrefix(std::vector<LPREFIX> prefixes, uint32_t totalPrefix) {
+void GPUEngine::SetFoldPattern(std::vector<uint16_t> &table) {
 
-  // Allocate memory for the second level of lookup tables
-  cudaError_t err = cudaMalloc((void **)&inputPrefixLookUp, (_64K+totalPrefix) * 4);
+  // Case folded automaton, checked after the 16 bits or hash160 interval lookup
+  cudaError_t err = cudaMalloc((void **)&inputPattern, table.size() * 2);
   if (err != cudaSuccess) {
-    printf("GPUEngine: Allocate prefix lookup memory: %s\n", cudaGetErrorString(err));
+    printf("GPUEngine: Allocate pattern memory: %s\n", cudaGetErrorString(err));
+    inputPattern = NULL;
     return;
   }
-  err = cudaHostAlloc(&inputPrefixLookUpPinned, (_64K+totalPrefix) * 4, cudaHostAllocWriteCombined | cudaHostAllocMapped);
+  cudaMemcpy(inputPattern, table.data(), table.size() * 2, cudaMemcpyHostToDevice);
+  cudaMemcpyToSymbol(_foldPattern, &inputPattern, sizeof(uint16_t *));
+
+  err = cudaGetLastError();
   if (err != cudaSuccess) {
-    printf("GPUEngine: Allocate prefix lookup pinned memory: %s\n", cudaGetErrorString(err));
-    return;
+    printf("GPUEngine: SetFoldPattern: %s\n", cudaGetErrorString(err));
   }
 
-  uint32_t offset = _64K;
-  memset(inputPrefixPinned, 0, _64K * 2);
-  memset(inputPrefixLookUpPinned, 0, _64K * 4);
-  for (int i = 0; i < (int)prefixes.size(); i++) {
-    int nbLPrefix = (int)prefixes[i].lPrefixes.size();
-    inputPrefixPinned[prefixes[i].sPrefix] = (uint16_t)nbLPrefix;
-    inputPrefixLookUpPinned[prefixes[i].sPrefix] = offset;
-    for (int j = 0; j < nbLPrefix; j++) {
-      inputPrefixLookUpPinned[offset++]=prefixes[i].lPrefixes[j];
-    }
-  }
+}
+
+void GPUEngine::SetBech32Mask(std::vector<uint32_t> &table) {
 
-  if (offset != (_64K+totalPrefix)) {
-    printf("GPUEngine: Wrong totalPrefix %d!=%d!\n",offset- _64K, totalPrefix);
+  // Bech32 masks, checked in the key loop instead of the prefix lookup
+  cudaError_t err = cudaMalloc((void **)&inputPrefixLookUp, table.size() * 4);
+  if (err != cudaSuccess) {
+    printf("GPUEngine: Allocate mask memory: %s\n", cudaGetErrorString(err));
+    inputPrefixLookUp = NULL;
     return;
   }
-
-  // Fill device memory
-  cudaMemcpy(inputPrefix, inputPrefixPinned, _64K * 2, cudaMemcpyHostToDevice);
-  cudaMemcpy(inputPrefixLookUp, inputPrefixLookUpPinned, (_64K+totalPrefix) * 4, cudaMemcpyHostToDevice);
+  cudaMemcpy(inputPrefixLookUp, table.data(), table.size() * 4, cudaMemcpyHostToDevice);
 
   // We do not need the input pinned memory anymore
   cudaFreeHost(inputPrefixPinned);
   inputPrefixPinned = NULL;
-  cudaFreeHost(inputPrefixLookUpPinned);
-  inputPrefixLookUpPinned = NULL;
   lostWarning = false;
 
+  err = cudaGetLastError();
+  if (err != cudaSuccess) {
+    printf("GPUEngine: SetBech32Mask: %s\n", cudaGetErrorString(err));
+  }
+
+  hasMask = true;
+
+}
+
+void *GPUEngine::HostAlloc(uint64_t size) {
+
+  void *p;
+  cudaError_t err = cudaHostAlloc(&p, size, cudaHostAllocPortable);
+  if (err != cudaSuccess) {
+    printf("GPUEngine: Allocate pinned memory: %s\n", cudaGetErrorString(err));
+    cudaGetLastError();
+    return NULL;
+  }
+  return p;
+
+}
+
+void GPUEngine::HostFree(void *p) {
+
+  cudaFreeHost(p);
+
+}
+
+void GPUEngine::SetPrefix(GPUPrefixTable *table) {
+
+  // Device copy of the shared lookup tables, the Bloom filter is at the end
+  // of lookup32 and is dropped when the device memory is too small
+  uint64_t lookupSize = table->lookupSize;
+  uint32_t bloomMask = table->bloomMask;
+  cudaError_t err = cudaMalloc((void **)&inputPrefixLookUp, lookupSize);
+  if (err != cudaSuccess && bloomMask) {
+    printf("GPUEngine: Bloom filter disabled: %s\n", cudaGetErrorString(err));
+    cudaGetLastError();
+    bloomMask = 0;
+    lookupSize = (uint64_t)table->bloomOffset * 4;
+    err = cudaMalloc((void **)&inputPrefixLookUp, lookupSize);
+  }
+  if (err != cudaSuccess) {
+    printf("GPUEngine: Allocate prefix lookup memory: %s\n", cudaGetErrorString(err));
+    inputPrefixLookUp = NULL;
+    return;
+  }
+
+  if (!table->hasRange) {
+    cudaMemcpyToSymbol(_bloomOffset, &table->bloomOffset, 4);
+    cudaMemcpyToSymbol(_bloomMask, &bloomMask, 4);
+  }
+
+  // Fill device memory, the pinned lookup16 is kept for DisablePrefix()
+  memcpy(inputPrefixPinned, table->lookup16, _64K * 2);
+  cudaMemcpy(inputPrefix, inputPrefixPinned, _64K * 2, cudaMemcpyHostToDevice);
+  cudaMemcpy(inputPrefixLookUp, table->lookup32, lookupSize, cudaMemcpyHostToDevice);
+  lostWarning = false;
+  hasRange = table->hasRange;
+
   err = cudaGetLastError();
   if (err != cudaSuccess) {
     printf("GPUEngine: SetPrefix (large): %s\n", cudaGetErrorString(err));
@@ -453,48 +986,85 @@ void GPUEngine::SetPrefix(std::vector<LPREFIX> prefixes, uint32_t totalPrefix) {
 
 }
 
+bool GPUEngine::launchKernel(uint64_t *keys, uint32_t maxOut, uint32_t *out, cudaStream_t stream) {
+
+  dim3 grid(nbThread / nbThreadPerGroup);
+  dim3 block(nbThreadPerGroup);
+
+  // Call the kernel (Perform STEP_SIZE keys per thread)
+  if (hasMask) {
+    launchKeys<LOOKUP_MASK>(grpSize, kernel, searchMode, searchType, grid, block, stream, NULL, inputPrefixLookUp, keys, maxOut, out);
+  } else if (hasPattern) {
+    if (searchType == BECH32) {
+      // Bech32 patterns are searched with masks (SetBech32Mask), refused by VanitySearch otherwise
+      printf("GPUEngine: BECH32 patterns are only supported as masks\n");
+      return false;
+    }
+    launchPattern(grpSize, searchMode, searchType, grid, block, stream, inputPattern, patternShared, keys, maxOut, out);
+  } else if (hasRange) {
+    launchKeys<LOOKUP_RANGE>(grpSize, kernel, searchMode, searchType, grid, block, stream, inputPrefix, inputPrefixLookUp, keys, maxOut, out);
+  } else if (inputPrefixLookUp) {
+    launchKeys<LOOKUP32>(grpSize, kernel, searchMode, searchType, grid, block, stream, inputPrefix, inputPrefixLookUp, keys, maxOut, out);
+  } else {
+    launchKeys<LOOKUP16>(grpSize, kernel, searchMode, searchType, grid, block, stream, inputPrefix, inputPrefixLookUp, keys, maxOut, out);
+  }
+  return true;
+
+}
+
 bool GPUEngine::callKernel() {
 
+  // Kernel results go to the next free output buffer
+  int slot = (currentOutput + nbPending) % NB_OUTPUT_BUFFER;
+  uint32_t *out = outputPrefix[slot];
+
   // Reset nbFound
-  cudaMemset(outputPrefix,0,4);
+  cudaMemsetAsync(out, 0, 4, computeStream);
 
-  // Call the kernel (Perform STEP_SIZE keys per thread)
-  if (searchType == P2SH) {
+  // Keep the starting keys (the kernel updates them)
+  if (inputKeyBackup[slot])
+    cudaMemcpyAsync(inputKeyBackup[slot], inputKey, nbThread * 32 * 2, cudaMemcpyDeviceToDevice, computeStream);
 
-    if (hasPattern) {
-      comp_keys_p2sh_pattern << < nbThread / nbThreadPerGroup, nbThreadPerGroup >> >
-        (searchMode, inputPrefix, inputKey, maxFound, outputPrefix);
-    } else {
-      comp_keys_p2sh << < nbThread / nbThreadPerGroup, nbThreadPerGroup >> >
-        (searchMode, inputPrefix, inputPrefixLookUp, inputKey, maxFound, outputPrefix);
-    }
+  PROF_RANGE_PUSH("Kernel");
+  bool ok = launchKernel(inputKey, maxFound, out, computeStream);
+  PROF_RANGE_POP();
+  if (!ok)
+    return false;
+
+  // Get the number of item found as soon as the kernel ends
+  cudaMemcpyAsync(outputPrefixPinned[slot], out, 4, cudaMemcpyDeviceToHost, computeStream);
+  cudaEventRecord(outputEvent[slot], computeStream);
+  nbPending++;
+
+  cudaError_t err = cudaGetLastError();
+  if (err != cudaSuccess) {
+    printf("GPUEngine: Kernel: %s\n", cudaGetErrorString(err));
+    return false;
+  }
+  return true;
+
+}
+
+bool GPUEngine::waitOutput(int slot, bool spinWait) {
+
+  if (spinWait || syncMode != GPU_SYNC_POLL) {
+
+    // Spin, or sleep until the kernel ends with blocking sync events
+    cudaEventSynchronize(outputEvent[slot]);
 
   } else {
 
-    // P2PKH or BECH32
-    if (hasPattern) {
-      if (searchType == BECH32) {
-        // TODO
-        printf("GPUEngine: (TODO) BECH32 not yet supported with wildard\n");
-        return false;
-      }
-      comp_keys_pattern << < nbThread / nbThreadPerGroup, nbThreadPerGroup >> >
-        (searchMode, inputPrefix, inputKey, maxFound, outputPrefix);
-    } else {
-      if (searchMode == SEARCH_COMPRESSED) {
-        comp_keys_comp << < nbThread / nbThreadPerGroup, nbThreadPerGroup >> >
-          (inputPrefix, inputPrefixLookUp, inputKey, maxFound, outputPrefix);
-      } else {
-        comp_keys << < nbThread / nbThreadPerGroup, nbThreadPerGroup >> >
-          (searchMode, inputPrefix, inputPrefixLookUp, inputKey, maxFound, outputPrefix);
-      }
+    // Poll the event to avoid default spin wait which takes 100% CPU
+    while (cudaEventQuery(outputEvent[slot]) == cudaErrorNotReady) {
+      // Sleep 1 ms to free the CPU
+      Timer::SleepMillis(1);
     }
 
   }
 
   cudaError_t err = cudaGetLastError();
   if (err != cudaSuccess) {
-    printf("GPUEngine: Kernel: %s\n", cudaGetErrorString(err));
+    printf("GPUEngine: Launch: %s\n", cudaGetErrorString(err));
     return false;
   }
   return true;
@@ -521,8 +1091,15 @@ bool GPUEngine::SetKeys(Point *p) {
     }
   }
 
+  // The results of the kernels queued with the previous keys are collected
+  // by Drain() before, nothing is pending here unless the caller drops them
+  cudaStreamSynchronize(computeStream);
+  nbPending = 0;
+  currentOutput = 0;
+
   // Fill device memory
-  cudaMemcpy(inputKey, inputKeyPinned, nbThread*32*2, cudaMemcpyHostToDevice);
+  cudaMemcpyAsync(inputKey, inputKeyPinned, nbThread*32*2, cudaMemcpyHostToDevice, computeStream);
+  cudaStreamSynchronize(computeStream);
 
   if (!rekey) {
     // We do not need the input pinned memory anymore
@@ -535,72 +1112,186 @@ bool GPUEngine::SetKeys(Point *p) {
     printf("GPUEngine: SetKeys: %s\n", cudaGetErrorString(err));
   }
 
-  return callKernel();
+  // Fill the pipeline
+  bool ok = true;
+  for (int i = 0; i < NB_OUTPUT_BUFFER && ok; i++)
+    ok = callKernel();
+  return ok;
 
 }
 
-bool GPUEngine::Launch(std::vector<ITEM> &prefixFound,bool spinWait) {
+bool GPUEngine::SetKeys(std::vector<Point> &table) {
 
+  // Computes the starting keys on the device, thread i starts at
+  // table[0] + i*stride with table[k+1] = 2^k*stride
+  int nbBit = (int)table.size() - 1;
+  if (nbBit < 0 || nbBit >= KEY_TABLE_SIZE || (1ULL << nbBit) < (uint64_t)nbThread) {
+    printf("GPUEngine: SetKeys: invalid key table size (%d)\n", (int)table.size());
+    return false;
+  }
+  if (inputKeyTable == NULL || inputKeyPinned == NULL) {
+    printf("GPUEngine: SetKeys: key table not allocated (rekey disabled)\n");
+    return false;
+  }
 
-  prefixFound.clear();
+  for (int i = 0; i <= nbBit; i++) {
+    memcpy(inputKeyPinned + 8 * i, table[i].x.bits64, 32);
+    memcpy(inputKeyPinned + 8 * i + 4, table[i].y.bits64, 32);
+  }
 
-  // Get the result
+  // The results of the kernels queued with the previous keys are collected
+  // by Drain() before, nothing is pending here unless the caller drops them
+  cudaStreamSynchronize(computeStream);
+  nbPending = 0;
+  currentOutput = 0;
 
-  if(spinWait) {
+  cudaMemcpyAsync(inputKeyTable, inputKeyPinned, (nbBit + 1) * 32 * 2, cudaMemcpyHostToDevice, computeStream);
+  setup_keys<<<nbThread / nbThreadPerGroup, nbThreadPerGroup, 0, computeStream>>>(inputKeyTable, nbBit, inputKey);
+  cudaStreamSynchronize(computeStream);
 
-    cudaMemcpy(outputPrefixPinned, outputPrefix, outputSize, cudaMemcpyDeviceToHost);
+  cudaError_t err = cudaGetLastError();
+  if (err != cudaSuccess) {
+    printf("GPUEngine: SetKeys: %s\n", cudaGetErrorString(err));
+    return false;
+  }
 
-  } else {
+  // Fill the pipeline
+  bool ok = true;
+  for (int i = 0; i < NB_OUTPUT_BUFFER && ok; i++)
+    ok = callKernel();
+  return ok;
 
-    // Use cudaMemcpyAsync to avoid default spin wait of cudaMemcpy wich takes 100% CPU
-    cudaEvent_t evt;
-    cudaEventCreate(&evt);
-    cudaMemcpyAsync(outputPrefixPinned, outputPrefix, 4, cudaMemcpyDeviceToHost, 0);
-    cudaEventRecord(evt, 0);
-    while (cudaEventQuery(evt) == cudaErrorNotReady) {
-      // Sleep 1 ms to free the CPU
-      Timer::SleepMillis(1);
-    }
-    cudaEventDestroy(evt);
+}
 
+uint32_t *GPUEngine::rerunKernel(int slot, uint32_t nbFound) {
+
+  // Output overflow: run the kernel call again from its backup keys in an
+  // output buffer large enough for all items. It runs on copyStream, beside
+  // the queued kernels which continue from the current keys.
+  if (inputKeyBackup[slot] == NULL)
+    return NULL;
+
+  if (nbFound > spillSize) {
+    uint32_t newSize = (spillSize == 0) ? maxFound : spillSize;
+    while (newSize < nbFound) newSize *= 2;
+    if (spillPrefix) cudaFree(spillPrefix);
+    if (spillPrefixPinned) cudaFreeHost(spillPrefixPinned);
+    spillPrefix = NULL;
+    spillPrefixPinned = NULL;
+    spillSize = 0;
+    cudaError_t err = cudaMalloc((void **)&spillPrefix, newSize * ITEM_SIZE + 4);
+    if (err == cudaSuccess)
+      err = cudaHostAlloc(&spillPrefixPinned, newSize * ITEM_SIZE + 4, cudaHostAllocMapped);
+    if (err != cudaSuccess) {
+      printf("GPUEngine: Allocate spill memory: %s\n", cudaGetErrorString(err));
+      cudaGetLastError();
+      return NULL;
+    }
+    spillSize = newSize;
   }
 
+  cudaMemsetAsync(spillPrefix, 0, 4, copyStream);
+  if (!launchKernel(inputKeyBackup[slot], spillSize, spillPrefix, copyStream))
+    return NULL;
+  cudaMemcpyAsync(spillPrefixPinned, spillPrefix, 4, cudaMemcpyDeviceToHost, copyStream);
+  cudaStreamSynchronize(copyStream);
+
   cudaError_t err = cudaGetLastError();
   if (err != cudaSuccess) {
-    printf("GPUEngine: Launch: %s\n", cudaGetErrorString(err));
-    return false;
+    printf("GPUEngine: Spill kernel: %s\n", cudaGetErrorString(err));
+    return NULL;
   }
+  if (spillPrefixPinned[0] > spillSize)
+    return NULL;
+
+  return spillPrefixPinned;
+
+}
+
+bool GPUEngine::readOutput(std::vector<ITEM> &prefixFound,bool spinWait) {
+
+  prefixFound.clear();
+
+  // Get the result of the oldest kernel call, the next ones are
+  // still running on the device while we process it
+  int slot = currentOutput;
+  PROF_RANGE_PUSH("Wait");
+  bool ok = waitOutput(slot, spinWait);
+  PROF_RANGE_POP();
+  if (!ok)
+    return false;
+  uint32_t *out = outputPrefixPinned[slot];
+  uint32_t *dOut = outputPrefix[slot];
 
   // Look for prefix found
-  uint32_t nbFound = outputPrefixPinned[0];
+  uint32_t nbFound = out[0];
   if (nbFound > maxFound) {
-    // prefix has been lost
-    if (!lostWarning) {
-      printf("\nWarning, %d items lost\nHint: Search with less prefixes, less threads (-g) or increase maxFound (-m)\n", (nbFound - maxFound));
-      lostWarning = true;
+    uint32_t *spill = rerunKernel(slot, nbFound);
+    if (spill) {
+      // All items are in the spill buffer
+      out = spill;
+      dOut = spillPrefix;
+      nbFound = spill[0];
+    } else {
+      // prefix has been lost
+      nbLost += (nbFound - maxFound);
+      if (!lostWarning) {
+        printf("\nWarning, %d items lost\nHint: Search with less prefixes, less threads (-g) or increase maxFound (-m)\n", (nbFound - maxFound));
+        lostWarning = true;
+      }
+      nbFound = maxFound;
     }
-    nbFound = maxFound;
   }
 
-  // When can perform a standard copy, the kernel is eneded
-  cudaMemcpy( outputPrefixPinned , outputPrefix , nbFound*ITEM_SIZE + 4 , cudaMemcpyDeviceToHost);
+  // The kernel is ended, copy items on copyStream to not wait for the queued kernels
+  if (nbFound > 0) {
+    PROF_RANGE_PUSH("Copy");
+    cudaMemcpyAsync(out + 1, dOut + 1, nbFound*ITEM_SIZE, cudaMemcpyDeviceToHost, copyStream);
+    cudaStreamSynchronize(copyStream);
+    PROF_RANGE_POP();
+  }
 
   for (uint32_t i = 0; i < nbFound; i++) {
-    uint32_t *itemPtr = outputPrefixPinned + (i*ITEM_SIZE32 + 1);
+    uint32_t *itemPtr = out + (i*ITEM_SIZE32 + 1);
     ITEM it;
     it.thId = itemPtr[0];
     int16_t *ptr = (int16_t *)&(itemPtr[1]);
-    it.endo = ptr[0] & 0x7FFF;
+    it.endo = ptr[0] & 0x3FFF;
     it.mode = (ptr[0]&0x8000)!=0;
+    it.type = (ptr[0]&0x4000) ? P2SH : P2PKH;
     it.incr = ptr[1];
     it.hash = (uint8_t *)(itemPtr + 2);
     prefixFound.push_back(it);
   }
 
+  currentOutput = (currentOutput + 1) % NB_OUTPUT_BUFFER;
+  nbPending--;
+
+  return true;
+
+}
+
+bool GPUEngine::Launch(std::vector<ITEM> &prefixFound,bool spinWait) {
+
+  if (!readOutput(prefixFound, spinWait))
+    return false;
   return callKernel();
 
 }
 
+bool GPUEngine::Drain(std::vector<ITEM> &prefixFound) {
+
+  prefixFound.clear();
+  if (nbPending == 0)
+    return true;
+  return readOutput(prefixFound, false);
+
+}
+
+int GPUEngine::GetNbPending() {
+  return nbPending;
+}
+
 bool GPUEngine::CheckHash(uint8_t *h, vector<ITEM>& found,int tid,int incr,int endo, int *nbOK) {
 
   bool ok = true;
@@ -641,14 +1332,14 @@ bool GPUEngine::Check(Secp256K1 *secp) {
 #ifdef FULLCHECK
 
   // Get endianess
-  get_endianness<<<1,1>>>(outputPrefix);
+  get_endianness<<<1,1>>>(outputPrefix[0]);
   cudaError_t err = cudaGetLastError();
   if (err != cudaSuccess) {
     printf("GPUEngine: get_endianness: %s\n", cudaGetErrorString(err));
     return false;
   }
-  cudaMemcpy(outputPrefixPinned, outputPrefix,1,cudaMemcpyDeviceToHost);
-  littleEndian = *outputPrefixPinned != 0;
+  cudaMemcpy(outputPrefixPinned[0], outputPrefix[0],1,cudaMemcpyDeviceToHost);
+  littleEndian = *outputPrefixPinned[0] != 0;
   printf("Endianness: %s\n",(littleEndian?"Little":"Big"));
 
   // Check modular mult
@@ -662,9 +1353,9 @@ bool GPUEngine::Check(Secp256K1 *secp) {
   memcpy(inputKeyPinned,a.bits64,BIFULLSIZE);
   memcpy(inputKeyPinned+5,b.bits64,BIFULLSIZE);
   cudaMemcpy(inputKey, inputKeyPinned, BIFULLSIZE*2, cudaMemcpyHostToDevice);
-  chekc_mult<<<1,1>>>(inputKey,inputKey+5,(uint64_t *)outputPrefix);
-  cudaMemcpy(outputPrefixPinned, outputPrefix, BIFULLSIZE, cudaMemcpyDeviceToHost);
-  memcpy(r.bits64,outputPrefixPinned,BIFULLSIZE);
+  chekc_mult<<<1,1>>>(inputKey,inputKey+5,(uint64_t *)outputPrefix[0]);
+  cudaMemcpy(outputPrefixPinned[0], outputPrefix[0], BIFULLSIZE, cudaMemcpyDeviceToHost);
+  memcpy(r.bits64,outputPrefixPinned[0],BIFULLSIZE);
 
   if(!c.IsEqual(&r)) {
     printf("\nModular Mult wrong:\nR=%s\nC=%s\n",
@@ -683,18 +1374,18 @@ bool GPUEngine::Check(Secp256K1 *secp) {
   memcpy(inputKeyPinned,pi.x.bits64,BIFULLSIZE);
   memcpy(inputKeyPinned+5,pi.y.bits64,BIFULLSIZE);
   cudaMemcpy(inputKey, inputKeyPinned, BIFULLSIZE*2, cudaMemcpyHostToDevice);
-  chekc_hash160<<<1,1>>>(inputKey,inputKey+5,outputPrefix);
-  cudaMemcpy(outputPrefixPinned, outputPrefix, 64, cudaMemcpyDeviceToHost);
+  chekc_hash160<<<1,1>>>(inputKey,inputKey+5,outputPrefix[0]);
+  cudaMemcpy(outputPrefixPinned[0], outputPrefix[0], 64, cudaMemcpyDeviceToHost);
 
-  if(!ripemd160_comp_hash((uint8_t *)outputPrefixPinned,h)) {
+  if(!ripemd160_comp_hash((uint8_t *)outputPrefixPinned[0],h)) {
     printf("\nGetHask160 wrong:\n%s\n%s\n",
-    toHex((uint8_t *)outputPrefixPinned,20).c_str(),
+    toHex((uint8_t *)outputPrefixPinned[0],20).c_str(),
     toHex(h,20).c_str());
     return false;
   }
-  if (!ripemd160_comp_hash((uint8_t *)(outputPrefixPinned+5), hc)) {
+  if (!ripemd160_comp_hash((uint8_t *)(outputPrefixPinned[0]+5), hc)) {
     printf("\nGetHask160Comp wrong:\n%s\n%s\n",
-      toHex((uint8_t *)(outputPrefixPinned + 5), 20).c_str(),
+      toHex((uint8_t *)(outputPrefixPinned[0] + 5), 20).c_str(),
       toHex(h, 20).c_str());
     return false;
   }
@@ -727,7 +1418,7 @@ bool GPUEngine::Check(Secp256K1 *secp) {
     k.Rand(256);
     p[i] = secp->ComputePublicKey(&k);
     // Group starts at the middle
-    k.Add((uint64_t)GRP_SIZE/2);
+    k.Add((uint64_t)grpSize/2);
     p2[i] = secp->ComputePublicKey(&k);
   }
 
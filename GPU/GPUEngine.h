@@ -20,6 +20,8 @@
 
 #include <vector>
 #include "../SECP256k1.h"
+#include "GPUDevice.h"
+#include "../GroupTable.h"
 
 #define SEARCH_COMPRESSED 0
 #define SEARCH_UNCOMPRESSED 1
@@ -27,80 +29,144 @@
 
 static const char *searchModes[] = {"Compressed","Uncompressed","Compressed or Uncompressed"};
 
-// Number of key per thread (must be a multiple of GRP_SIZE) per kernel call
+// Number of key per group (one modular inversion per group), the generator
+// table is built at runtime for the size selected by -gpugroup. The kernels
+// are instantiated for each size from GRP_SIZE_MIN to GRP_SIZE_MAX (powers of 2).
+#define GRP_SIZE 1024
+#define GRP_SIZE_MIN 256
+#define GRP_SIZE_MAX 1024
+
+// Number of key per thread (must be a multiple of GRP_SIZE_MAX) per kernel call
 #define STEP_SIZE 1024
 
+// Number of output buffers (kernel calls queued on the device), 1 disables pipelining
+#define NB_OUTPUT_BUFFER 2
+
+// Device side key setup (rekey): start point + 32 powers of 2 of the thread stride
+#define KEY_TABLE_SIZE 33
+
+// Host wait for the kernel results (-gpusync)
+#define GPU_SYNC_POLL  0 // Poll the result event every ms
+#define GPU_SYNC_BLOCK 1 // Blocking sync, the host thread sleeps until the kernel ends
+#define GPU_SYNC_SPIN  2 // Spin wait, lowest latency but 100% of a core
+
+// Search kernel (-gpukernel)
+#define GPU_KERNEL_THREAD 0 // One grouped ModInv per thread, generator table in constant memory
+#define GPU_KERNEL_BLOCK  1 // One grouped ModInv per block, generator table in shared memory
+
 // Number of thread per block
 #define ITEM_SIZE 28
 #define ITEM_SIZE32 (ITEM_SIZE/4)
 #define _64K 65536
 
-typedef uint16_t prefix_t;
-typedef uint32_t prefixl_t;
+// Bloom filter on the next 64 bits of the hash160 (full address search)
+#define BLOOM_BITS_PER_ITEM 16
+#define BLOOM_NB_HASH 4
+#define BLOOM_HASH(a,b,i) ((a) + (i)*((b)|1))
 
-typedef struct {
-  uint32_t thId;
-  int16_t  incr;
-  int16_t  endo;
-  uint8_t  *hash;
-  bool mode;
-} ITEM;
+// Max size (in bytes) of a pattern automaton loaded in shared memory
+#define MAX_SHARED_PATTERN 16384
 
-// Second level lookup
-typedef struct {
-  prefix_t sPrefix;
-  std::vector<prefixl_t> lPrefixes;
-} LPREFIX;
+#ifdef WITHHIP
+// HIP handles (same definitions as hip_runtime_api.h)
+typedef struct ihipStream_t *cudaStream_t;
+typedef struct ihipEvent_t *cudaEvent_t;
+#else
+// CUDA handles (same definitions as driver_types.h)
+typedef struct CUstream_st *cudaStream_t;
+typedef struct CUevent_st *cudaEvent_t;
+#endif
 
-class GPUEngine {
+// CUDA backend, HIP backend when GPUEngine.cu is built by hipcc (see GPUHip.h)
+class GPUEngine : public GPUDevice {
 
 public:
 
   GPUEngine(int nbThreadGroup,int nbThreadPerGroup,int gpuId,uint32_t maxFound,bool rekey);
   ~GPUEngine();
   void SetPrefix(std::vector<prefix_t> prefixes);
-  void SetPrefix(std::vector<LPREFIX> prefixes,uint32_t totalPrefix);
+  void SetPrefix(GPUPrefixTable *table);
+  void DisablePrefix(std::vector<prefix_t> &prefixes);
   bool SetKeys(Point *p);
+  bool SetKeys(std::vector<Point> &table);
   void SetSearchMode(int searchMode);
   void SetSearchType(int searchType);
-  void SetPattern(const char *pattern);
+  void SetUncompressedKeyHash(bool enable);
+  void SetPattern(std::vector<uint16_t> &table);
+  void SetBech32Mask(std::vector<uint32_t> &table);
+  void SetFoldPattern(std::vector<uint16_t> &table);
   bool Launch(std::vector<ITEM> &prefixFound,bool spinWait=false);
+  bool Drain(std::vector<ITEM> &prefixFound);
+  int GetNbPending();
   int GetNbThread();
   int GetGroupSize();
+  uint64_t GetLostCount();
 
   bool Check(Secp256K1 *secp);
-  std::string deviceName;
+  bool Reset();
 
   static void PrintCudaInfo();
-  static void GenerateCode(Secp256K1 *secp, int size);
+  static bool GetDeviceInfo(int gpuId, std::string &key, int *nbMP, int *maxThreadPerGroup);
+  static void InitGroupTable(Secp256K1 *secp);
+  static void SetSyncMode(int mode);
+  static void SetKernelMode(int mode);
+  static bool HasKernelMode(int mode);
+  static void SetGroupSize(int size);
+  static void *HostAlloc(uint64_t size);
+  static void HostFree(void *p);
 
 private:
 
   bool callKernel();
+  bool launchKernel(uint64_t *keys, uint32_t maxOut, uint32_t *out, cudaStream_t stream);
+  uint32_t *rerunKernel(int slot, uint32_t nbFound);
+  bool waitOutput(int slot, bool spinWait);
+  bool readOutput(std::vector<ITEM> &prefixFound, bool spinWait);
   static void ComputeIndex(std::vector<int> &s, int depth, int n);
   static void Browse(FILE *f,int depth, int max, int s);
   bool CheckHash(uint8_t *h, std::vector<ITEM>& found, int tid, int incr, int endo, int *ok);
 
+  int gpuId;
   int nbThread;
   int nbThreadPerGroup;
   prefix_t *inputPrefix;
   prefix_t *inputPrefixPinned;
   uint32_t *inputPrefixLookUp;
-  uint32_t *inputPrefixLookUpPinned;
   uint64_t *inputKey;
   uint64_t *inputKeyPinned;
-  uint32_t *outputPrefix;
-  uint32_t *outputPrefixPinned;
+  uint64_t *inputKeyTable;
+  uint32_t *outputPrefix[NB_OUTPUT_BUFFER];
+  uint32_t *outputPrefixPinned[NB_OUTPUT_BUFFER];
+  cudaEvent_t outputEvent[NB_OUTPUT_BUFFER];
+  uint64_t *inputKeyBackup[NB_OUTPUT_BUFFER];
+  uint32_t *spillPrefix;
+  uint32_t *spillPrefixPinned;
+  uint32_t spillSize;
+  cudaStream_t computeStream;
+  cudaStream_t copyStream;
+  int nbPending;
+  int currentOutput;
   bool initialised;
   uint32_t searchMode;
   uint32_t searchType;
   bool littleEndian;
   bool lostWarning;
+  uint64_t nbLost;
   bool rekey;
   uint32_t maxFound;
   uint32_t outputSize;
-  std::string pattern;
+  uint16_t *inputPattern;
+  uint32_t patternShared;
   bool hasPattern;
+  bool hasRange;
+  bool hasMask;
+  int kernel;
+  int grpSize;
+
+  static GroupTable *groupTable;
+  static int syncMode;
+  static int kernelMode;
+  static int groupSize;
 
 };
 
@@ -1,1038 +1,11 @@
-// File generated by GPUEngine::GenerateCode()
-// GROUP definitions
-#define GRP_SIZE 1024
+// GROUP definitions, GRP_SIZE_MAX is defined in GPUEngine.h
+// The tables are computed at startup by GroupTable and
+// copied to the device by the GPUEngine constructor
 
-// _2Gn = GRP_SIZE*G
-__device__ __constant__ uint64_t _2Gnx[4] = {0xD5B901B2E285131FULL,0xAAEC6ECDC813B088ULL,0xD664A18F66AD6240ULL,0x241FEBB8E23CBD77ULL};
-__device__ __constant__ uint64_t _2Gny[4] = {0xABB3E66F2750026DULL,0xCD50FD0FBD0CB5AFULL,0xD6C420BD13981DF8ULL,0x513378D9FF94F8D3ULL};
-
-// SecpK1 Generator table (Contains G,2G,3G,...,(GRP_SIZE/2 )G)
-__device__ __constant__ uint64_t Gx[][4] = {
-  {0x59F2815B16F81798ULL,0x029BFCDB2DCE28D9ULL,0x55A06295CE870B07ULL,0x79BE667EF9DCBBACULL},
-  {0xABAC09B95C709EE5ULL,0x5C778E4B8CEF3CA7ULL,0x3045406E95C07CD8ULL,0xC6047F9441ED7D6DULL},
-  {0x8601F113BCE036F9ULL,0xB531C845836F99B0ULL,0x49344F85F89D5229ULL,0xF9308A019258C310ULL},
-  {0x74FA94ABE8C4CD13ULL,0xCC6C13900EE07584ULL,0x581E4904930B1404ULL,0xE493DBF1C10D80F3ULL},
-  {0xCBA8D569B240EFE4ULL,0xE88B84BDDC619AB7ULL,0x55B4A7250A5C5128ULL,0x2F8BDE4D1A072093ULL},
-  {0x2F057A1460297556ULL,0x82F6472F8568A18BULL,0x20453A14355235D3ULL,0xFFF97BD5755EEEA4ULL},
-  {0xE92BDDEDCAC4F9BCULL,0x3D419B7E0330E39CULL,0xA398F365F2EA7A0EULL,0x5CBDF0646E5DB4EAULL},
-  {0x67784EF3E10A2A01ULL,0x0A1BDD05E5AF888AULL,0xAFF3843FB70F3C2FULL,0x2F01E5E15CCA351DULL},
-  {0xC35F110DFC27CCBEULL,0xE09796974C57E714ULL,0x09AD178A9F559ABDULL,0xACD484E2F0C7F653ULL},
-  {0x52A68E2A47E247C7ULL,0x3442D49B1943C2B7ULL,0x35477C7B1AE6AE5DULL,0xA0434D9E47F3C862ULL},
-  {0xBBEC17895DA008CBULL,0x5649980BE5C17891ULL,0x5EF4246B70C65AACULL,0x774AE7F858A9411EULL},
-  {0xC5B0F47070AFE85AULL,0x687CF4419620095BULL,0x15C38F004D734633ULL,0xD01115D548E7561BULL},
-  {0xDEEDDF8F19405AA8ULL,0xB075FBC6610E58CDULL,0xC7D1D205C3748651ULL,0xF28773C2D975288BULL},
-  {0xE49B241A60E823E4ULL,0x26AA7B63678949E6ULL,0xFD64E67F07D38E32ULL,0x499FDF9E895E719CULL},
-  {0x44ADBCF8E27E080EULL,0x31E5946F3C85F79EULL,0x5A465AE3095FF411ULL,0xD7924D4F7D43EA96ULL},
-  {0xC44EE89E2A6DEC0AULL,0xB2A31369B87A5AE9ULL,0x3011AABC21C23E97ULL,0xE60FCE93B59E9EC5ULL},
-  {0x66E4FAA04A2D4A34ULL,0xEB9898AE79B97687ULL,0xA420FEE807EACF21ULL,0xDEFDEA4CDB677750ULL},
-  {0xCF55C2A2444DA7CCULL,0xF3BA28D1A319F5E7ULL,0x2B0286DB4A990FA0ULL,0x5601570CB47F238DULL},
-  {0x7475656138385B6CULL,0xF06ACFEBD7E86D27ULL,0x93EF5CFF444F4979ULL,0x2B4EA0A797A443D2ULL},
-  {0xF3E471B273211C97ULL,0xF02D5290AFF74B03ULL,0x200B559B2F7DD5A5ULL,0x4CE119C96E2FA357ULL},
-  {0x81340AEF25BE59D5ULL,0x1D9AD40271F81071ULL,0x4F93FA332CE33330ULL,0x352BBF4A4CDD1256ULL},
-  {0x99DDCB316F31E9FCULL,0x2431741C72713B4BULL,0x5C96FDB91C0C1E2FULL,0x421F5FC9A2106544ULL},
-  {0xDC9CDADD4ECACC3FULL,0xE42AB8DFEFF5FF29ULL,0x0230010559879124ULL,0x2FA2104D6B38D11BULL},
-  {0x0502BDA8B202E6CEULL,0x683215439D62B794ULL,0x8AC09C9161BA8B09ULL,0xFE72C435413D33D4ULL},
-  {0x69CA0CD7F5453714ULL,0x263C3D84E09572E2ULL,0xAB21A9B066EDDA83ULL,0x9248279B09B4D68DULL},
-  {0x5E5CAD81710C4C8AULL,0xC03FE1B2ABB84088ULL,0xF40CBDEFC8E40997ULL,0x6687CDB5B650D558ULL},
-  {0x7E996D443DEE8729ULL,0x2F570E144BF615C0ULL,0x8E70132FB0BEB752ULL,0xDAED4F2BE3A8BF27ULL},
-  {0xC39A66F904F97968ULL,0x6B31536DA6EB344DULL,0xA7FA6F64D5DC3C82ULL,0x55EB67D7B7238A70ULL},
-  {0xE6A3B5E87D22E7DBULL,0x11ECD9E9FDF281B0ULL,0x8ACF28D7CBB19F90ULL,0xC44D12C7065D812EULL},
-  {0x7513A49D9A688A00ULL,0x1CCFFF21574DE092ULL,0x0B69FC311A03F864ULL,0x6D2B085E9E382ED1ULL},
-  {0xB61C65CBD269E6B4ULL,0x152B695336C28063ULL,0xC89A20CFDED60853ULL,0x6A245BF6DC698504ULL},
-  {0x75D0DBD407143E65ULL,0xDACFFCB89904A61DULL,0x47B6E054E2F378CEULL,0xD30199D74FB5A22DULL},
-  {0xF95AE57F0D0BD6A5ULL,0xCE13300B0BEC1146ULL,0xC077E3D2FE541084ULL,0x1697FFA6FD9DE627ULL},
-  {0x32E8B4DA0547FC11ULL,0x31D611B96C358B60ULL,0xD0E80D468C344BA3ULL,0x1BE68A5A028F2601ULL},
-  {0xF982345EF27A7479ULL,0x9DEB8360FFB7F61DULL,0x986D0F07E834CB0DULL,0x605BDB019981718BULL},
-  {0x0C899DA20F0198F9ULL,0x5D5FEFE3388F85D9ULL,0x0B56C563E3E5E67AULL,0xE0392CFA338AAF2FULL},
-  {0xFE31C7E9D87FF33DULL,0xDCB01C354959B10CULL,0x7402FDC45A215E10ULL,0x62D14DAB4150BF49ULL},
-  {0x69CD5FDF1691FFF7ULL,0x38E2E1FC705821EAULL,0xA88AC16C7D80BFFDULL,0xB699A30E6E184CDFULL},
-  {0x5E555C2F86308B6FULL,0x2C50E9F56B9B8B42ULL,0xDE5B4B06C408E56BULL,0x80C60AD0040F27DAULL},
-  {0xF1929141BB0B4D0BULL,0x0EACF59A33D99CD9ULL,0x9F0E21203041BF08ULL,0x91DE2F6BB67B1113ULL},
-  {0x9D5EABB0FA03C8FBULL,0x4CC5DC9487D84704ULL,0xAA74C6348CC54D34ULL,0x7A9375AD6167AD54ULL},
-  {0xC18ED3A3C86CE1AFULL,0x9CB5E65CEE430558ULL,0x1DB5833FF5F2226DULL,0xFE8D1EB1BCB3432BULL},
-  {0x4BB51F459BC3FFC9ULL,0xBB408EC39B68DF50ULL,0x907A9ED045447A79ULL,0xD528ECD9B696B54CULL},
-  {0xE06B70A9B3834765ULL,0x60C180165D971A61ULL,0x541514731622AF8DULL,0x5D045857332D5B9EULL},
-  {0x87231808F8B45963ULL,0x5266115E4A7ECB13ULL,0xEA25F514E8ECDAD0ULL,0x049370A4B5F43412ULL},
-  {0xC16BAEDC90235717ULL,0x980FDDE9C7E85701ULL,0xF903B3D100E3950DULL,0xF8B0B03D44112259ULL},
-  {0xF1C13EB1FC345D74ULL,0x881D811E0E1498E2ULL,0xD73DF930D64702EFULL,0x77F230936EE88CBBULL},
-  {0x9BD870AA1118E5C3ULL,0xFC579B27452BEBC1ULL,0xB441656EF4E65B4BULL,0x6ECA335D9645307DULL},
-  {0xEB28531B7739F530ULL,0x58C80074AB9D4DBAULL,0xEA44887E5C7C0BCEULL,0xF2DAC991CC4CE4B9ULL},
-  {0x7E8FDE79BD559A9AULL,0x50BC64404230E7A6ULL,0xD5F1774AEFA8F02EULL,0x29757774CC6F3BE1ULL},
-  {0xBCBA4850C690D45BULL,0x5A216CDFC9DAE3DEULL,0x1B4BE8FBBE252012ULL,0x463B3D9F662621FBULL},
-  {0xCA731921025FF695ULL,0x7D36CFC8814C1B29ULL,0x0294339CA3DA761FULL,0x2B22EFDA32491A9EULL},
-  {0xA32496B49998F247ULL,0x6B98FAC14328A2D1ULL,0x09232D4AFF3B5997ULL,0xF16F804244E46E2AULL},
-  {0x249971067C1D506BULL,0x3447BE24500CA7A5ULL,0x1C8331FD47A2E5FFULL,0x4FDCB8FA639CEE44ULL},
-  {0x369E15F7151D41D1ULL,0x5D245315ACE27C65ULL,0xB0352B7A14311AF5ULL,0xCAF754272DC84563ULL},
-  {0x48894A2BD3460117ULL,0xAFE5FD8D103F827EULL,0x27740C2BBFF05B6AULL,0xBCE74DE6D5F98DC0ULL},
-  {0x24497BC86F082120ULL,0x44A09C07CB86D7C1ULL,0xF85D0F1709979D8BULL,0x2600CA4B282CB986ULL},
-  {0x742B761C49B46D3BULL,0x764C1EF4094EE4B6ULL,0x1540CBC9BF962CF4ULL,0x45562F033698FACAULL},
-  {0xC602A7746998E435ULL,0x01C48685E24F7DC8ULL,0x338EC53CD12220BCULL,0x7635CA72D7E8432CULL},
-  {0xD2ACFC4D5FB8C192ULL,0x350C778AC8A30E57ULL,0x8FE0CF28FF1D8822ULL,0x01257E93A78A5B7DULL},
-  {0xC1A50743BF56CC18ULL,0xB7F2B33479D468FBULL,0xDBBF4A87DEEE8A66ULL,0x754E3239F325570CULL},
-  {0xBF07F6894C04F299ULL,0x3C4D66A91706EDECULL,0x84A271333F7FBD04ULL,0x108443B948D15535ULL},
-  {0x9FE2694691D9B9E8ULL,0x330800661D1C952FULL,0xFF57859C82D570F0ULL,0xE3E6BD1071A1E96AULL},
-  {0xE37918E6F874EF8BULL,0xFC4C6F1DCDBAFD81ULL,0x0B1051EAF832823CULL,0xBF23C1542D16EAB7ULL},
-  {0x4CC47FDCF04AA6EBULL,0xC4CCB1F32BA35F4BULL,0x26AE73D88F732985ULL,0x186B483D056A0338ULL},
-  {0x7B54D781FF03D722ULL,0x3A5B3ABCD29189BFULL,0xE3A7B7B92B6C439FULL,0x079264C4B4BFCD7FULL},
-  {0x1A8321724CE0963FULL,0x5442E6D2B737D9C9ULL,0x44C98561F4BE4F72ULL,0xDF9D70A6B9876CE5ULL},
-  {0x980BB7B87C78B8E9ULL,0x4B795B416E702C1CULL,0xB673BACB5CB7CA55ULL,0x70E6B44A2AC6083AULL},
-  {0x5DE64C5F34CE7143ULL,0xAB52554F849ED899ULL,0x497CA815D5DCE0F8ULL,0x5EDD5CC23C51E87AULL},
-  {0xF959C495A3BE5440ULL,0x1FB66F6861C84A35ULL,0x4F1420DD3B90D344ULL,0xC00BE8830995D1E4ULL},
-  {0x722D362F84614FBAULL,0x7AA3FBA1C355B17AULL,0xDA12FE02287E9E77ULL,0x290798C2B6476830ULL},
-  {0x659032865FF5154CULL,0x1E988D693DF4A1FBULL,0xECB4B17F84F42D8CULL,0xA8F2C94E19D9D829ULL},
-  {0x62DFDECEF4053B45ULL,0xCD29552FE3602573ULL,0x054754EFA150AC39ULL,0xAF3C423A95D9F5B3ULL},
-  {0x6E37B93C5C478840ULL,0xFD6B072C4FBB8D47ULL,0x9C052CEBBFBB7E9DULL,0x2773840FCF4E9E45ULL},
-  {0x8D2FED50D884249AULL,0x06BB66B26DCF98DFULL,0xCCCAA28C99BF2749ULL,0x766DBB24D134E745ULL},
-  {0x3FE397C5B3300B23ULL,0xAC44BD64C7BAE07CULL,0x278D0D7420A88DF0ULL,0x96516A8F65774275ULL},
-  {0xCE92E666191ABE3EULL,0x45F7B44F6C596A58ULL,0xA21277C33784F416ULL,0x59DBF46F8C94759BULL},
-  {0xBB3D3D987058C8AEULL,0x0E7E555BD9114950ULL,0x7EFE354DB9F95FE7ULL,0x2DDF7BBCFE114E80ULL},
-  {0xB62DC6018CFD87B8ULL,0xDD647E711A95E73CULL,0x305E691E74E9A4A8ULL,0xF13ADA95103C4537ULL},
-  {0x0ECD31E14F87F62EULL,0x10E6E63863716127ULL,0x0D7C744ED34659F0ULL,0xE9623BBEF1BF90ECULL},
-  {0x488550015A88522CULL,0xDA1869C06EBADFB6ULL,0x6D4167A2C59CCA4CULL,0x7754B4FA0E8ACED0ULL},
-  {0x9E594FECC13B59DFULL,0xBE89B397B454C8B5ULL,0x0A37C28E771C6CB4ULL,0xE35BC6BB1B05B213ULL},
-  {0xA6828C99E2262519ULL,0x01858F95DE8041D2ULL,0xAA3874D46ABEF9D7ULL,0x948DCADF5990E048ULL},
-  {0xE5626BAAF6812379ULL,0xA1ECDBABDCFCCD39ULL,0xD3330A7F05A58614ULL,0x87C01E27D84DA2DBULL},
-  {0x70328A8A3D7C77ABULL,0xFB224CF5AC0BFA15ULL,0x89C7B48F8202EC37ULL,0x7962414450C76C16ULL},
-  {0xE4749682DE46EEACULL,0x9DE2D0E222575F22ULL,0x070FB906BCED4409ULL,0x497C83C39C76E56DULL},
-  {0xB0DD085137EC47CAULL,0x5A16977225B8847BULL,0xB15B160644D91548ULL,0x3514087834964B54ULL},
-  {0xF7086353A80C44FEULL,0x16D1CFDA1B054DA5ULL,0x3D81D3E1EF66CDABULL,0xA8AF384E794930E6ULL},
-  {0x42943D3F7B527EAFULL,0x93E947EB8DF787B4ULL,0xC79CE2C9DD8BC549ULL,0xD3CC30AD6B483E4BULL},
-  {0x2AF2E606110CC919ULL,0x216CBBC90D97AED6ULL,0xFE540E4B0664410FULL,0xEB49FD9F510469F4ULL},
-  {0x3975BA0FF4847610ULL,0x2B29823DB913F649ULL,0xCE1C78FCBFEFE08BULL,0x1624D84780732860ULL},
-  {0xF6639D49C8704818ULL,0xD3A6172D6511C68BULL,0xB435DB84A21605A7ULL,0xDE1D35CBC6308CC5ULL},
-  {0x6DF7B4FD5FC61CD4ULL,0x5192474B5AF207DAULL,0x6902C95633E62A98ULL,0x733CE80DA955A8A2ULL},
-  {0xBF6DCD5710E682F2ULL,0xC134BCD7D6F35919ULL,0x24120CA18648961AULL,0x84DF2E6E5E84CDFFULL},
-  {0xEF258DFAB81C045CULL,0x8966C5092171E699ULL,0xCF1A1C33BBD3B49FULL,0x15D9441254945064ULL},
-  {0x43933ACA7F8CB0E3ULL,0xA22EB53FE1EFE3A4ULL,0x8FA64E044B2EB72EULL,0x3F0E80E574456D8FULL},
-  {0xAC138599D0717940ULL,0x1C21417C9D2B8AAAULL,0xB612136E5CE70D27ULL,0xA1D0FCF2EC9DE675ULL},
-  {0xD637AB63EF91E5B4ULL,0x191110FD2E9122ABULL,0x39BF1C39D65F194DULL,0x4752F85486208311ULL},
-  {0xC7CA37331CB36980ULL,0xA790BADEE8245C06ULL,0x5780C0735F84DBE9ULL,0xE22FBE15C0AF8CCCULL},
-  {0x0221B4CEF7500F88ULL,0x3EE306B3406A2689ULL,0x2E174C835FB72BF5ULL,0xED3BACE23C5E1765ULL},
-  {0x4009452246CFA9B3ULL,0x69635E394704EAA7ULL,0x0EE13473C1155F5FULL,0x311091DD9860E8E2ULL},
-  {0x00E5D46389103C7EULL,0x74E3A1B9D30671F8ULL,0xD9BED6F42DC6A289ULL,0x3049F7FFC71D744BULL},
-  {0x1867D4232EC2DBDFULL,0x883928B45A934078ULL,0xB31C0442D3E6AC24ULL,0x34C1FD04D301BE89ULL},
-  {0x203F636EE00926DCULL,0xDB0DF90ECD4C9483ULL,0x1FB52A688D9D6FE6ULL,0x1880C9AD32FBB07EULL},
-  {0xCC2A5E6B049B8D63ULL,0x8D13F3ABBCD08AFFULL,0x1C14DE5B557EB42AULL,0xF219EA5D6B54701CULL},
-  {0x90C7F04F8ACCB725ULL,0x888043B17BCBE914ULL,0x72310DB34C1E79F3ULL,0x1FC757D383E42507ULL},
-  {0x7236912469A0B448ULL,0x543A5490BCA62708ULL,0xB1F683DB8F45DE26ULL,0xD7B8740F74A8FBAAULL},
-  {0x81C5845BB834C21EULL,0x853B0F22B8925D5DULL,0x20391CEF85374576ULL,0x7E660BEDA020E9CCULL},
-  {0x9FE4D3091AA824BFULL,0xAD5BCD32ABDD9428ULL,0xF86F7C98D3A3335EULL,0x32D31C222F8F6F0EULL},
-  {0xF745DDAA42583D11ULL,0x7B00F024A9728087ULL,0xFA735FC4FCD0AB7CULL,0x3BB9AEC1F1EB9EC7ULL},
-  {0x340F86CBC18347B5ULL,0x8793D77CD59592C4ULL,0x71045A155D9831EAULL,0x7461F371914AB326ULL},
-  {0xEB0AADF82A8D733CULL,0xFFC274BF62FCA8F9ULL,0x0884A36F2080D682ULL,0xBC82DD73E5161DBAULL},
-  {0x287698BAD7B2B2D6ULL,0x6D716B2C3E67453DULL,0x74356A25AA38206AULL,0xEE079ADB1DF18600ULL},
-  {0xBD95EC557A93EAB5ULL,0x88D6B130B16695E5ULL,0x93CC339096D66AD5ULL,0xB74F0C165B4A9435ULL},
-  {0x2BFD8616BA9DA6B5ULL,0xE65DE331874C9DC7ULL,0x467B18302EE620F7ULL,0x16EC93E447EC83F0ULL},
-  {0x9306FE7F8957F489ULL,0xEF6CC374CE143846ULL,0xF81EEE193A3AF355ULL,0xFC6040FE245682CDULL},
-  {0x85B96065D537BD99ULL,0xD8855897F98B6AA4ULL,0x38978290AFA70B6BULL,0xEAA5F980C245F6F0ULL},
-  {0x3EC1775D0FADAE00ULL,0x1DC81F9C32BB84A5ULL,0x53DE84833CCFFDB3ULL,0xA7C0EA7395D87852ULL},
-  {0xA96C4B6B35A49F51ULL,0x58AE04877151342EULL,0x692EE1910A024399ULL,0x078C9407544AC132ULL},
-  {0x9CAA00F574ADC826ULL,0x89E7020E8E0BECB7ULL,0xBD3FF25E9D1667FAULL,0xDD5BA67CFB807824ULL},
-  {0x726578D9702857A5ULL,0x01CDC8AE7A6FC688ULL,0x16DCD838431AEA00ULL,0x494F4BE219A1A770ULL},
-  {0xE0A3BFDA73176237ULL,0x7BF7DDAF568A5FB9ULL,0xD23F25EFBA0F6DD8ULL,0x139AE46A1133F1F9ULL},
-  {0xBF4C1E665C1FE9B5ULL,0xD28211EA58FAA70EULL,0x6BC7F2F5144EA549ULL,0xA598A8030DA6D86CULL},
-  {0x9A7B09B1029471E3ULL,0xB8FFEA50EC08422AULL,0x685BB8C12419BBF5ULL,0xF90B89D53BDC724AULL},
-  {0x4DBADC3E58595997ULL,0x208F020F12570A18ULL,0x09192F5F2DBEAFECULL,0xC41916365ABB2B5DULL},
-  {0x6938AD32C494B319ULL,0x9F055DD3C1C7E533ULL,0x2E1E0BA01AD1A0F8ULL,0x6DF7B5A7A126A611ULL},
-  {0xE4C73A5514742881ULL,0x92A2E0D2E0A36ACFULL,0x5A724604DA03BC5BULL,0x841D6063A586FA47ULL},
-  {0x647077456769A24EULL,0xBCF55CD700535655ULL,0x696C3D09F7D1671CULL,0x34FF3BE4033F7A06ULL},
-  {0xED112AC4D70E20D5ULL,0x282B33810928BE4DULL,0x76026947F89BDE2FULL,0x5E95BB399A6971D3ULL},
-  {0x6E731B06C6F51CD8ULL,0xA0E70ED205C5E94DULL,0x74E67F1D7052F398ULL,0x9DDA94404337DB14ULL},
-  {0xF99471BCA0EF2F66ULL,0x5EC07564B5315D8BULL,0x76C39F8A99FD974EULL,0x36E4641A53948FD4ULL},
-  {0x45D2AE2AE38947D7ULL,0x7ED3C170C45E44D4ULL,0x361BCD154301FF4BULL,0x8A93046D22897B40ULL},
-  {0xAEAB27C2C579F726ULL,0xF5643842170E914FULL,0x90C191A2F507A41CULL,0x0336581EA7BFBBB2ULL},
-  {0x2B1F39BEC59B9618ULL,0xF17D3F1F5EEAFB4EULL,0x75E8B46DC5A91925ULL,0xD5F66020BDD383A8ULL},
-  {0x849742706BD43EDEULL,0x03781025ED6890C4ULL,0xA1F2634FCF00EC84ULL,0x8AB89816DADFD6B6ULL},
-  {0x3F667F69D0D97018ULL,0xAFE835FECA1575E9ULL,0x5F5F8D2AAF30FC6DULL,0xF25F6E271E231DFDULL},
-  {0x4BB40284B8C5FB94ULL,0x20B0938E8ACFF254ULL,0x8133344D9299FCAAULL,0x1E33F1A746C9C577ULL},
-  {0x5EA937913CCF1095ULL,0x6F0328BC6EDA337BULL,0x9541A803535B09DCULL,0x0F1DD626B9722019ULL},
-  {0xA410361FD8F08F31ULL,0x0ED1F4CC18CBCFCFULL,0xEE7F30DED79DD20AULL,0x85B7C1DCB3CEC1B7ULL},
-  {0xB92D2F1129289FA9ULL,0xFA4ACB89CD7D9487ULL,0x888C0A54CE408B48ULL,0x9358BF4E626CE79AULL},
-  {0x72A2800661AC5F51ULL,0x7FBE9A3B878A7AF8ULL,0x9275F4B125D6D45DULL,0x29DF9FBD8D9E4650ULL},
-  {0xC9F81B66FF472ADBULL,0xB5E571AF914FE014ULL,0x6ADC31B4E7830036ULL,0xEF68A2C7AD33241DULL},
-  {0x8082B2E449FCE252ULL,0xDFE58CA2F768105CULL,0x3FEA6E671AAF8ADFULL,0xA0B1CAE06B0A847AULL},
-  {0xD7EFE2315FBC7671ULL,0x743F1BC852858E32ULL,0xD20291CE1798F490ULL,0x8E3D1248C7657211ULL},
-  {0xA113F2E4C0E121E5ULL,0xB499DFB3B2133E4BULL,0x36DC7FF67E840295ULL,0x04E8CEAFB9B3E9A1ULL},
-  {0x5DFB298429952152ULL,0x1CF5E707C8F3050DULL,0x08A0E679D9EEA6A8ULL,0x7B732AF34077F331ULL},
-  {0xF42725C2B789A33BULL,0x0A5076689A010919ULL,0x5AFB81C7CA2F6908ULL,0xD24A44E047E19B6FULL},
-  {0xDF051B79DA14B6C3ULL,0x6F02C24FBB10AE46ULL,0x2718197EF17ED087ULL,0xECC99B0CF89EF141ULL},
-  {0x5104E98E8E3B35D4ULL,0x001EDD28ABBAB77BULL,0x249FDFCFACB99584ULL,0xEA01606A7A6C9CDDULL},
-  {0xB908EA95E5EEBBEFULL,0x09B16386BDE7F857ULL,0x0C128AC00A410976ULL,0x1F6014569D1203AEULL},
-  {0x4AD196DE8CE2131FULL,0x252007D8C5EA31BEULL,0x6C6328655EB96651ULL,0xAF8ADDBF2B661C8AULL},
-  {0x419EB6997DEE8D17ULL,0x2F127B76FF24D7B8ULL,0xB603B7D515377322ULL,0xE19D8D416B28EEEFULL},
-  {0x722F0E3450F45889ULL,0xA674A3DABCFCA15EULL,0x6CC516D47E0FB165ULL,0x00E3AE1974566CA0ULL},
-  {0x8E7B0A261F997190ULL,0x4A03A9C0107E1D63ULL,0xBF7257C3B588E75BULL,0x9EA5C218B98CC990ULL},
-  {0x075EA8CED397E246ULL,0x01993FF3ED258802ULL,0x1CF6993FFED1E3E3ULL,0x591EE355313D9972ULL},
-  {0xD7A17C18F15A3699ULL,0x5E603EB6750077ACULL,0x5F13C7CC84C166D5ULL,0xA8BE67D40815919CULL},
-  {0x077CF03255B52984ULL,0xFA8584E47B084945ULL,0xF19AA97318D8DA61ULL,0x11396D55FDA54C49ULL},
-  {0x0F734AFB0A29F390ULL,0xA53573822A6E94B3ULL,0x36ECBE198E90FE71ULL,0x915050C28C39EBFDULL},
-  {0x05540157E017AA7AULL,0x8DCDFD5468754B64ULL,0x90000738C9E0C40BULL,0x3C5D2A1BA39C5A17ULL},
-  {0x05EC32AD51B03F6CULL,0xA4D047122A9B184BULL,0x2BC776838F73F576ULL,0x308913A27A52D922ULL},
-  {0x425EF8A1793CC030ULL,0xFBC395AFB04AC078ULL,0xA3A99A7299F2E9C3ULL,0xCC8704B8A60A0DEFULL},
-  {0x22109700780A7943ULL,0x83FF4AC34A966EB8ULL,0x97A3B8BC51BFA271ULL,0xFBAF4EB5BDF8FE93ULL},
-  {0xA204119B2889B197ULL,0x7DD4DEFCCC53EE7EULL,0xCD9777AC5CAD29B9ULL,0xC533E4F7EA8555AAULL},
-  {0xA218A7BDA715E7BAULL,0xB77BEEB53920DB82ULL,0x91DD96717159E106ULL,0xF62885CE55FF7BE2ULL},
-  {0xF566D48E33DA6593ULL,0x69BA8C34EEC07BBCULL,0x109F6D08D03CC96AULL,0x0C14F8F2CCB27D6FULL},
-  {0x56835FE50C9D3205ULL,0x09F00C12CDC12C51ULL,0xB41F30C4EFD7C491ULL,0xA5822BD06C673E21ULL},
-  {0xE441F72E0B90E6EFULL,0x4C9739ED75F8F21CULL,0xBAC24789FA17115AULL,0xA6CBC3046BC6A450ULL},
-  {0xBAA1F1CDCBF2D359ULL,0x695331569D729745ULL,0xA663505914704A7BULL,0x328BA6C70C404497ULL},
-  {0x344B39F99D43CC38ULL,0x130A3C0267D11CE6ULL,0xEBFB86C1359B1CAFULL,0x347D6D9A02C48927ULL},
-  {0x4FA07B1B19160F3BULL,0xCD0B27F7EEC5752FULL,0x09EA89E83889FA4BULL,0xF9502D540CA7D5ABULL},
-  {0x855EF7437B72656AULL,0xD47C67B1BF31C8CFULL,0x83F7DCB375EF5866ULL,0xDA6545D2181DB8D9ULL},
-  {0x8464AB4070AB2B7AULL,0xD9C41961F668FDB6ULL,0xF06E95D0665A4073ULL,0xC4F942EA2B52A8CEULL},
-  {0xB9D5994B8FEB1111ULL,0xEC25D6945D657146ULL,0xA13B8148309C6DE7ULL,0xC40747CC9D012CB1ULL},
-  {0xFA4F1BC1DA40F082ULL,0x838230A85B762E92ULL,0x48FC20EC98691ED6ULL,0x69317694D15B16C5ULL},
-  {0xC8203EF4037F3502ULL,0x338C7F713348BD34ULL,0xCCF3A610BE870E78ULL,0x4E42C8EC82C99798ULL},
-  {0xF3287432BEB31DB2ULL,0x8FCAE82788F506A0ULL,0x896A193ED088A2B6ULL,0x78A891AA2234A498ULL},
-  {0x87522A1B3B0DEDEAULL,0xD251CADB0C867432ULL,0x23ABA2E1AF70B236ULL,0x3775AB7089BC6AF8ULL},
-  {0x7632C5C33E4CB721ULL,0xDCB079365966C543ULL,0xAD4572C55B488607ULL,0x192E787021B1E83EULL},
-  {0x46959E3E82F74E26ULL,0xD954595D1314BA88ULL,0x9D94FB814D3D775AULL,0xCEE31CBF7E34EC37ULL},
-  {0x74818EE88F5E524FULL,0x0C8C0AC8D1F6B993ULL,0xCF58F7BC65A2514DULL,0x8267F5F35E78F30DULL},
-  {0xCDC1A01D08B47986ULL,0xFDDB58FD45B1EBEFULL,0x19F6EA6A4EB5464EULL,0xB4F9EAEA09B69176ULL},
-  {0x9169E4EA2B19A602ULL,0x5DACF1A224B15755ULL,0x94ED72DA5B996139ULL,0xA076CACF92CC467CULL},
-  {0xB77907792EBCC60EULL,0x84E2515AFC3DCCC1ULL,0xA0179A48966D30CEULL,0xD4263DFC3D2DF923ULL},
-  {0x395681815F5BE39CULL,0xB9E912769EF3393FULL,0x162AAAE1836A64AAULL,0x4265BBAF8D442AC5ULL},
-  {0x2233EEDA897612C4ULL,0x0032ACC0A4A2DE42ULL,0x4F8D35EB6930857CULL,0x48457524820FA65AULL},
-  {0xB054D3844F1724C1ULL,0x495F3686C9351822ULL,0x2187EE0A7A4E2503ULL,0x3E805FA563758C7BULL},
-  {0x367A1767C11CCEDAULL,0x045E19919152923FULL,0xB11644F3A2AFDFC2ULL,0xDFEEEF1881101F2CULL},
-  {0x75F3D8EF294845F3ULL,0x75A7ADB1B1596240ULL,0xEC401A7FA0F5DB8BULL,0x296EEF5BDD483AF1ULL},
-  {0x6C82DF83B8FAE859ULL,0x5D89BCBC6062CED3ULL,0x3C573F44E1F38983ULL,0x6D7EF6B17543F837ULL},
-  {0xE63065B098BBAE2EULL,0x5D8DB3A2DC56B8B1ULL,0x2416F0AE4ED51EC8ULL,0x32C001F5785688F6ULL},
-  {0x5AF25AF66E04541FULL,0xF3C88B9322554703ULL,0x684500D3B991F2E3ULL,0xE75605D59102A5A2ULL},
-  {0xC7B750F733CE1752ULL,0xE783C797D7CD204EULL,0x812DDF64D99C9AEAULL,0xD7A0DA58D01DC635ULL},
-  {0x7DD43FEFB1ED620CULL,0x9A0C2E60ABE38845ULL,0x6A2BE453D5020BC9ULL,0xEB98660F4C4DFAA0ULL},
-  {0xD0F9CF8031BDC863ULL,0x1D8742AF3A39049AULL,0x3B4AB50F6B1030CEULL,0x838ED2EB98F46685ULL},
-  {0xDC3563E3B8DBA942ULL,0x2154596941888336ULL,0x5939F2E6892B1992ULL,0x13E87B027D8514D3ULL},
-  {0x5F2D7CA5D86E196EULL,0x64F08EA3AA575D8FULL,0x88B4262217960359ULL,0x21C76DBF7A8D075AULL},
-  {0x7BF4491691E5764AULL,0x25424B371CE2708EULL,0x17C38F06A5BE6FC1ULL,0xEE163026E9FD6FE0ULL},
-  {0x6A0C81BD90877ED5ULL,0xFE3F31125F3BC5BCULL,0xE38B59BA5857B83CULL,0x93E651F2D3AC2659ULL},
-  {0x9932E5DB33AF3D80ULL,0x1E626D4350586799ULL,0x78DE3A750C2DC89BULL,0xB268F5EF9AD51E4DULL},
-  {0xEEEFBCC2E74B75FBULL,0x8FECED69F26A8B55ULL,0x83FE7A9DE8AE5B4BULL,0xCD5A3BE41717D656ULL},
-  {0xBF7FFDBA93C4750DULL,0x2B02F01CA99CEEA3ULL,0xE9FAD85EB6C7BFE4ULL,0xFF07F3118A9DF035ULL},
-  {0xC1E4DBFD90AC0427ULL,0x658AA6490EF4EF1AULL,0x4108C1D9049DF6B3ULL,0x6C0D1F1784E47FF0ULL},
-  {0xC16E8C3CE2B526A1ULL,0xA4B9F69E0D825EBEULL,0x4146FD20FFB658BEULL,0x8D8B9855C7C052A3ULL},
-  {0xACC0A89758554B6CULL,0xCA6DD9DA7A9EFA19ULL,0xEF8B8CDBD452F7C5ULL,0xDA9B9E9AB699C11CULL},
-  {0xA54263180DA32B63ULL,0xE4B851CECA91B1EBULL,0xBFA9D472D7AE26DFULL,0x52DB0B5384DFBF05ULL},
-  {0x56FC4C098AD30369ULL,0xD2F58220C30A7CB0ULL,0xF080EA4C21A2ADE2ULL,0x52520DE6009C7E49ULL},
-  {0xFFF543BECBD43352ULL,0x7D0F29C3F3FA48C6ULL,0x395EFD24E80919CCULL,0xE62F9490D3D51DA6ULL},
-  {0x65348F778DB0E595ULL,0xA7163CB9FBA082BBULL,0xD7CE3765816076EBULL,0x7D86781855DB1B17ULL},
-  {0x6D8E7D65AAAB1193ULL,0x1AFA2FF5CB7B14FDULL,0x957509C88F77D019ULL,0x7F30EA2476B399B4ULL},
-  {0xB25031DF15661815ULL,0x4E7759552D729E07ULL,0x81C5C2CD51AC727BULL,0x59AE134C1A41CFEEULL},
-  {0xC60A0361800B7A00ULL,0xEF0FB7B4A1DD1D9AULL,0x46A210FADA6C903FULL,0x5098FF1E1D9F14FBULL},
-  {0x2CF6531FD68BEFD5ULL,0x8615402EB31F2C08ULL,0x5131B1389EFFBBD2ULL,0xF4A0CAAD9AD20992ULL},
-  {0xB9F2C81E2778AD58ULL,0xE2F3C4CCCE445C96ULL,0x72895BE6B9CBEFA6ULL,0x32B78C7DE9EE512AULL},
-  {0xA8F9E0CFB9746ECCULL,0xAC67947361320882ULL,0x0B360AD75EE73FABULL,0xB40226A37A1A586DULL},
-  {0x74B581550547A4F7ULL,0xE37D50F08269DFC0ULL,0xD076EEF2A7C72B0CULL,0xE2CB74FDDC8E9FBCULL},
-  {0x577E0FFA43B4F3BCULL,0x66C2F828CA99FACCULL,0x52AC321EA930AFA6ULL,0x54BEBC996F6C2B7CULL},
-  {0x1BE0D99CD10AE3A8ULL,0x26009A35F235CB14ULL,0xDADC299496AB3574ULL,0x8438447566D4D7BEULL},
-  {0x34D667B8FAD96201ULL,0xCAC732BE31E1B614ULL,0x2BBA4EFF99C743DCULL,0xCEA8D97AE24CAEBBULL},
-  {0x8AB65C82C711D67EULL,0x0587D9C46F660B87ULL,0x9B584C6FC6C30887ULL,0x4162D488B8940203ULL},
-  {0xFC9CAA19FF32151EULL,0xF84B6F6249AE3D7DULL,0xD12EF9CA0A34B068ULL,0x4B24649AC96F264FULL},
-  {0x4F3BA4A4BF5F683DULL,0x175D767AEC3E5068ULL,0xF0F89BFD2DCF54FCULL,0x3FAD3FA84CAF0F34ULL},
-  {0xF600BBDE5B2C74A4ULL,0xA562847BEC1B88B6ULL,0x243061575DC28B48ULL,0xBDC6C1B0F061C563ULL},
-  {0x1C69532FAEB1A86BULL,0xC1FB84BF1370798FULL,0x568C1A7CE05D0816ULL,0x674F2600A3007A00ULL},
-  {0x609C45706CE6B514ULL,0x890905C79B357322ULL,0x8885C35600844D49ULL,0x08BC89C2F919ED15ULL},
-  {0xF87D29BD5EE9F08FULL,0x3D82D6C692714BCFULL,0xB81B815AD1FB3B26ULL,0xD32F4DA54ADE74ABULL},
-  {0x0F08670F188CE2BCULL,0x234D56537053D014ULL,0x78AC98661E39723DULL,0x714651A9CB4AF14CULL},
-  {0x1ED954F1E3CE3FF6ULL,0x6FBB6931F72B08CBULL,0x6E593657135845D3ULL,0x30E4E67043538555ULL},
-  {0x25149EED98FE1249ULL,0x7558B9E8D46130C1ULL,0x61FA0449250CD2A5ULL,0x7E62469C0893FC16ULL},
-  {0xF1971B04D4CAD297ULL,0x7F3DCD10B01E580BULL,0x04682904330E4DEEULL,0xBE2062003C51CC30ULL},
-  {0x6B51046BF16E839BULL,0xAFDDFED53EA14522ULL,0x867960F4F378473FULL,0x0639863C5CF03696ULL},
-  {0xC419859FFF5DF04AULL,0xCB6E84A601DF5993ULL,0xD29E0FB9AC2AF211ULL,0x93144423ACE3451EULL},
-  {0x422049A122517961ULL,0x2FB1F35EA3ADC41FULL,0xA5B943ABDD4A0D7FULL,0x7D54261D569C7330ULL},
-  {0xCB66418C157B112CULL,0x97829205C7B7D2A7ULL,0xF21CA26D6C34FB81ULL,0xB015F8044F5FCBDCULL},
-  {0xA5CBFC789EF0184BULL,0x30C21799E65A6647ULL,0x52DB740B48ABA6D2ULL,0xB35511D67E63FA65ULL},
-  {0x6B3F2AF341A21B52ULL,0x4F8A18DE57A140D3ULL,0x9E4868117A465A3AULL,0xD5E9E1DA649D97D8ULL},
-  {0x9683BAAB330BFF95ULL,0x7F0107D535274C94ULL,0x0E0CA7B596DA918DULL,0xE485BE3DACCABFABULL},
-  {0x996A5316D36966BBULL,0x983005CD72E16D6FULL,0x5DBF8ED77B992439ULL,0xD3AE41047DD7CA06ULL},
-  {0x215B395A558AA151ULL,0xB9E20C1151EFA971ULL,0x23F53C4CF55A0A63ULL,0x0659214AC1A17900ULL},
-  {0x9F80AF87C897B065ULL,0x87197D0A82E377B4ULL,0xFC66CDD22800F0A4ULL,0x463E2763D885F958ULL},
-  {0x008FEF8516060DFCULL,0x76545F84205E6A2AULL,0x48494B9DC41AB086ULL,0xDDC5310F00582AC8ULL},
-  {0x83CDDFC910641917ULL,0x58E597C40BFE747CULL,0xC6F53EC1BB63EC31ULL,0x7985FDFD127C0567ULL},
-  {0xF3ED516ED7C504EFULL,0x4D8E2DF756EF139DULL,0xA8F86C708C25F0E1ULL,0x6A843BA43C244F89ULL},
-  {0xD5FF1543DA7703E9ULL,0x9E74C59CB83D2D0EULL,0xB2DD249410EAC7F9ULL,0x74A1AD6B5F76E39DULL},
-  {0x5FC0DA4813704A08ULL,0x636478CBBFF1713AULL,0x5EDF6A1F8A10DFF8ULL,0x2E34552AA716AEF7ULL},
-  {0xA71D0896B22F6DA3ULL,0xC9BAB42C72747463ULL,0x02D416664BA19B7FULL,0x30682A50703375F6ULL},
-  {0xD33464C342DC0080ULL,0x0EEF5D66580C8E23ULL,0xA74EBD6746E13AFEULL,0x00136933174BC388ULL},
-  {0x1EE6C1347769EF57ULL,0x654E7A2B2464F52BULL,0x6C3791EFEFA79597ULL,0x9E2158F0D7C0D5F2ULL},
-  {0xF50618FA7EAF5AA3ULL,0x8B2B0C32F081E206ULL,0xEB76CC1731C1BA31ULL,0x22213B78F3DCFBDFULL},
-  {0x322857F3BE327D66ULL,0x8172E566E3C4FCE7ULL,0xEBA4029C202538C2ULL,0x176E26989A43C9CFULL},
-  {0x2D6C77BCAC938F93ULL,0xC46E2A586D37641CULL,0xA7AFC8456A40D57BULL,0x8758A9FD232F0FE9ULL},
-  {0x7004788C50374DA8ULL,0xCF1892393DFC4F1BULL,0x68ABB89A13AD747EULL,0x75D46EFEA3771E6EULL},
-  {0xD903E0547BB26BFBULL,0x861A483939A113E2ULL,0xA5F3C28DB17E60DAULL,0x69B47C7249439D23ULL},
-  {0x5B7319F645605721ULL,0x2310FB0451C86934ULL,0xFB698C4C825F6D5FULL,0x809A20C67D64900FULL},
-  {0x475A62C4BC8ADE53ULL,0xED04459E09CA4351ULL,0xC300E97D5188FCA2ULL,0x5654834268843E72ULL},
-  {0x8D563446F972C180ULL,0xDEFECE1CF29C6352ULL,0xED4500B4EAC7083FULL,0x1B38903A43F7F114ULL},
-  {0x0646E23FD5F51508ULL,0xD8C39CABD5AC1CA1ULL,0xEA2A6E3E172DE238ULL,0x8282263212C609D9ULL},
-  {0xF4E6C58868FEEF23ULL,0x263458CE2D07566DULL,0xAB0B4E8DDFA3EFE7ULL,0x90A80DB6EB294B9EULL},
-  {0x0F458AAA1BBF1433ULL,0x552B572EDA6A27A2ULL,0xEA7D7701363C4285ULL,0x545F13C023715040ULL},
-  {0x6DC25D47376BEA9BULL,0x3E6F36054A14546EULL,0x12D625460F60340EULL,0xC2C80F844B705998ULL},
-  {0x4632645C569F8346ULL,0x957E1DC74CA93808ULL,0x47108936B531BB68ULL,0xF27CDDEEA945EF40ULL},
-  {0xA323CE11A28E7553ULL,0x2D00CFE1D5FCD692ULL,0xFDF989D3F19FB265ULL,0x9CF606744CF4B5F3ULL},
-  {0x623833D9037C07DFULL,0x4FB004D707DB9CC0ULL,0x6604467EDD323C31ULL,0xB54D9AFB4F81394DULL},
-  {0xCE98F5855AD82208ULL,0xA6280B0C742005ABULL,0x5A493FD6060D936EULL,0x57488FA28742C6B2ULL},
-  {0xC3AF58D3E8E65BC6ULL,0x6B71482E30FAAF96ULL,0x7430EE6E589C05E5ULL,0x4A5F2B9F56C13DC7ULL},
-  {0x4EDBC5EB4899447DULL,0xD40ED616C758CDC8ULL,0xDC8DF2B8D75963C2ULL,0xF1133CBE6BE8BBC8ULL},
-  {0x0951B67458EF54D7ULL,0x9C05377AAAD02537ULL,0x88F2F14B83FEC504ULL,0x630ACA4D7F4E5D92ULL},
-  {0x0F4E04175BBE89C0ULL,0x3F3D69BFF3E42505ULL,0x7F8989C79065BB81ULL,0x95083E753301BD78ULL},
-  {0x94CD2910186A92DFULL,0x82D033ABE15EE1A0ULL,0x7A5A04B09D46F6F1ULL,0x14E333E19222FFAFULL},
-  {0x62100443BC5C75C6ULL,0x8668C7B363C8D973ULL,0x5E576ED29C99AF63ULL,0x1A908355CBB75675ULL},
-  {0xBD6B7CEA1AD3EC49ULL,0xC8245D6FFB4BBC43ULL,0xC75F9D4D45B2B643ULL,0xD1E0265AA86AE428ULL},
-  {0xF04DF3BEF349B648ULL,0x8A2D1F63C5F31DB4ULL,0xAA867308FAD97F9FULL,0xC5922F740BD343D5ULL},
-  {0x10758152439F943FULL,0x3FF705CF3D8EB910ULL,0xC9C91EFFCA154CDEULL,0xA83D1893BA454E96ULL},
-  {0x96434420E6C95DC9ULL,0x055DCF31163897D9ULL,0x7691A40431B0B672ULL,0x64E1B1969F910297ULL},
-  {0xD44A3A5D1FB1DFA8ULL,0xC818A14CEE53F767ULL,0xFE370EEB9075043EULL,0x2290006B8D17B03CULL},
-  {0x808FB7EA07CE08DEULL,0xC602F8A7549E9CE7ULL,0x6C521BAD3333DD37ULL,0x033B2E76687744EDULL},
-  {0x0225A6E483CF4B80ULL,0xA5A4F8A80ADCDB14ULL,0x02CA9A53D9D22580ULL,0x0BBBA8D764098DC4ULL},
-  {0x951473BE45E4F294ULL,0x89FBF30FF294A75CULL,0xC2A3103317B4AC31ULL,0x20F18F4C866D8A1CULL},
-  {0x9FBF74B955B3EDC6ULL,0xFCA6476EED1FD8D6ULL,0xA8DFAA5328FFFEDFULL,0xAA336DDA311186A2ULL},
-  {0xD1444176D7B69A8BULL,0x2DF3465354643BEFULL,0xA0EB4C685E2A8B9DULL,0x4D1623C944C9C716ULL},
-  {0x9465E6A4AC04DC3FULL,0x5D5AC4B6F46D2DADULL,0xA7C06F71AD2C0DB6ULL,0x0F66DC33E335ABC9ULL},
-  {0xD4AD0FF53DB079E0ULL,0x4FAAD0A4DD0DA7E2ULL,0x280D6B3685894785ULL,0xA901B0DBE8AB292DULL},
-  {0xEF5F2776B40CBED5ULL,0x54F28FA8F3F367E3ULL,0xEFDB401C11354C5EULL,0xBB8A643D0F0C3991ULL},
-  {0x3031C9A6EBFC9A70ULL,0x2F42A24F7C80889BULL,0x50BD66F4484645B1ULL,0x7E0AF07130218FFDULL},
-  {0xFB37D7C0FA4753A8ULL,0x7353C30A84F9FDE9ULL,0xB8EB0201CECC40E5ULL,0xFE330B776C5F5C95ULL},
-  {0xEF82AAB05AEBF20DULL,0xB47F0528546E9DA4ULL,0xC185D335440A9038ULL,0x7BA8187E1A7B25A2ULL},
-  {0x241DD1F60F2CE57BULL,0x220C57CB0D48496CULL,0x4663785CE387C4ACULL,0x4B8B2D95C98777BAULL},
-  {0x55B84A39D93A6807ULL,0x9767B7960E926772ULL,0xB6000816E18FCA38ULL,0x8C050FC34D83B279ULL},
-  {0xBF008C5F9969DA10ULL,0x0E1E4F29FDF154F7ULL,0x5E1637258402CAC3ULL,0x0B07D3E8DBBE686EULL},
-  {0x2A7B8B1BC99C2EC9ULL,0x9D7201A2CBF50620ULL,0x25860583A5249948ULL,0x53B7849A78E4DF86ULL},
-  {0x890A71CEF93CB107ULL,0x881B6842B2DA753FULL,0x2893F416EB820836ULL,0x3F6841C0AA49E8F4ULL},
-  {0xFEBC527E53313B33ULL,0xB633500431DEE78EULL,0x6A075A010FE762BEULL,0x9BDF9E67A5D0C995ULL},
-  {0xAC1C2FC929010467ULL,0x1B92CC919C7F24E0ULL,0x5EDF6D2FCA4B15F9ULL,0x261923949E9661B5ULL},
-  {0x429FD9904A381F34ULL,0x17D9F42C6EC2D2FBULL,0x0BAC031A47606F89ULL,0x7CAA72B37A8AB3BDULL},
-  {0x2AE7F6CB96E73CE9ULL,0xCC3CF4CE06A9402BULL,0xC097793D9116CE71ULL,0xB1D6FF90F1776329ULL},
-  {0xDE16B97E3993D81AULL,0x925D62C75532493DULL,0x79C0295FC3F48DB7ULL,0x2EF29B9F09827975ULL},
-  {0xEBE186694C574C92ULL,0x3D7CEB47EA8D3AE9ULL,0xDAD8E169C06514F0ULL,0xF0D94B756288B707ULL},
-  {0x9E5C34BE97317FF8ULL,0x4029E952EC354E6AULL,0x573C1860AE5D02C6ULL,0xDF157CAD95B07875ULL},
-  {0x15D53B8B91AFEB7CULL,0xF49CFB56BD9452B3ULL,0x6FA8AD52C3B042FAULL,0x6ABD4D9333BFAFBBULL},
-  {0xB15A987016454B1DULL,0xE651D236B71920E7ULL,0xB6182E643B9EB544ULL,0xDD55C150A29CA526ULL},
-  {0x7F2F6C96DF756F05ULL,0xB07F1E9C78C773C4ULL,0x93788317E4874A4AULL,0x85A7B790FC9D9624ULL},
-  {0x25B9E4B898227F27ULL,0xC4D5D39387F01723ULL,0x19147763063D3256ULL,0x16886CF46ED42C79ULL},
-  {0xCFAAEB03678DFDC7ULL,0x9D3BCE6705A8A806ULL,0x6E4E3F391D9FDDCDULL,0x654F313A31153E07ULL},
-  {0x56AEAA7B2B60732FULL,0x27968C22484FF45EULL,0x08E8B306D6F0ACFFULL,0x6FF180FCDAA30618ULL},
-  {0x8BC63D79ECE7A90CULL,0x2CE7ECCF5EF16332ULL,0x9741BBECA9AEEDC0ULL,0xF9D8DF5E84D139B7ULL},
-  {0xF8BCC8EADC395E36ULL,0xAA912B5539F685C4ULL,0x3EB4F51F40EE677CULL,0x03EA4511A00DC2A0ULL},
-  {0x057092C2E810FEAFULL,0xC95226709BC0F32BULL,0xF3DA1E01E00EAE28ULL,0x86CB288BE8F7C5EBULL},
-  {0x3C7CCA20F253081DULL,0x53E4150A835E54B6ULL,0xB38742D8F32DFB8DULL,0x0B82CD70DC3DE9EAULL},
-  {0xBFBDE332851ADF4BULL,0xD074C5A950068469ULL,0xEA4F47738B8E383DULL,0x72E8D1D7B3A6DF2BULL},
-  {0xB7B38B57A196C77FULL,0x06D056F017327D49ULL,0x84EE23BF105A69A6ULL,0xFE2FC3E000748745ULL},
-  {0xC7DE6A136A109F76ULL,0xCF45F67F0004633BULL,0x858BE8E17A4207C8ULL,0x561B1C96E5AF2704ULL},
-  {0x845DBF574BB7858BULL,0xE8B0011446EA35ECULL,0x47E8778B12DB9D6EULL,0x04B90176CDAA3693ULL},
-  {0xC7AC53B7E81DFB49ULL,0xD0172BE8CB2E3BFCULL,0x2031E39C810F81A2ULL,0xE19B94787546D486ULL},
-  {0xCD3EC10A5944C6D2ULL,0xDEFC4272F59528A0ULL,0x4B8C86A9F0DBC9EDULL,0x35F382511D34600BULL},
-  {0xBD0CF968AE813458ULL,0xD57454B00D23FCE0ULL,0xF6FB17A6299ED421ULL,0x2F19CD628CD13CFCULL},
-  {0xF3CC2371722CB94AULL,0xE1D0E9AC3F0111CDULL,0xA1027E26587D3F5BULL,0x1D74B2970311B7FFULL},
-  {0x371B37E58A69FCCBULL,0x82D302E24C43E22AULL,0x3472ADC69CE9C2D3ULL,0x13597010DFAB0F82ULL},
-  {0xF934A68A98450428ULL,0x4F75D1B7C41593E6ULL,0x0B020737B9EC722EULL,0x50A094F309C6F956ULL},
-  {0x92F44930AE3CCDFEULL,0xD2FB805D77A00EC2ULL,0x1F9294D456849C86ULL,0xE290678CBF2A518FULL},
-  {0x99B0A6D627C63DB7ULL,0x282DBCD914B48105ULL,0xDFECF12E275EC38CULL,0x9B65BB812129157CULL},
-  {0x41A9D2DAB3EBA32EULL,0xB36248ACDE3CB427ULL,0xB8A65CA77C422DDAULL,0xFE1C5D4876B17CAAULL},
-  {0x1C20802D36A4BC6BULL,0x85E7F1C5E620ECA5ULL,0x456C1115A1DC831CULL,0x8B4544FC1FDFA06EULL},
-  {0x06B2168FE82D6C03ULL,0x132D0676311A5945ULL,0xECE52A94195712D6ULL,0x6C7630C50231B40EULL},
-  {0xD5F81D95DE0AB4AAULL,0x6CB2AE13DDCEDE29ULL,0x5179B29CC5578FDCULL,0x6C709880B959EB7CULL},
-  {0x8F3F350F48E6014FULL,0xB98F917C524B4F8BULL,0xE7D0950E536A1E25ULL,0x238E918AE286A80BULL},
-  {0x085B56773D537806ULL,0x76FC9D67802B81E7ULL,0x95D891F794A087A0ULL,0x77760B5137BA6A71ULL},
-  {0x48F3D67E59663767ULL,0x2A2F5B2F968D1331ULL,0xE341C05FC609FD52ULL,0xE4B65A7CFF579E46ULL},
-  {0xDF4C426E7E163102ULL,0xE23CD4F8EFD625D0ULL,0xE9A904A8A8C91A67ULL,0x1A8BD7836A0B0C82ULL},
-  {0x457051461540ED0BULL,0x5765395DF8ED19D1ULL,0x2466597572A907BAULL,0xF5EAF4DE39D745E7ULL},
-  {0x53DB5390864ABC30ULL,0xA3FB3099E69471D7ULL,0xFB1E453ED24D91D6ULL,0xFE217DB659079913ULL},
-  {0x889C71E4FB8E3F52ULL,0xBAA045E73DAB0980ULL,0xBD3F3A5182745060ULL,0x124C5C798EDFF99AULL},
-  {0x212AED49F5B33B91ULL,0x07E3ABD748CB6C5FULL,0xC38F58B65EAD696DULL,0x2504D63754AFD5EBULL},
-  {0xC55303DC864F625AULL,0x5DD189BEB02FDFD3ULL,0xAF586B9C402003E9ULL,0x0D2A035B8715BFDBULL},
-  {0x7FBDDCAFDB197B5CULL,0x6160ABBF5CC8976BULL,0x89A9BD3F687105C3ULL,0x0B06F702F47B22D7ULL},
-  {0x876745F9A3372A42ULL,0x6C39AA35A87E2CC1ULL,0x8D9B9103361874B3ULL,0x065210379A8F4D1AULL},
-  {0xBC2128A60D044E23ULL,0xA6F3F99EBD23D0ACULL,0x4034EEB931B54480ULL,0x803B203BB31F9CF9ULL},
-  {0x88236C81FDBC33B0ULL,0x8CB29372E5799F76ULL,0xB1D22B59A2B99962ULL,0x0429053001EEC810ULL},
-  {0xD57289FE0302749AULL,0xE52DE1DE8E95A8DCULL,0xBB50E5BDA03A7312ULL,0x266A9CB4C5F5CEADULL},
-  {0x7AEA9DED421E0B20ULL,0x5E190D948ED2D7BBULL,0xCB71534A9AD04798ULL,0xABF10B2D598FF1D9ULL},
-  {0x5D7360BCF84EBA94ULL,0x64C4C141E9ABEA35ULL,0x2599A7AB98163DF3ULL,0xFD8A9D95D80C7AD5ULL},
-  {0xEF7C62A092B55825ULL,0xF85699F1C9E1A96CULL,0xBCAEBD264B611F92ULL,0xA8EC150DDE7FEB5FULL},
-  {0xF2CB6F26F9DB0A7DULL,0x6E84ACC5B7B0B8F8ULL,0x59FC339A8B2C80BEULL,0xA7322DF309F28F23ULL},
-  {0xAE26074EAB7C9C54ULL,0xA57451495C25E9C4ULL,0x15462823821BB9CBULL,0x06522B91F2E518E5ULL},
-  {0x82C3C7E4CB052D36ULL,0xBD4C461AEA569FFCULL,0x63A104DDBF7F0F18ULL,0x82A8C10F336A6649ULL},
-  {0x8C77C15DF280714AULL,0x32C79F178CAFEF8CULL,0xBE1D440DE92F23F5ULL,0xE5E2F23F7F3EBBD6ULL},
-  {0xC54784A94F15D6DFULL,0x6C4EF2B75BA5C516ULL,0x007CD12F05A60C26ULL,0x9B50D1B68E3BF795ULL},
-  {0xC98334D798D27E79ULL,0x13929C030AC2B7ECULL,0xBB2E268F07C0BD6EULL,0x70D4ED5AA6BC59C5ULL},
-  {0x6718595FBAE08D32ULL,0xB8DCB9D7EE82CB80ULL,0x7DE3A82281D3056AULL,0x3F9083DDC8B423FEULL},
-  {0x91FC66FC195742B6ULL,0x2F4E021ADC54C879ULL,0x9937DBF1EA906594ULL,0x695A4BC690D371E4ULL},
-  {0xDBD1074EF2167FAFULL,0xC923170659D50BFAULL,0x56EFF6BD592666CBULL,0xC75C85C1EE17C1A2ULL},
-  {0xED181DFCB8155102ULL,0x346D804976604EA4ULL,0xCB7E7AAE006316D1ULL,0x56276403F3A5F577ULL},
-  {0x5C68D57698656045ULL,0x60EA8E2B3D4B7FB9ULL,0xB4D0CF0D2F7AAD7CULL,0xC5341FEAF8A0F5D3ULL},
-  {0x0809355F764CF1BAULL,0x34E40A537D398C68ULL,0x111D5F6A04749D07ULL,0x9038876F21C3BC14ULL},
-  {0x8967A03260C2D89BULL,0x220852B7752D67FDULL,0xD52BD4C68705DD22ULL,0x83ACDA3E2A8997E0ULL},
-  {0xED2BD22ED44F7809ULL,0x31B94960DB0898A7ULL,0x61D5209ABD231BDBULL,0x5D8C91C5507B7AF5ULL},
-  {0x5BD279B30025237BULL,0xF1C0D5716C5D3962ULL,0x5B9C4164E29D594CULL,0x5B8191468B299074ULL},
-  {0x83737D56B9B55983ULL,0xCD4F6D703D538ACFULL,0x8C61E798442E5453ULL,0x588F275C9A465457ULL},
-  {0x9B89045E2C3B0E6CULL,0x32F5F664D38D7721ULL,0xF8041796166104E7ULL,0x64778122214E38EFULL},
-  {0x4968D01879F05627ULL,0x8703B423B93E0829ULL,0xAEE312306C994DC8ULL,0x3F44923B0693B954ULL},
-  {0x43D0CB9F1AF12323ULL,0x2B475A9D6DA1017CULL,0x795099099AEE8664ULL,0xED4D826AFE5762F4ULL},
-  {0x943296B9AEBB30D8ULL,0x9CB012D173167742ULL,0xB2F9A546E05CB011ULL,0x953365CF99092ECDULL},
-  {0x7A06EB40CD109C4AULL,0x4D82AC2B55F7AFE9ULL,0xACD6F551346FD61AULL,0x38B42924419AECC3ULL},
-  {0xA675756D4C913FDCULL,0x662967E3B8FD89F6ULL,0x3EC01A72A2B48542ULL,0xD5FB3642DD34F771ULL},
-  {0x446AC2E982138911ULL,0xBB2A8F6224F216E3ULL,0xB434CF70183E8615ULL,0xC3CAD4A8D8BB94A7ULL},
-  {0x00152F2AA8E736F1ULL,0xA19CB524734664E1ULL,0xB8346DD2E5023D25ULL,0xA5B5088C01DF0902ULL},
-  {0x55588E4A54BD6538ULL,0xD9212E5736591A9EULL,0x54FAE40DCE3EA9ECULL,0x2D408FF4D3D236FDULL},
-  {0xCE799F5377539D77ULL,0x61B371D8C145F818ULL,0x7C75AB4FD13F60B1ULL,0x6E087AC61CE91382ULL},
-  {0xBAFB7EAA7A33C854ULL,0xD67423A3A3C6FDAEULL,0x76E90CF813F888EBULL,0xEE7ADF6D247F25FBULL},
-  {0x38FE94479A207310ULL,0x97B2F0CE99495D2CULL,0x85625011814927D8ULL,0x864E30EC83F1AB49ULL},
-  {0x7C811F3E01144B34ULL,0xDD5D37A37C9A864BULL,0x3D91151DC4C5E89DULL,0x2F9457C8A9FFACA1ULL},
-  {0x572E051373D72229ULL,0xF13AB5402C8FBE9BULL,0x49CC68CEA542F71CULL,0x07A594943852C33CULL},
-  {0x7B30C46EB7FEC294ULL,0x60120483EF531C27ULL,0x1CE3478CEFE18DE3ULL,0xD3F332B8A0F11582ULL},
-  {0xCD34ECDB324E4279ULL,0x07BFAA6A000CC126ULL,0xB170355DA78B00CEULL,0xEE9BF5DB6BF58D83ULL},
-  {0x9A4CDF1F8E152B91ULL,0x5F3DDB8666B52F7EULL,0x3521FCD86EF36DD7ULL,0x183408D338B05AADULL},
-  {0xC75991FD328618A3ULL,0xF237FD4928DA8D6DULL,0x5679E2A39C61AEBEULL,0x368B590C7040EE62ULL},
-  {0x3D3956095F40374EULL,0x21FAFFD6C2534686ULL,0xBA8F1F0FF9CF89A7ULL,0x283FEC5DB1145E53ULL},
-  {0x4A5B728BA70076C4ULL,0x4B7F34DB23EF1044ULL,0xAB459017757F7532ULL,0xEF98E34F8FD7A186ULL},
-  {0xF54A0DFBDD52FA62ULL,0xEBC73579770FD6DAULL,0x413BD249D8E7DBFCULL,0x0CE7570A4F943CFAULL},
-  {0x89C56579B464B617ULL,0x592496FBC8B1510EULL,0xF869CC90D81D9371ULL,0x4B5BFCE9275226A6ULL},
-  {0x37794A4C838FD470ULL,0xDF79031574CBEB15ULL,0x1269F648CD919525ULL,0x7E9C4F19C8F4EC3FULL},
-  {0x4FD7674B83411328ULL,0xAD78857D654D2C5FULL,0x237DFF76A505BB63ULL,0x942139D4C45B0EE4ULL},
-  {0x3BF451B464CB001BULL,0x0BA04F4C722A3EC2ULL,0xA7C7F919DF2309F9ULL,0xE2A9BBE60D5D5BFEULL},
-  {0x29BA933572ACA3AAULL,0xDDF755B146A97266ULL,0x35DDE695B48CFD5CULL,0x886EB2E66BE68B88ULL},
-  {0xE709900275271012ULL,0xF55E641B1558C265ULL,0xE43BF37D42A94990ULL,0x504512A43E17EF50ULL},
-  {0xA908B701B5476085ULL,0xB5714E7796EB9F84ULL,0x10D3AAD6A78ED1AFULL,0x3443A7067A08CD3EULL},
-  {0xCD5CBE87285F850DULL,0x859945D8A17B3411ULL,0x4B2D1D51BA72C721ULL,0x81D1F013A6BB325FULL},
-  {0x810AE9A13952EE2CULL,0x6E09B46AAC3B7DE3ULL,0xE1A27FBD9D1B0C88ULL,0xD5B0AC978945C962ULL},
-  {0xA733383D1D895022ULL,0xD90DD51414A3B87CULL,0x18A872767E66C33DULL,0x5B66C2DFC1D28266ULL},
-  {0xF6D3AB8C560E3564ULL,0x606F4C6608F96BA7ULL,0x103C0FB2AA1D36C0ULL,0x94D09A21E27EC50FULL},
-  {0xAFAF868820381186ULL,0x99B583D9AF58C597ULL,0xDBD2D544BDBFF8ABULL,0xAEB5F70E98EC5E38ULL},
-  {0xC935D52C94388352ULL,0x8EA83E7D8745B6BDULL,0xD80D8CD566F2213FULL,0x60F74920A550B0BEULL},
-  {0x707A98212505052EULL,0x557679CA76AD753AULL,0x84761E3C67A9C02AULL,0x0B289EFFE841943BULL},
-  {0x49A9F8EE55640F0DULL,0xE8F67752D830CA26ULL,0x901C75BF0AD6C84AULL,0x481AE134BA75525EULL},
-  {0xF81BD356F619291CULL,0x3F585917E44E1200ULL,0x6B0C8360CFD28288ULL,0xABAE39458B12199EULL},
-  {0x0443B35835E2EC00ULL,0x9682D35086AF5D5FULL,0xD1C2A6A6CEE4AC39ULL,0x794A1C1A306D944EULL},
-  {0x9419C80955FBACAAULL,0x1E0F658C8D91B013ULL,0x81AC224A518EB29DULL,0x4A9583A6485B5A5AULL},
-  {0xBF30DA3C728C7EA9ULL,0x1980DDFC201CA2D2ULL,0x505232B12C82984BULL,0x97A2B6FF47C3DE75ULL},
-  {0x3A21010210EBC169ULL,0xEA236AC1460F17AEULL,0x65FCF46544AB0D9EULL,0xD52F630EDBA6F7CBULL},
-  {0xC74A8A45238F4B32ULL,0x7F80F94A517484CBULL,0x92E54A2577CC170AULL,0x3824B450C286BCF8ULL},
-  {0x8D10E1209ADD6A4DULL,0xC74A2A6335BCA9BFULL,0xF5C50FC052E4C1E9ULL,0x0BDC523782C75858ULL},
-  {0xA550839CF4713B42ULL,0xE7DC2E4BCF43BBCAULL,0xF4419000BF4B6AB9ULL,0xCFD70505FAACD3CAULL},
-  {0x26EE0912E59AD087ULL,0x88156D168F13CE86ULL,0x3BB64E476EB6167AULL,0x44770A338BF0AAB8ULL},
-  {0xE80483A1FDD836DEULL,0xBFF1E99544D93AC2ULL,0x892E957CF45FC04FULL,0x5234CD122B1B943EULL},
-  {0x3E32D924515E1679ULL,0x6503108D8EE8E1C8ULL,0x319AC20323E36672ULL,0xB15E7B322E404AEEULL},
-  {0x368D947A98F374F3ULL,0xF225C4C20F719044ULL,0xF418307A62755591ULL,0x5E203ED5F22D171DULL},
-  {0x27BBD9AEDDB00F22ULL,0x665AE108D5E04190ULL,0xF2C50F758A1C1DF9ULL,0xA1ED755705225CD0ULL},
-  {0x1CCE481C4557EBDBULL,0x32C7E0F65871AF33ULL,0xCBEA34F83D4B3B64ULL,0x5ABEE688767D78D1ULL},
-  {0x3CF8AFB31D918AF5ULL,0x479E9EC9C23A37A2ULL,0xD9BFC43C2C60580FULL,0xE8AAF3616A1BC60FULL},
-  {0x4CF16175EE702BDEULL,0x55CB3A42AABF276DULL,0xED6E5009DF72A7F7ULL,0x4D87DAC33916FEF2ULL},
-  {0xC5A3AA37054C20A3ULL,0x0759C04338A3DB76ULL,0x52A4A4EF6187A6D6ULL,0x5DC6F8CD2C855E63ULL},
-  {0x875D289F2050A94CULL,0x75D82FEF7413E661ULL,0x2FED8ECE711BEDF3ULL,0x600A6C0A11395E4DULL},
-  {0x5F1A07CB6B42F3A6ULL,0xF6563620461AF26AULL,0x68A063EF22AA489CULL,0x6332731167BED8AFULL},
-  {0x85A52ACF8B8ED029ULL,0x88FA5898EB286E79ULL,0x4964B6EB4A72A35BULL,0x54A38D7F1CB06CFEULL},
-  {0x535230F948080263ULL,0xAD66E50AD798A0D3ULL,0x2305C2017E8654DBULL,0x8A40D9259A393B38ULL},
-  {0xD7B1A0297A9832A2ULL,0x5B39A16EFB1376D2ULL,0x12093E635130275AULL,0x954B544FC17CED53ULL},
-  {0xCDFDEAF82078645AULL,0xA6A02C8BCC20B17DULL,0xF517FD3F9A05B7DEULL,0xE714710727C7420AULL},
-  {0xDB84E208A0664BA9ULL,0x457F06ACD3EC84E8ULL,0xEFB655513D9420AAULL,0x38ADD3D6209080C8ULL},
-  {0xCAE1F69C9661C82DULL,0x9922BCE891C026C0ULL,0x01E42A68553952C2ULL,0x6131291CD95FB878ULL},
-  {0x5DEFC382A812022CULL,0x48B26D6791FC1417ULL,0xA69DAE2AFE315336ULL,0x58AF3FF6AD4C5FA7ULL},
-  {0xB782BCF1D1CA4951ULL,0xFC5E2AA9DA5003BFULL,0xD0A9BFA81788809EULL,0x4BC4F845B6764692ULL},
-  {0xA393DD3CC13DAF9BULL,0xACD81F2C129E2E9BULL,0x0BFD83186BAD43ACULL,0xCDAF553843B6C241ULL},
-  {0x698E6ECAA2BE67DFULL,0x52865B5D582A201FULL,0x29F9BFF5C985F364ULL,0x45A880A27BBEE9DFULL},
-  {0xA4ED5AE98E67E053ULL,0xE007AFBF034336BCULL,0xD1237BA589E53688ULL,0x54D6C11ADD0AD7E3ULL},
-  {0xF21F1A0D4AF4F2A4ULL,0x877E5495B21500D3ULL,0x64D6847A220145D1ULL,0x6A826A38317C0C86ULL},
-  {0x71D7055E766E2A61ULL,0x630F89E2DDEB8EEBULL,0x7CE22C9D50D0D0E4ULL,0x0BA295548376A319ULL},
-  {0x613E8A34366A23A9ULL,0x8BD860DE7C6CC75FULL,0x6CC8AA1B09DCE572ULL,0x15356506F255F7E9ULL},
-  {0xF995DE1D41A41D4EULL,0x9B27A6D32F35519BULL,0x2A7708BB1A4928FBULL,0x63D208B1D5DA7078ULL},
-  {0x2B5E1CA0F2B89B91ULL,0xCACFF3A5CCA6443AULL,0x6B86517802DAC2ECULL,0xF3BC12AEF53D9F5FULL},
-  {0xC4768F698E6ECCD5ULL,0x70699299B46FD20EULL,0xBAB09F3F711B8944ULL,0xD2FE6F2A4A5B2302ULL},
-  {0x6F728297335C0FD4ULL,0x22320BEF58453373ULL,0xF7A26EF18B387649ULL,0x7E3C8C6DFA04A536ULL},
-  {0x2A7F83C6FE4DD676ULL,0x9141A9E58F01A821ULL,0x921DAC67A08A99A9ULL,0x0D31C9CB3077DFFDULL},
-  {0xD8844608AD0369D8ULL,0x6943AB9BD6E17223ULL,0xC161C696D85155FEULL,0x198CBFCFA0575FC2ULL},
-  {0xCDB7E17DB1AA5DA5ULL,0xF8377BDA229C85DCULL,0x692C9D158B0FED48ULL,0xD78D9E6E3949FB2DULL},
-  {0x3AEB1350AFB0E5E8ULL,0x5A147CAA780B1FD6ULL,0x22183C089089B90DULL,0x1E056E89B68CF35AULL},
-  {0x854DE34AC5146E2CULL,0xE38747872EB0F194ULL,0xAF2EAEE0D2C8108DULL,0x32A2371E19493415ULL},
-  {0x3FAC729E72FAAA21ULL,0xD8108144CE7F98FBULL,0xA6173B2F1A646D47ULL,0xDC7FF9748D827E7EULL},
-  {0x2B2524CFF17DB5AAULL,0xBE54FD1050964433ULL,0xD04E6DC6DBE5AF58ULL,0xFAE90A817F8E22F6ULL},
-  {0x9A99DA1B2FD28E79ULL,0x36B2EFF0BF8F8EC2ULL,0x05354BC11CDFBC48ULL,0x71B95EFCC4981E07ULL},
-  {0xAC76A68D881CFF57ULL,0x370628799F0042D5ULL,0xBE4FF75FC7F23C78ULL,0x552CCD9A6DC6ED77ULL},
-  {0x6876883ADE542B3AULL,0xF6B96121897044AEULL,0xC9F3E8FFA25BBA83ULL,0x43854CAF29DC2BD6ULL},
-  {0x218467B781380011ULL,0xA7DBFE1CEB3C3046ULL,0xB6159CAA1834E391ULL,0x4B4C722CDAFE6B53ULL},
-  {0x45C2ECF2D427B222ULL,0xB6EFF990FB877961ULL,0x708C9B730D5FD084ULL,0x02ADFE17090E9F9CULL},
-  {0x6EF85D9F839E9307ULL,0x45007D49F44BE010ULL,0x789149B4DEB5E017ULL,0xA401466C36306589ULL},
-  {0x471E3E8227A9D6F9ULL,0x09F70C54AE33C620ULL,0x15B3A5343B3FF31AULL,0xA123452C2B7EAF31ULL},
-  {0x59EAC485C16B9F1FULL,0x1FAC813A96608F9CULL,0x20CBF7A8BFDA75ACULL,0x9E6D1D11B1010556ULL},
-  {0x3D06E32CCEC0A6ABULL,0xAAB166AE7DECCA60ULL,0x86C1521761348737ULL,0x9B89A3C2CA995A81ULL},
-  {0xC5A94D0A9B2AC0EAULL,0xB45D15557178DF96ULL,0xF407989C69A5FA44ULL,0x36E42046E6FF9497ULL},
-  {0xC907964611E9E9B2ULL,0x384B04339ED8B2EDULL,0x08E2B9A0DC45272BULL,0x64DD7457E7D9D739ULL},
-  {0x5033637562D46286ULL,0xC3BA1C7EC9293FDEULL,0x4FD3A6F3416AB8CFULL,0x2C5654E3E9511B21ULL},
-  {0x6B35767D6FA2176CULL,0x20ABBA421C7F550AULL,0xD327FD714EB71C87ULL,0x59227431BE607C6BULL},
-  {0xA520DCFC7AFD0EE3ULL,0xE1575FAC35347AAEULL,0x42435E45738A1FC0ULL,0x8D58E0C7F81FFD92ULL},
-  {0x8C5106EF795FE2C2ULL,0x843B7D08A7237BDCULL,0x1C80DDF199374363ULL,0x53D765CDADB26E9EULL},
-  {0x78A3851D834B7BC5ULL,0x66182F26E1EF5088ULL,0x4E1B53EBA3FC6487ULL,0xAEECA6C51962FF44ULL},
-  {0x6D7B519A57BB66AFULL,0x0452EE909B66FFC1ULL,0x523A989C0F5FF6C1ULL,0xE507DE9EC16B3BF3ULL},
-  {0x873DA3E3E7096167ULL,0x96217BFBC3765457ULL,0x7965744876CD683FULL,0xAD67F8EC3B9270F3ULL},
-  {0x5569C98339B4A6F2ULL,0x65601D76E2A57983ULL,0x81903B8CB9F60B7AULL,0x016F48C60EB84FB2ULL},
-  {0x3199ED26D0CF5B23ULL,0xE616E3C00CBFA3F7ULL,0x4A8015D9D001DD58ULL,0xA88477A4BBD192A0ULL},
-  {0x0CAB6339E1446056ULL,0x0BB98E382A3B3AF9ULL,0x270B513233D12D85ULL,0x650471AE774265E3ULL},
-  {0x9CC896ECFDA0741EULL,0x03472A630354B893ULL,0x67582AC3DC16263DULL,0xD7141263F49B52D0ULL},
-  {0x559AAC2ABC21DDA8ULL,0x348D1BA1FD7AC821ULL,0xCC90E19D69825FAEULL,0x15DEA416FA34584FULL},
-  {0x9B1A22423C00C0E9ULL,0x87E8962E773936F5ULL,0x12BCF93290C8B916ULL,0xB765379DD0CE61F6ULL},
-  {0xDC5CBA07B05B46E2ULL,0xEE9D6A07B4F7C751ULL,0x3DB900878357BA46ULL,0xB42B24954F1F70EDULL},
-  {0x6269A8DE20457A2FULL,0xB4B29346BCE2383AULL,0xC04B336AC4E2D15AULL,0x57EAA919A8428F13ULL},
-  {0xA17FC57FC0230F83ULL,0x6AB10B7E8E250960ULL,0x1DAB1125DEC9B460ULL,0x08E9E4F5C6AEAC31ULL},
-  {0x6AF37C9586C9257DULL,0x2DDDC948770DCD1CULL,0x9E09A08F9C47DA92ULL,0x9743E81DB8951246ULL},
-  {0x29549FE93FE1AC2EULL,0xD6F2BB81F804B528ULL,0x8627FB63BD4D50BFULL,0x87BE732373BD4B73ULL},
-  {0x46BEAE21F38EB0ABULL,0xB9D48C9132D6932BULL,0x7C0AFB33275EFA0BULL,0xF535FCF0DBF4A517ULL},
-  {0x002727E1659D60F7ULL,0xD2CFD466AF34AC95ULL,0x85E9514AB5C8924DULL,0x43601D61C8363874ULL},
-  {0xA549ACA42390EB9FULL,0x4FE4937014412B1EULL,0x2E6A29898E95F7F1ULL,0x34FD3C50CE93565BULL},
-  {0xA0DAAFA32AB49D0DULL,0x6902E3942A2560ACULL,0x365F0BCBBA66AF96ULL,0x341B1580F83071C5ULL},
-  {0xE885F0BE51D324BAULL,0xF0F9594FB445A474ULL,0xE5212C847B322E73ULL,0xB1C145FA89DEB0CCULL},
-  {0x57627171F14DAD95ULL,0x33AC1AA8E56492EBULL,0x7C7181E2C79FB154ULL,0x175E7CB3CE4A3A43ULL},
-  {0x1ECE2218DC1EEDF1ULL,0x1D4B391C2C167694ULL,0xB5EE8F0F087A90B3ULL,0xE7E90DB9C68FB748ULL},
-  {0x249E45C1307165ADULL,0x89C1E4954C80BA98ULL,0xE3B3C8482CA3ECACULL,0x5AD430CC64E61C61ULL},
-  {0xB739FF14EECE9BE5ULL,0x9A7A2AA2B9C707EAULL,0xEAD13C9DC41A0CEDULL,0xE5D533D0B1A50075ULL},
-  {0x8AEFEFA60DB8B837ULL,0x080F0CE3DD7D09F2ULL,0x988602DF07FA84C1ULL,0x41DCE0D96DACE318ULL},
-  {0x480CEEC6B11708D6ULL,0xFDD5AD5864F0B208ULL,0x6B247DA76FB322B5ULL,0x8623A0242997D4D9ULL},
-  {0xA23CC14239961BCCULL,0x9AED2D5E0432FE5BULL,0x103C1DC252067643ULL,0xA5EF449887104DDAULL},
-  {0xDED5A9C6EDB33C7FULL,0xCAA92B4D28FB0F20ULL,0x04CA355603AC6073ULL,0xEE38BCC9C07B2C0EULL},
-  {0x6DB57235FB3A9D45ULL,0x18225F2E2D6D5E62ULL,0x38BDF68B852A2CBEULL,0x4DA26ECE9AD46003ULL},
-  {0x3386F2303E62A830ULL,0xA9502AF9A5A384DDULL,0x8C7EC4B0EC577F41ULL,0x05C4F5B92ACB30EEULL},
-  {0x29DEDC69F98F4763ULL,0xE9D9558511E69111ULL,0x488D8EB16A19A4F7ULL,0x6E621E6F53D2408EULL},
-  {0xD1A0A7EBAF176C59ULL,0xAC3C67B10E1C262BULL,0xF9845BD73ACA2C3FULL,0xA01FA1D039FFDCF7ULL},
-  {0xDA4554D5278BE83BULL,0x66BAE20A8F082AB6ULL,0x9B57EA758A395A90ULL,0xEBAF57645BED7469ULL},
-  {0x8F3C7EFFDB7EFBFDULL,0x25C8C5E0B5FE8B36ULL,0xB3E13D57FFA04267ULL,0xCAFE3746EFCAAFE3ULL},
-  {0x6A6FF6353310182FULL,0xFAA38CA11438C17AULL,0x24B55DBF052B15D2ULL,0xC0F88A71711B632DULL},
-  {0xD183073E086303BBULL,0xC2000654B98625AFULL,0xFC9954B772EE03B8ULL,0x1169517B36ADAECDULL},
-  {0x1B5287B05B5C6350ULL,0xDC1CDDB73CF70AE0ULL,0xC6244FBF262922C6ULL,0x5D9B6C1884B79498ULL},
-  {0xECF734DE8D4AFE93ULL,0xBF46C6D8342CE4C2ULL,0x33C29BE27EB55CA7ULL,0x1BD37624603AD841ULL},
-  {0x654C49F04E02E21CULL,0xE57D759555904016ULL,0xD4F214C6323A53B7ULL,0xD1D1360F37ED6E69ULL},
-  {0xD1A62DB35E5A0EFCULL,0x88FEC599840554A3ULL,0x654B195156EA885BULL,0xD819F05A2B256434ULL},
-  {0xE4969CCBEE411731ULL,0xACE29A8365674703ULL,0x58ACFA1897B1B2B2ULL,0xEFC987CBF1023AF5ULL},
-  {0x9D2A50D2B9B4565BULL,0x03A4037F6A4B3C97ULL,0x9926E3C74CEA9F81ULL,0xE95F2ECC2A6F8517ULL},
-  {0x31090FAA18284FF0ULL,0x968D1D7B83EF6B01ULL,0x61B88B7873864480ULL,0xF3026B97163DF3BDULL},
-  {0xA77F2FFCCF816C09ULL,0x4ADE43BDFD6FF05FULL,0x54F0BD1F5D5DB164ULL,0x7BB81730470F80D0ULL},
-  {0x5622090D682C5873ULL,0x0DEEECF968FF830BULL,0x92AC92C68C9CFF46ULL,0x5D34FF5F123B5B69ULL},
-  {0x15CF66B400C5C4A2ULL,0xD19AAA9BF484CAE4ULL,0x72E19A795E2F26C4ULL,0x34670A0FD7442419ULL},
-  {0xDAC67280468447F4ULL,0xE0EE591D31A9B0BBULL,0xC39DA06584308CC8ULL,0xCBF9BA1794A95247ULL},
-  {0x7958202262098D15ULL,0x44258F8BDF27A502ULL,0xB46EDC0609A49FC0ULL,0xE8B6D43B8C8AD16BULL},
-  {0x79ACACD4C7DCD31FULL,0x8E7747B8368D7A53ULL,0xBF5982A6B57A7344ULL,0x920975BA09E2261BULL},
-  {0x281CD432A7ABE2E9ULL,0x8E9B7F5F9A964BA1ULL,0xEF5B4EA5D0AA1760ULL,0xD902FF7196DDC842ULL},
-  {0x33FCF13207EECA64ULL,0x391323123BC180FFULL,0x926CDCE82B4F25D0ULL,0x815B2AE46FDCB55DULL},
-  {0x1027F5D7ABF26691ULL,0xC402465AC9EF1ABFULL,0x41261D431ED5D6B5ULL,0x7DE7FF4ADAC9E8C0ULL},
-  {0x0DE3C454F7E0B16EULL,0x27CA8025DA231926ULL,0x30EA86397A4D387EULL,0x1BB9A6C28E28D4BAULL},
-  {0xE2EAC38C5A21CCA3ULL,0x1CAC180586E0593DULL,0xE188AB31BFF04795ULL,0xDEC5646CF68E99D4ULL},
-  {0x34D337C6DA68BC22ULL,0x9C05A4BA78EB4C3DULL,0xB099D29DDDE278F1ULL,0x6F0153FEDFFD83EAULL},
-  {0xA23DB209B94D95DDULL,0x15827AB192BADAB5ULL,0x49C76EABCA8F836FULL,0x5578C43AD6E125C4ULL},
-  {0x2E9CB7A91B20258AULL,0xED23E5E6C6DAE855ULL,0x0D00D38471BF555AULL,0x3454F73B3BEE77A4ULL},
-  {0x678FB8F58AE63078ULL,0xF7136FC937924C39ULL,0xA9AB2130BDC4870AULL,0x7A6DDE243E278C95ULL},
-  {0xFC59317C230E9A86ULL,0x1DFCF68640EDDF02ULL,0x1B8C2616AD528030ULL,0x367807C9A3606B4EULL},
-  {0xA4E269AB79AD5A63ULL,0x325E6D15B0827D6FULL,0x8C69D32B0C8528D9ULL,0x6E8F70652C33EF0BULL},
-  {0xACBA5941201AF62BULL,0x01B8254175FC4909ULL,0x1374E06F0C44B815ULL,0x8EC4FDC39891F6AFULL},
-  {0x926E2C00EF34A24DULL,0x0ADBC968D9E159D0ULL,0x905A857A9CF918D5ULL,0x465370B287A79FF3ULL},
-};
-__device__ __constant__ uint64_t Gy[][4] = {
-  {0x9C47D08FFB10D4B8ULL,0xFD17B448A6855419ULL,0x5DA4FBFC0E1108A8ULL,0x483ADA7726A3C465ULL},
-  {0x236431A950CFE52AULL,0xF7F632653266D0E1ULL,0xA3C58419466CEAEEULL,0x1AE168FEA63DC339ULL},
-  {0x6CB9FD7584B8E672ULL,0x6500A99934C2231BULL,0x0FE337E62A37F356ULL,0x388F7B0F632DE814ULL},
-  {0xCFE97BDC47739922ULL,0xD967AE33BFBDFE40ULL,0x5642E2098EA51448ULL,0x51ED993EA0D455B7ULL},
-  {0xDCA87D3AA6AC62D6ULL,0xF788271BAB0D6840ULL,0xD4DBA9DDA6C9C426ULL,0xD8AC222636E5E3D6ULL},
-  {0x3C870C36B075F297ULL,0xDE80F0F6518FE4A0ULL,0xF3BE96017F45C560ULL,0xAE12777AACFBB620ULL},
-  {0xA5082628087264DAULL,0xA813D0B813FDE7B5ULL,0xA3178D6D861A54DBULL,0x6AEBCA40BA255960ULL},
-  {0xB5DA2CB76CBDE904ULL,0xC2E213D6BA5B7617ULL,0x293D082A132D13B4ULL,0x5C4DA8A741539949ULL},
-  {0x05CC262AC64F9C37ULL,0xADD888A4375F8E0FULL,0x64380971763B61E9ULL,0xCC338921B0A7D9FDULL},
-  {0x3CBEE53B037368D7ULL,0x6F794C2ED877A159ULL,0xA3B6C7E693A24C69ULL,0x893ABA425419BC27ULL},
-  {0x301D74C9C953C61BULL,0x372DB1E2DFF9D6A8ULL,0x0243DD56D7B7B365ULL,0xD984A032EB6B5E19ULL},
-  {0x6B051B13F4062327ULL,0x79238C5DD9A86D52ULL,0xA8B64537E17BD815ULL,0xA9F34FFDC815E0D7ULL},
-  {0x29B5CB52DB03ED81ULL,0x3A1A06DA521FA91FULL,0x758212EB65CDAF47ULL,0x0AB0902E8D880A89ULL},
-  {0xC65F40D403A13F5BULL,0x464279C27A3F95BCULL,0x90F044E4A7B3D464ULL,0xCAC2F6C4B54E8551ULL},
-  {0xC504DC9FF6A26B58ULL,0xEA40AF2BD896D3A5ULL,0x83842EC228CC6DEFULL,0x581E2872A86C72A6ULL},
-  {0xE1F32CCE69616821ULL,0x1296891E44D23F0BULL,0x9DB99F34F5793710ULL,0xF7E3507399E59592ULL},
-  {0xCFB199F69E56EB77ULL,0xCED1F4A04A95C0F6ULL,0xE997B0EAD2A93DAEULL,0x4211AB0694635168ULL},
-  {0xF5192E5E8B061D58ULL,0x81D8E0BC736AE2A1ULL,0xE9E298043589351DULL,0xC136C1DC0CBEB930ULL},
-  {0xB570C854E5C09B7AULL,0x1A01F60C50269763ULL,0xB343083B5A1C8613ULL,0x85E89BC037945D93ULL},
-  {0x450288EE9233DC3AULL,0x6162948271D96967ULL,0x5DA61FA10A844C67ULL,0x12BA26DCB10EC162ULL},
-  {0x67BD3D8BCF81998CULL,0x4A1B3B2E71B1039CULL,0xD59C18259DDA3E1FULL,0x321EB4075348F534ULL},
-  {0xDB20717AD1CD6781ULL,0x743034B37B223115ULL,0x16F6DB7E225D1E14ULL,0x2B90F16D11DABDB6ULL},
-  {0x423BA76B532B7D67ULL,0x181D70ECFC882648ULL,0xB64569335BD5DD80ULL,0x02DE1068295DD865ULL},
-  {0x978ED2FBCF58C5BFULL,0x01DC88E36B4A9D22ULL,0xD3AB47E09D729981ULL,0x6851DE067FF24A68ULL},
-  {0xE54A32CE97CB3402ULL,0x3FC0DE2A887912FFULL,0x5D1AA71BDEA2B1FFULL,0x73016F7BF234AADEULL},
-  {0xB32E83B25C83AD64ULL,0x0EF8E529F033F272ULL,0x1A1FA873825C7200ULL,0x3FD502B3111178B1ULL},
-  {0xAB40E52290BE1C55ULL,0x3F83C230F3AFA726ULL,0xD4A1ACA87EF8D700ULL,0xA69DCE4A7D6C98E8ULL},
-  {0xD0689F2F493BE3C8ULL,0x40973BCE1C95052DULL,0x0B1E718BF4042585ULL,0x7D916A47B2B58140ULL},
-  {0xA039063F0E0E6482ULL,0x0E106E861EDF61C5ULL,0x76C45926C982FDACULL,0x2119A460CE326CDCULL},
-  {0x8DBAC47A17F388FBULL,0x776238AA0BD5FF24ULL,0xC739DDFA33604A83ULL,0xACB82EB93309AD1CULL},
-  {0xFD5E6348100D8A82ULL,0x8B33BA48D0423B6EULL,0x8B3F5126F16A24ADULL,0xE022CF42C2BD4A70ULL},
-  {0x05B3FF1F24106AB9ULL,0x1F760CC364ED8196ULL,0xB3D6DEC9E9838065ULL,0x95038D9D0AE3D5C3ULL},
-  {0xADEE9D63D01B2396ULL,0xA2CF15009E498AE7ULL,0x27561506E4557433ULL,0xB9C398F186806F5DULL},
-  {0xFF1822F5D1F30E79ULL,0xC076329C75146BC6ULL,0xB3CA6265F9400779ULL,0xBEBC47511ADE7308ULL},
-  {0x3B01E1E9056B8C49ULL,0xC26BFAE84FB14DB4ULL,0x81A78D93EC96FE23ULL,0x02972D2DE4F8D206ULL},
-  {0xDFD6E3F50E7DA3ACULL,0xBB5B10F4BD8AA51EULL,0xEE7A347A5E4681F9ULL,0x76D458642A2C93ADULL},
-  {0x35F5642483B25EAFULL,0x01AA132967AB4722ULL,0x98088A1950EED0DBULL,0x80FC06BD8CC5B010ULL},
-  {0xB745BC318A51AB04ULL,0xD9D7268126C76A16ULL,0x5A096EE637EBED3BULL,0xD505700C51D860CEULL},
-  {0x1AA01F56430BD57AULL,0xA65EED4CBE7024EBULL,0x26E66BAD7FE72F70ULL,0x1C38303F1CC5C30FULL},
-  {0x9A9A2E83124A7899ULL,0x55B03158202A9D3EULL,0xE34E7A1009F87251ULL,0xEB9EF6C031EED31DULL},
-  {0x02D499EC224DC7F7ULL,0xBDC59EA10C70CE2BULL,0x09559E0D79269046ULL,0x0D0E3FA9ECA87269ULL},
-  {0xE531C573CDA9B5B4ULL,0xFAE4DB40801A2572ULL,0x134AC7C1D371CFFBULL,0x07B158F244CD0DE2ULL},
-  {0x063465B521409933ULL,0xBC4345405C520DBCULL,0x9966F21881FD656EULL,0xEECF41253136E5F9ULL},
-  {0x1879A7CABF06FB68ULL,0xA1D1F34761C6CF26ULL,0x2DECBAB8D098A8C2ULL,0xDB2BA972802D45FDULL},
-  {0xB653052A12949C9AULL,0x54C3F3AFBB5B6764ULL,0x8B3081B0512FD62AULL,0x758F3F41AFD6ED42ULL},
-  {0x517AB5C246242203ULL,0xD0A986928AC79972ULL,0x6BE1883B362F123BULL,0xBD8E9DC301D9ADC9ULL},
-  {0xBE8EB3C7671C60D6ULL,0x96C95330D97077CBULL,0x0A08266E9BA1B378ULL,0x958EF42A7886B640ULL},
-  {0x498A2F7805A08668ULL,0x3A496A3A3BF8EC34ULL,0x592F579074B875A0ULL,0xD50123B57A7A0710ULL},
-  {0x1A117DBA703A3C37ULL,0x9EB5FBEB0598E4FDULL,0x4DA1F32DEC2531DFULL,0xE0DEDC9B3B2F8DADULL},
-  {0x50BD28C17C470134ULL,0x151B423EAC4033B5ULL,0xA0EBA45A7A41876DULL,0xC39D07337DDC9268ULL},
-  {0x1CB377B01AF7307EULL,0xC622E27C970A1DE3ULL,0x43114306DD8622D7ULL,0x5ED430D78C296C35ULL},
-  {0x30B83FD19ADC87CDULL,0xC7048846D46ADE00ULL,0x4C16662FC134FADCULL,0x7ED520327080A9FAULL},
-  {0xD6579962C4E31DF6ULL,0x2A6C53C26E5CCE26ULL,0x13D206FCDF4E33D9ULL,0xCEDABD9B82203F7EULL},
-  {0x90F3743D00FDAEFBULL,0x422CC82409D50796ULL,0xAE4D91EB555010AAULL,0x25A5208B674BFD4CULL},
-  {0xC32F908318A04476ULL,0x5F4FA9B7962232A5ULL,0xA41B643FA5E46057ULL,0xCB474660EF35F5F2ULL},
-  {0xF216512417C9F6B4ULL,0x4F7CE5C6FC73A6F4ULL,0x525A3E7DBF0D8D5AULL,0x5BEA1FA17A41B115ULL},
-  {0x4B0BE9475A7E4B40ULL,0x5AC6BE74AB5F0EF4ULL,0xA693B03FCDDBB45DULL,0x4119B88753C15BD6ULL},
-  {0x99025EC62B034E02ULL,0x64558508362BC5FCULL,0xACF931BFBD9C32A2ULL,0x9403D11A2B419EDAULL},
-  {0xD9E76F302C5B9C61ULL,0x4ECFC061D57048BAULL,0x3D1D5E590F78E6D7ULL,0x091B649609489D61ULL},
-  {0xB54E3D341904A1A7ULL,0xA7CC69244F295166ULL,0x042DAD154E1116EDULL,0x1124EC11C77D356EULL},
-  {0x0C5D98093C536683ULL,0x23EE33D0197A695DULL,0xB3CD0ED304EA49A0ULL,0x0673FB86E5BDA30FULL},
-  {0x5B04403DB9581A9FULL,0xD60282D32ADFCA55ULL,0xF055520D4DB8C49FULL,0x4E7B5DABA34FBCF9ULL},
-  {0x67002AF4920E37F5ULL,0xA5A2283993E90C41ULL,0x40C0AA58379A3CB6ULL,0x59C9E0BBA394E76FULL},
-  {0x4DC37EFE66831D9FULL,0xC522FC54811E2F78ULL,0x7AD928A0BA5392E4ULL,0x5CB3866FC3300373ULL},
-  {0xA4A797F86E80888BULL,0x21FB8090895138B4ULL,0x2E17446E204180ABULL,0x3B952D32C67CF77EULL},
-  {0xE3071C74B063C5E1ULL,0xAA2C8068F1845197ULL,0x92999EE9C438D47EULL,0x6F6F0E0784EADA9FULL},
-  {0x17B8C45CF2BA2417ULL,0xB157222720EF9DA2ULL,0x5F862B785DC39D4AULL,0x55EB2DAFD84D6CCDULL},
-  {0x4FF98B2AAE170CF8ULL,0x0A0D0E6436DA1675ULL,0x4173867AB5324BE4ULL,0x49BA3203048E06D8ULL},
-  {0xCDC706AB7399A868ULL,0xC13C66C0D17A2905ULL,0x61E8CEC030C89AD0ULL,0xEFAE9C8DBC141306ULL},
-  {0xA2043E7791C51BB7ULL,0x56EFE24D228BFE6EULL,0x0DE652A340600C73ULL,0xECF9665E6EBA4572ULL},
-  {0x6D003AFD41943E7AULL,0x5B29C094DB2A2314ULL,0x988D00BCF79AF25DULL,0xE38DA76DCD440621ULL},
-  {0xF9DDC14E86BE1EBFULL,0xFAD3DA15D691EFA4ULL,0x462E21F336A8971DULL,0x3F1D72D253A01DFCULL},
-  {0xBC2FEDED498FD9C6ULL,0xC8CD5AA667A15581ULL,0x9A93B0E6F35CFB40ULL,0xF98A3FD831EB2B74ULL},
-  {0x9D3A95324E543C49ULL,0x9AFD48BBC2A2CFB4ULL,0x74EAA876AA416CF5ULL,0xCC26479830E10370ULL},
-  {0x2C924F97CBAC5996ULL,0x97584A65FA06CEDDULL,0x8DCC887980DA38B8ULL,0x744B1152EACBE5E3ULL},
-  {0x7F6BF255F1337FF0ULL,0xB2F75AB36207E155ULL,0x108C0A99D567FBA9ULL,0xBDACD9A05FB9FB73ULL},
-  {0xD85E216C4A307F6EULL,0x42CE739A7919798CULL,0x0F4EA6CE648309A0ULL,0xC534AD44175FBC30ULL},
-  {0xEB13F199399F4EC9ULL,0x90F3408491C470B4ULL,0x2E754603B426BC0DULL,0xEC93E49C88FC8565ULL},
-  {0x0778419BDAF5733DULL,0x6949E21A6A75C257ULL,0x63BF4BC808341F32ULL,0xE13817B44EE14DE6ULL},
-  {0x53013EAFA44EE737ULL,0xFE6043C9DD68844EULL,0xE0FE953A8EDAA929ULL,0x38A9743B4BC299E9ULL},
-  {0x37A48B57841163A2ULL,0x8D1E4E350B6CBCC5ULL,0x224B967C3020B8FAULL,0x30E93E864E669D82ULL},
-  {0xC128B757CDD92ACBULL,0x358EB4E66A331B76ULL,0x9C4D07D56A198DECULL,0x21868874CC2CB5A7ULL},
-  {0xCBBA2CAE5347D57EULL,0xDF9154EFBD2EF1D2ULL,0xD5D28A3224B1BC25ULL,0xE491A42537F6E597ULL},
-  {0x0E5EC95EE2A1ECEEULL,0x420E76859E59E54EULL,0x64EF68644823BE8AULL,0x90E9991A7304206AULL},
-  {0x60AFA5B29DB83437ULL,0x12507A051F04AC57ULL,0x0D5C1FC133EF6F6BULL,0x100B610EC4FFB476ULL},
-  {0xA7ED795B923B9722ULL,0x7AE69493FDA866F8ULL,0x4653A557449FF8B2ULL,0x9807DA341A297EE8ULL},
-  {0x7E7D15A0DE293311ULL,0x6039E77C15C2378BULL,0x8E1652C48E8127FCULL,0xEF0AFBB205620544ULL},
-  {0xE3AB823D6581CC28ULL,0xAF9915F0377906F1ULL,0xCB32648C493AF7DEULL,0xA24D6D07EDE1CEDEULL},
-  {0xAFB34DB04EEDE0A4ULL,0x3C2AD46290358630ULL,0x89C5E9BE8F9508AEULL,0x8B378A22D827278DULL},
-  {0x4C481324A6C8912BULL,0x5D6406CBFCD76E17ULL,0x34DB14F93706891DULL,0x6E638DF7A9105BBCULL},
-  {0xCC06E2A404078575ULL,0x896878F5282BE4C8ULL,0x0914448C6CD9D4CAULL,0x68651CF9B6DA903EULL},
-  {0x75D5E1F0201F1DEDULL,0x823AC662E052FA27ULL,0x2AAF43C6B4E4EBF1ULL,0xD03CE0B8EF7AA8AAULL},
-  {0xC54673BC1DC5EA1DULL,0x3E1EF8E0201E4578ULL,0x485A4D8B8DB9FCCEULL,0xF5435A2BD2BADF7DULL},
-  {0x79B16D545167625EULL,0x8935E6D57F30002AULL,0xC5339C7D978E3B74ULL,0x1D1D201C7C29525CULL},
-  {0xFC37BBE9EFE4070DULL,0x434800BACEBFC685ULL,0x34F5137B73B84177ULL,0xD56EB30B69463E72ULL},
-  {0xCB0289E2EA5F404FULL,0x9501253AA65B53A4ULL,0xE90B9C08485D01B3ULL,0xCB66D7D7296CBC91ULL},
-  {0x19212D39C197A629ULL,0x641462A54070F3D5ULL,0xB2E90737309667F2ULL,0xEDD77F50BCB5A3CAULL},
-  {0x654F3EE5C9E6C1C2ULL,0xB6F36B14FBF54AD1ULL,0x6EC19E9CE26AE4BDULL,0xC80F1D852659B418ULL},
-  {0xE43D06D77D31DA06ULL,0xA38289154964799BULL,0x88B430A69F53A1A7ULL,0x0A855BABAD5CD60CULL},
-  {0xFCE17AD5E335286EULL,0x97BD17BE084895D0ULL,0xDCDA5E8A7A1F87BFULL,0xE57A6F571288CCFFULL},
-  {0xBD80F0B1286D8374ULL,0x871EC5A64FEEE685ULL,0xFFD1F04788C06830ULL,0x66DB656F87D1F04FULL},
-  {0xC7032F99470BEF44ULL,0xDFEFDEFD1262BCA4ULL,0x7F86709D01D2B66EULL,0xFAE7BC16185FC1A6ULL},
-  {0xC5321857BA73ABEEULL,0xD57F1CEEB487443DULL,0x54BD46F730174136ULL,0x09414685E97B1B59ULL},
-  {0x0E6DB815548473CCULL,0x99AC0B24E3A90C27ULL,0x0B7F1C9750E28AFEULL,0xA20C096CF36367BFULL},
-  {0xD8C2962A400766D1ULL,0xF4B08D3C07B27FB8ULL,0xF73AF4544CCCF6B1ULL,0x4CB95957E83D40B0ULL},
-  {0x2F80FD5DC15E76BDULL,0x9A859739BEA9B37EULL,0x9297FF08E74DF0BDULL,0xB4D0E7EF521C1C81ULL},
-  {0x411E0315EAA4593BULL,0xFF15DB5ED3C049B3ULL,0xE1010F337AD4717EULL,0xFA77968128D9C92EULL},
-  {0x21EAEF2C7208E409ULL,0x6A8FEDC6F9E8EAD4ULL,0x806527D1DAF1BBB9ULL,0x2D114A5EDB320CC9ULL},
-  {0x118D14B8462E1661ULL,0x2E6DAC9E6F26E961ULL,0x9CCD3D7915B9E1DAULL,0x5F3032F5892156E3ULL},
-  {0x21EE1BAEF2BB04CDULL,0xCD14D9DD764D4726ULL,0x6AF5B9DD4A6600D7ULL,0x9AE0247B2342180CULL},
-  {0xB39847B3CC092FF6ULL,0x2EEE1FF50C986EA6ULL,0xCBDDDCAE0AA44254ULL,0x8EC0BA238B96BEC0ULL},
-  {0x1E786104F47797F0ULL,0xAE93A0BAE7389730ULL,0x54A9B4BF719F02DFULL,0xE5F28C3A044B1CACULL},
-  {0xEBAAC479EC1C8C1EULL,0xA446989AF04C4E25ULL,0x4C5F37E0ECC5F9F6ULL,0x8DC2412AAFE3BE5CULL},
-  {0x3B98E9611F5DC208ULL,0x90AB454E65E5EC9EULL,0xBC306C9B6C15494AULL,0x646FA5B5FCDAD2D3ULL},
-  {0x9626778E25B0674DULL,0x9D58186A50E49713ULL,0xD0E8C2A7CA5804A3ULL,0x5E4631150E62FB40ULL},
-  {0x5D4E075E32808785ULL,0xED8BD517407373FDULL,0xF656A354B9C92684ULL,0x28312A55765D0435ULL},
-  {0xB18041024EDC07DCULL,0xD784869D7E6EA67FULL,0x19A528391C994624ULL,0xF65F5D3E292C2E08ULL},
-  {0xF58513F8FB152BCEULL,0x19E16B89CE982871ULL,0x3F876FF45961A83CULL,0xA26BECC5EA1819D3ULL},
-  {0x62B675F194A3DDB4ULL,0xFA1FBD583C064D24ULL,0xD5404795539A5E68ULL,0xF3E0319169EB9B85ULL},
-  {0x94A0753A915B644CULL,0x42425D84290545F2ULL,0xD0D6E193AAAF5A56ULL,0xD6B837116FA89FA1ULL},
-  {0x55F4B031880D562CULL,0xF925CE30D767ED6EULL,0x39BA7F075E36BA2AULL,0x42242A969283A5F3ULL},
-  {0x3E6EC481A8991472ULL,0xB8A5FFBEB480BA0EULL,0x63FD238833A12188ULL,0x00995E555C8AABD2ULL},
-  {0x10026DBD2D864E6BULL,0x23FC63B65B35F86AULL,0x7E4B4A7140737AECULL,0x204B5D6F84822C30ULL},
-  {0x7048C13FEB4785F6ULL,0x1A652CB086EE45D5ULL,0x1AAA132D75F7515FULL,0x672BD987C7E383BAULL},
-  {0xED16E96B58FA9913ULL,0xD5CAF9450F34BFC0ULL,0x49D245B328984989ULL,0x04F14351D0087EFAULL},
-  {0xEB09520A981FDF32ULL,0xA81EFA6B414A583EULL,0xB290CF45325AF0B4ULL,0x9E2599B420982535ULL},
-  {0xE7A36DE01A8D6154ULL,0xE62562D6744C169CULL,0x1904F9A1C7543698ULL,0x073867F59C0659E8ULL},
-  {0x8491067A73CC2F1AULL,0x55DF16C3E8F8B681ULL,0x3F6619D89832098CULL,0x5D9D11623A236C55ULL},
-  {0x161384C746012865ULL,0xA99C9AED7D8BA38BULL,0xEEBFC71181313775ULL,0x39F23F366809085BULL},
-  {0x7D5FA49229D31669ULL,0x306A0A11FDD22B0DULL,0xAE6FAE38ED6D2EC4ULL,0x0065A58128F755AFULL},
-  {0x6FD51CF5694C78FCULL,0x56EA13493FD563E0ULL,0x164227B085C9AA94ULL,0xD2424B1B1ABE4EB8ULL},
-  {0xE9002DCCB1AF50CEULL,0x43DDF472FBB16491ULL,0x29CA19B9110C315BULL,0xB227F7D021263C6FULL},
-  {0xF3DCDCABD2FDA224ULL,0x91F7AB1410CD1E0EULL,0x99252129B6E56B33ULL,0xEAD12168595FE1BEULL},
-  {0x17C5DE9E6F3AA216ULL,0x879B9AB8E9B75D4AULL,0x11263A75D9328A1CULL,0x8F8C3EEC190DF3D1ULL},
-  {0x58A47A9129CDD24EULL,0x503D459C3E898458ULL,0x44E654AEF624136FULL,0x6FDCEF09F2F6D0A0ULL},
-  {0x369EE69A35B4AF25ULL,0x8BE2FF17F252CEBDULL,0xD2946AF2A8737BB6ULL,0xBAB2192B75324599ULL},
-  {0xE33A7D2057F3B3B6ULL,0x2306D320F1D03010ULL,0xA9C8ED618D24EDFFULL,0x060660257DD11B3AULL},
-  {0xFEB77705FC25F516ULL,0xE17549340A46831AULL,0x4286AE3F103A2074ULL,0xF46BFB389FDB7CE4ULL},
-  {0xC6FED3C35E999511ULL,0xFCAFAD1895D7A633ULL,0xF39048F25A8847F4ULL,0x3D98A9CDD026DD43ULL},
-  {0x5530A39D2E8D7639ULL,0xB34905A2087E6A25ULL,0x57337B85CCACBB62ULL,0x5AF11032704E83D0ULL},
-  {0xCD2876EB2A27D84BULL,0xDA61DC861C019E55ULL,0x6E2D8862179139FFULL,0x0B4C4FE99C775A60ULL},
-  {0x786EF55EBE29887EULL,0x2ABE221A176D0E2EULL,0xE8842C4BFD67C46CULL,0x202632E371066766ULL},
-  {0x50F049503A296CF2ULL,0x6B72DA1834AFF0E6ULL,0xEC4B19D917A6A28EULL,0xAE434102EDDE0958ULL},
-  {0x7EF1DC6418717DECULL,0xB9352BAAA63E144AULL,0xF64480E19393E90EULL,0x099A48E10ECFCB81ULL},
-  {0xB827CE62A326683CULL,0x422C086A63460502ULL,0x4B48F6D534CE5C79ULL,0xCF2174118C8B6D7AULL},
-  {0x8F163904BAD1C7CFULL,0x3E0012F6AF5C01DFULL,0xB92FD08559EE2A71ULL,0x17C4D13C535BE360ULL},
-  {0x2CDEC417AFEA8FA3ULL,0x013F996887B8244DULL,0xC63DB50F1C0F1C69ULL,0x6FB8D5591B466F8FULL},
-  {0x6D5C41A70C1E9FDBULL,0xE7C5F702206DC0E8ULL,0x598A5284FC790673ULL,0x04ABCDD05201E8BDULL},
-  {0xCFD652188A3EA98DULL,0xB7D4494BC2823700ULL,0xCFBFE369F7A7B3CDULL,0x322AF4908C7312B0ULL},
-  {0x91475348AC0DCE51ULL,0xAFE9F96231D1D1C2ULL,0x5A75A2A70908F483ULL,0x82B83F8D79EC4B86ULL},
-  {0xF3DFBCDB71749700ULL,0x2520818680E26AC8ULL,0x2A034EAFD096836BULL,0x6749E67C029B85F5ULL},
-  {0x266E2D163FC83D99ULL,0x0E2268C7D1679757ULL,0x0FC534D42AECC459ULL,0xA54B0056FBEB471BULL},
-  {0x3420A72EEB0BD6A4ULL,0x0DE97E4874F81F53ULL,0x16217F07BF4D0730ULL,0x2AEABE7E45315101ULL},
-  {0xBD249EEB28A2FEA2ULL,0x9FABF3E9A060BD70ULL,0xE74E6B0C79B53775ULL,0xA049B1F4EEFC6732ULL},
-  {0xEEE98F1A4BE5D196ULL,0x1FF0B053D25CA2BDULL,0xA60FC4775460C790ULL,0xB0EA558A113C30BEULL},
-  {0x65A2B31F88196C47ULL,0xBAB1D00DB0DBC03AULL,0x189B5D017F8FDB76ULL,0x6DB068BBF5499243ULL},
-  {0xC5767BEA93EA57A4ULL,0x4FF536B01B257BE4ULL,0x289D5833A7BEB474ULL,0x998C74A8CD45AC01ULL},
-  {0xC121316A8DED4293ULL,0x87A558DADAE0C580ULL,0xDE8682090B6EC098ULL,0x51559BE325B4D6D6ULL},
-  {0x61F79CA4C81BD257ULL,0x0F9B8B9FDD270F66ULL,0xF9D4DE7396FC18B8ULL,0xB2284279995A34E2ULL},
-  {0x60AB5EFCE8FE4C67ULL,0xA8333FEA82BD1F12ULL,0x91E3531F66C0375DULL,0xF4A5B09543FEBE5FULL},
-  {0x940B74E3AC1F1B13ULL,0xF395B74FC4BCDC4EULL,0x1D1E0862DB347F8CULL,0xBDD46039FEED1788ULL},
-  {0x52C0BB205D654A9DULL,0x8209F6506FE4C0FFULL,0x6571DE2ED92BCC04ULL,0x36E7FF517AD79FABULL},
-  {0xBB8E0F45EB596096ULL,0xD9B925BB4A4B3A26ULL,0x9A2FB6242F1A43A2ULL,0x6F0A256BC5EFDF42ULL},
-  {0x7EB8538D1DA95407ULL,0x52BFE6A7B0DEAB60ULL,0x656DF2F95983CFF2ULL,0x74EB8317416FE8FDULL},
-  {0xC0E8649113DC3A38ULL,0x75B740DD098075E6ULL,0xFD4473E16FE1C284ULL,0xC359D6923BB398F7ULL},
-  {0xB35F4EDA136D08A8ULL,0x19B58FA4588CB4F5ULL,0x487708EBEB652D9FULL,0xA3BCD62645CEBA65ULL},
-  {0x9862AFD617FA9B9FULL,0x60CEB573C7060313ULL,0xB130619E2C0F95A3ULL,0x021AE7F4680E889BULL},
-  {0x4A6EFE1A786FCE55ULL,0x287D8F897B2B1B47ULL,0xA518BDC4C4E812E4ULL,0xC8ECC2845917B7FFULL},
-  {0x2689FF1E31C74448ULL,0x6D565AB687870CB1ULL,0x1C987F6ECEC92F08ULL,0x60EA7F61A353524DULL},
-  {0x6B71DF5B05C81AE8ULL,0xB6822F65E0A7A93BULL,0xC4BA2FBD12803A7BULL,0xA10CE6DB4859D825ULL},
-  {0x7FEA824B77DC208AULL,0x6673051B4935BD89ULL,0x9E78F07CE5680C5DULL,0x49B96715AB6878A7ULL},
-  {0x3592FC86703DAD66ULL,0xECBDE264616C3F61ULL,0x99A77F7FEABE8213ULL,0xC6BD3CDF50B11F93ULL},
-  {0xBB5E83037E0FA2D4ULL,0x5DB936156B9514E1ULL,0xC6DE6CAF2CB48956ULL,0x5CA560753BE2A12FULL},
-  {0x4DEF01604ED38E14ULL,0xD61A7EC68024807AULL,0x3F5624422BBC0ABCULL,0xE39A66553AC9F9D6ULL},
-  {0x0A94473693606437ULL,0xA5492144CC54BCC4ULL,0xA7A8B33A07783341ULL,0x7571D74EE5E0FB92ULL},
-  {0x3069D623B9FA4343ULL,0x54379BCDD800B82DULL,0xFCF5F25527302DF6ULL,0x6912A35BEB5035CBULL},
-  {0x42AD961409018CF7ULL,0xAC8DB17BF7A76A2CULL,0xBCB9736A828CFA7FULL,0xBE52D107BCFA09D8ULL},
-  {0xBFD1E93BF71E23B9ULL,0x81C36D5C8710BB68ULL,0xD84C22CDD600EF63ULL,0x6C8E5D14A501C926ULL},
-  {0x0F448A01C43B1C6DULL,0x0149EF0BE14ED4D8ULL,0x26B947AE2BCF6BFAULL,0x8FD64A14C06B589CULL},
-  {0x21AB2902DA0FF381ULL,0xC67205E31E72C170ULL,0x8ECC5E35E976F77EULL,0xB5CDCB48EE2CDCD6ULL},
-  {0xB24A8AC07200682AULL,0x8BB131C012CA542EULL,0x7433A4F18C61726FULL,0x39E5C9925B5A54B0ULL},
-  {0x449D42EE37E65FA4ULL,0x10770AD296A01AD0ULL,0x043E203FE3B8C422ULL,0xA213CBD11F2C882DULL},
-  {0xAE164E122A208D54ULL,0x89E127760AD6CF7FULL,0x30E30D6295853CE1ULL,0x62DFAF07A0F78FEBULL},
-  {0xB3FA2102457CF151ULL,0x9D4552D208E1E7E2ULL,0x87A3B97E37FD2230ULL,0x3140B915410C1212ULL},
-  {0xE7A76AAA49BD0F77ULL,0xDC6CC07DB2D60A9AULL,0x8733C38A1FA1C2E7ULL,0x25A748AB367979D9ULL},
-  {0x0B4EEBA071B0594BULL,0xCC12918983BF74F0ULL,0xEC1DAF204A51288AULL,0xE74D9C8F8463EA37ULL},
-  {0x16A83AE09A9A7517ULL,0xC390BDE74B4BBDFFULL,0xF9420BAB396793C0ULL,0xECFB7056CF1DE042ULL},
-  {0xCF85D393D3F2F8BFULL,0x2B1DE5B2D1D3BD8CULL,0xF9A51421B1549BCEULL,0x94DE12D051E62940ULL},
-  {0xF74B190DCA712D10ULL,0xC521A0959B2D80BBULL,0xDFEFA10C57FEA9BCULL,0xCD450EC335438986ULL},
-  {0xFCFCC8FC7C306316ULL,0xFAC71452A632431FULL,0x657CC56CF6E46AD1ULL,0xE662B869A22227B3ULL},
-  {0x8360990E2BFAD125ULL,0x4F729AC5308B0693ULL,0x40B9B48728473E31ULL,0xF5C54754A8F71EE5ULL},
-  {0xBBC027380762CEF4ULL,0x0BE040A8C062B742ULL,0xF6F2928340E28465ULL,0x912770E068008032ULL},
-  {0xE85F44100099223EULL,0xA0A7CD8A9411131CULL,0x0609AF3ADD26CD20ULL,0x6CB9A8876D9CB852ULL},
-  {0xAEE700EA6C6AE32FULL,0xFC9ADB6C57D54C9CULL,0x495BA885D9B8B819ULL,0x836ED454D94C9199ULL},
-  {0x2570D55646B8ADF1ULL,0xAC2B9DA568D6ABEBULL,0xC5D624114BF1E91AULL,0xFEF5A3C68059A6DEULL},
-  {0xBC8F0186CCF45C5AULL,0xA25F0CBD2A296656ULL,0xDCAE9BD97378BD4AULL,0xD67286B1D5716401ULL},
-  {0xE5430DA0AD6C62B2ULL,0xF49AE3FA15B96623ULL,0x43D94CCC670D0F58ULL,0x1ACB250F255DD61CULL},
-  {0x8CF83C556D73AF84ULL,0xBF27585F4B1AC1EDULL,0xDC34A72350EA5D40ULL,0x907308B0980C45CEULL},
-  {0x003E945A1216E423ULL,0x8CF0D34FD4191614ULL,0xB19F77D41C1DEE01ULL,0x5F310D4B3C99B9EBULL},
-  {0x9C0B605BA95832A5ULL,0xFA92C34B1F38C89FULL,0xB1373FBBA578001EULL,0xFD6381EAF29657FDULL},
-  {0x4740D098CED1F0D8ULL,0xC1D2942114E2EDDDULL,0xA5C440C38ECCBADDULL,0x438136D603E858A3ULL},
-  {0x1F5262F7887B72AFULL,0x4519A730A32E2265ULL,0x413BD16E1749EE18ULL,0xEF9A8BD1525F4864ULL},
-  {0x30E2E7F463036758ULL,0x4BCF50FEE51D7CEBULL,0x26BAF44FB84EA4D4ULL,0xCDB559EEDC2D79F9ULL},
-  {0x25C560257BE95BDBULL,0x01FAAF5675484185ULL,0x75BB7A8E714E885EULL,0xEC8598C45D39F0E0ULL},
-  {0xE924B69D84A7B375ULL,0xB3180C902875679DULL,0x23EBAF66A6DB9F57ULL,0x0C3B997D050EE5D4ULL},
-  {0x350D54CFE47BF50BULL,0x4F3003EFE1B2802CULL,0xF4C888520BD33955ULL,0x9D0A6B077D71CC3BULL},
-  {0x70E07BFD9CCAFA7DULL,0xF342C8591F1DAF51ULL,0x22C2CA280C682862ULL,0x6D89AD7BA4876B0BULL},
-  {0x99951E3ABC733DE8ULL,0x2937844E0E25D532ULL,0x2E562E2BED4F8838ULL,0xE2B99ADFEC86F877ULL},
-  {0x80EF4BFF637ACAECULL,0xDAFF7BB67B103E98ULL,0x3B15389A5F6311E9ULL,0xCA5EF7D4B231C94CULL},
-  {0x09CDA7F01E8BFC2BULL,0x847A414A8455218DULL,0xBD7DF32296A9FC38ULL,0xE0C2821689A92635ULL},
-  {0x62A5B132FD17DDC0ULL,0xB3EE1B40D60DFE53ULL,0x084D37C6E7542006ULL,0x09731141D81FC8F8ULL},
-  {0x2DBD7A76B1B9C8B9ULL,0x7FD5A3AE8BA8B4B1ULL,0x64FE48656B101B58ULL,0x3CBF5C99286222F4ULL},
-  {0xA497237794C8753CULL,0x73BB80547AE2275BULL,0x2EFC3896EE28260CULL,0xEE1849F513DF71E3ULL},
-  {0x48E525620A13060CULL,0x5226C0D3CF24C4AFULL,0x1F8D4A3E21ACE469ULL,0xF7CE91842E49E9D4ULL},
-  {0x8641ABCB005CC4A4ULL,0xADDEA9E36122D2BEULL,0x7A62DF062736EB0BULL,0xD3AA2ED71C9DD224ULL},
-  {0x2A3619AD0DE244E9ULL,0x041EAE9F117B3E34ULL,0x2BEBEDE498E028D8ULL,0x15276D9145B9BCAFULL},
-  {0x2390426B2EDD791FULL,0x34EF0D7906631C4FULL,0xA5D01AC5E6AD3307ULL,0xC4E1020916980A4DULL},
-  {0xC90774F6BAA7E834ULL,0xB25E0A780FDEA14EULL,0x1DA077543CE0B7F1ULL,0x03E6B5491EB5219DULL},
-  {0xBDA47AE5A0852649ULL,0xC1732F2B84B4E95DULL,0x776F22C25FB8A3AFULL,0x67163E903236289FULL},
-  {0x62F3B896E8369787ULL,0x81C434D346DF5E0CULL,0x2AB27141690AB859ULL,0xC98998BE4C613A7AULL},
-  {0x3FA20EFCDFE61826ULL,0x0CF71872E7D0D2A5ULL,0xB2F0CA647C718A73ULL,0x0CD1BC7CB6CC407BULL},
-  {0x716409CC8BAB85AEULL,0x64D28821559FCEDCULL,0xB40A81E852827B8EULL,0xCA7A42DAF8694C62ULL},
-  {0xE09EECC69E0D38A5ULL,0x70DB57DA0B182259ULL,0xEDF43B257004580BULL,0x299D21F9413F33B3ULL},
-  {0x6F63F4CEA8C95157ULL,0x172D3056112776F0ULL,0xDE776FEC3B5892C1ULL,0xD313F3CDD7CDCC16ULL},
-  {0x2FC416910B3EEA87ULL,0x82E14F4535359D58ULL,0x68E99016C0597077ULL,0xF9429E738B8E53B9ULL},
-  {0x2DD668C1FD617CC6ULL,0xF1F902C744E425BDULL,0xAA11B1AB6F7EC0F3ULL,0x28B6D7837004120FULL},
-  {0xC695A559EB88DB7BULL,0x0A878D35DA70740DULL,0x8499350113BBC9B1ULL,0x462F9BCE61989863ULL},
-  {0xDF02760AEA9E0A2CULL,0xF80BEB233DBD9DF7ULL,0x0DFCAEF6A82B9C7CULL,0x60F803C2B44D43A0ULL},
-  {0xD5558ED72DCCB9BCULL,0xB1C61090905682A0ULL,0x8573D48A74E1C655ULL,0x62188BC49D61E542ULL},
-  {0x1FCA864423D1C1BEULL,0xD00E3228BF1EB99DULL,0xC2A5BC741DEEB71AULL,0xC130794479F2BB77ULL},
-  {0xD902A6D13037B47CULL,0xF1065224F72BB9D1ULL,0x5C71A3F9D7992038ULL,0x7C10DFB164C3425FULL},
-  {0x63ADD999D2F95BB3ULL,0xEFDD509A19C63E56ULL,0x77559BDC7F1017D1ULL,0xB52974A37A1C5E94ULL},
-  {0xD3AEA1454E3A1D5FULL,0x3B3CDC6FAA3088C1ULL,0x744A655B2DF8D5F8ULL,0xAB8C1E086D04E813ULL},
-  {0x7DC74CEC622A5995ULL,0x91930CD46322A119ULL,0x8D859B3982343DEAULL,0xC8EED15DFA36BCA2ULL},
-  {0x8955E8592F27447AULL,0x1693465C2240480DULL,0x111A13CC1D4DD0DBULL,0x4CB04437F391ED73ULL},
-  {0xDF71E1ABDCFD8FB6ULL,0x7C0834F9544168FCULL,0x30C621E8AAB586A1ULL,0xC4071FD9F1B90283ULL},
-  {0x4B10DC14D125AC46ULL,0x64F8CDD7DF0ACA61ULL,0x2A10F0303417C6D9ULL,0xBD1AEB21AD22EBB2ULL},
-  {0xD7F4590701E5364DULL,0x4EEA355D9DABD94EULL,0x59320A356230569AULL,0xB126363AA4243D27ULL},
-  {0xB79992671EF7CA7FULL,0x26B80C61FBC97508ULL,0xDF3A311A94DE062BULL,0xBFEFACDB0E5D0FD7ULL},
-  {0xFB5F8AB6E7820CA8ULL,0x41DBAFC6ABD04730ULL,0x0191AB6DCC8F0E90ULL,0xBA0D2F3AF20D9692ULL},
-  {0x03A5BD567F32ED03ULL,0x24ED291E0EC67087ULL,0xF2B25FE1DE289AEDULL,0x603C12DAF3D9862EULL},
-  {0x3112844DCAB0AF01ULL,0xF8CBA1B16A19B8F2ULL,0x58643C3FEB2CFAC6ULL,0x63DAD3922E66CDFBULL},
-  {0xD5737FD790E0DB08ULL,0x093E0968942E8C33ULL,0xD6193D83631BBEA0ULL,0xCC6157EF18C9C63CULL},
-  {0x4E44DE8E79598A01ULL,0x64782B5A3885AB58ULL,0x8C9CBAFEE51F97A0ULL,0xFC822D5EA0C68B76ULL},
-  {0x17714D9977A22FF8ULL,0x6290D0E0F19CA73FULL,0x6C8F39E7F311D317ULL,0x553E04F6B018B4FAULL},
-  {0x906E54680127FF92ULL,0x60AC69C82044E8E5ULL,0x689F232541C04105ULL,0x27015DC47DBFE781ULL},
-  {0x9E2FBF2629008373ULL,0x9FFD7C8EF35A3850ULL,0x9003A3481FA7762EULL,0x0712FCDD1B9053F0ULL},
-  {0x0D86E5C8718A3051ULL,0xE476ADD5CF739174ULL,0xD2A203D8EEDC863FULL,0xDD81B694EC3A60BAULL},
-  {0x7B47834C1FA4B1C3ULL,0x9AEFD31F4EEE09EEULL,0x7D270B4878DC43C1ULL,0xED8CC9D04B29EB87ULL},
-  {0x7863AC2A068F7866ULL,0xE22E369309AC3C4EULL,0x0C0AB2C94A8E89E6ULL,0x5CC678A31A3B536CULL},
-  {0x3CA4726586A6BED8ULL,0xD7EFC22151346E1AULL,0xFD0B86FD2B39A868ULL,0x9852390A99507679ULL},
-  {0x0B08824DF1978EA2ULL,0x43590D98E54E5678ULL,0xFD37E43C0D6230C6ULL,0x1A9CF6CD7C7AD92AULL},
-  {0x5EBFA5F3F8E286C1ULL,0x3D096CCC54963E6AULL,0xB76B061927FA0414ULL,0x9E994980D9917E22ULL},
-  {0x69394D2089481E75ULL,0xC6DDCC39676E2EA1ULL,0x19CF1C838C69253CULL,0x1B33A3362BC07380ULL},
-  {0xD3394119DAF408F9ULL,0x2708B26B6F5DA72AULL,0x89353F77FD53DE4AULL,0x4036EDC931A60AE8ULL},
-  {0xD31B6EAFF6E26CAFULL,0x62D613AC2F7B17BEULL,0x5E8256E830B60ACEULL,0x11F8A8098557DFE4ULL},
-  {0x442C76E92FCF91E6ULL,0x5EE050B27BBD9681ULL,0x87F21145D9E2936BULL,0x753C8B9F9754F18DULL},
-  {0x670105671ECF4C22ULL,0x095140C110369125ULL,0xAB7CB0603361373FULL,0x3074AC60FAD0D25EULL},
-  {0x23ABD4483AA79C64ULL,0x73B871A702B4CF61ULL,0x18B495B891D3B1B5ULL,0x86CA160D68F4D4E7ULL},
-  {0x05F020B5823776EDULL,0xEE73B364BC6F8821ULL,0xC7A234CB4ED191A3ULL,0x48401D84E98487A2ULL},
-  {0xC300C513C247759DULL,0xEDD0F30E3C45B85DULL,0x5B57B6A3CFAD6863ULL,0x8147CBF7B973FCC1ULL},
-  {0x801C5B765D3B35C8ULL,0xA759E43A8CB39A51ULL,0x0255E0C1DDB7FE14ULL,0xF50879C337A4448EULL},
-  {0xDC287844F1A29574ULL,0xAF949AE650213921ULL,0x58ADBE56C27B470BULL,0x31B3CA455073BEA5ULL},
-  {0xF8068D673A214B38ULL,0x32796D75D322C4EFULL,0xF49F4F820A9742B9ULL,0x27E8E8AE38C05BCBULL},
-  {0x0CBBB893F652F50FULL,0x10BD3A60DD7A1687ULL,0x5714626D8D67D561ULL,0x57FC24472225B23FULL},
-  {0xB0B382ED77E96A61ULL,0xBF488169E80CD350ULL,0x413AB4F836F946D5ULL,0x46BED1F49F992432ULL},
-  {0xCC593FA494B33482ULL,0xEE4E92E0156B3C70ULL,0x4617C73CA77040E4ULL,0x844ADB5CE7D10DE9ULL},
-  {0xE230590CEE79327CULL,0x510F537BFA0CB158ULL,0xFFB2B1CFE1233D83ULL,0x31A7BC3A4AF61F84ULL},
-  {0x057AD22E2F2454A2ULL,0xA73538074B44FF27ULL,0x2F77872225627D80ULL,0xD765466C6E556E35ULL},
-  {0x5EBD43288FC1B3C0ULL,0xF35317B8A2104D98ULL,0xCDEEDA144CC7BBB9ULL,0x7D155E9E6F356436ULL},
-  {0x77F53C946E7BD648ULL,0xDA811844236A4C43ULL,0x812605E50D8B752CULL,0x77B1F0687CFCDBE8ULL},
-  {0x7516B51563EE2043ULL,0xB4548DA9925A056AULL,0x3CE267208D0461ACULL,0xB9A6C10D32C12D52ULL},
-  {0xDCE94E329222550CULL,0x9BFB77D21CEF371DULL,0xEB27FA26A9035B66ULL,0xC16F60C7C11FC3C9ULL},
-  {0x98BB807F8098E148ULL,0x26B1571282CCEC92ULL,0xB41FBE317B921BACULL,0x67171E0EA011FE7EULL},
-  {0x4C25112A86988EFDULL,0xD742E8CAA6DE7811ULL,0x5CF6C2437FDD94BFULL,0xE1BCFE7FC8ED8AE9ULL},
-  {0x8F0690447A9CBFF2ULL,0x17466C022B7350B3ULL,0xDFAB050FD5A6F8E7ULL,0xFC9302B326CEBA4CULL},
-  {0x43FCAE81D2D0EA0EULL,0x0FE8529F7173F589ULL,0xFD8883363D37BEE7ULL,0x8D6857C9D08EF7B4ULL},
-  {0x2B18F3FC3FD52680ULL,0xB1B0E979C8791662ULL,0x55991494E317BA38ULL,0x7C83A291AAE1902BULL},
-  {0x54F583888917BE80ULL,0x2B601BD5ED952F78ULL,0xF996BF6B96EC3496ULL,0xDDF1B9FE8744AD03ULL},
-  {0x50650BE0D3F64D1CULL,0xB701323C2A8577B0ULL,0x6DDDD83D95565B00ULL,0x83641FC5398FCD2CULL},
-  {0x01D0E60E47298A9DULL,0x716BC5E0A6B063B3ULL,0xAF6F04DC61E7AE64ULL,0x3F27E7E1834F1A61ULL},
-  {0x2B9F0816CC2FB2CFULL,0x11B8EF2753D15CE2ULL,0xC44B46CD3E96FC29ULL,0x9FFA08D3A62870EDULL},
-  {0x2416DB785AAEDB3FULL,0x0D579517F5BDC3ABULL,0x9F53FBB235EB1E89ULL,0x50BC23F3926CD0C4ULL},
-  {0xE7F18D0C73FE9D1AULL,0x60E484DE8D931EB1ULL,0xBC3B0E048C47E447ULL,0x76E5D7F434FD7E3DULL},
-  {0x9AB249309A185187ULL,0x0527EFBCE7D8B3A3ULL,0xF866C25C7CA5DD78ULL,0x6E6AEE6C9625370AULL},
-  {0x4E66FEBD43FF0440ULL,0x150334D56C3759DDULL,0xDFD0C1BD2999FD38ULL,0x3CD961A34D4043D0ULL},
-  {0x7019BC4135174870ULL,0x5D699FCD81CF23CEULL,0x827C296504198139ULL,0x986314EF75B68FB2ULL},
-  {0x92F4CEE44D1EB30DULL,0x320407D9B809EA3CULL,0xD268871D155F962FULL,0x3749971FA9407E8CULL},
-  {0x44D2DDF9E3E469C0ULL,0xE0A44D254728D2C5ULL,0x5DE4B22DE1BE2C52ULL,0x4E31EA12AC607D07ULL},
-  {0x087C5AD1E6804CAEULL,0x7863343EE7CA7DC4ULL,0x42F1DADC91E234C3ULL,0x56F002247357133FULL},
-  {0x17E94AFD8E9D2BB0ULL,0x907F2636762E8D5AULL,0xE24C27926F16CAD2ULL,0x94264621A5960E0EULL},
-  {0xB88F3D8D50F06CDBULL,0xB594D996F925CE68ULL,0x729BE2440345537CULL,0xFED1845E2EAC4276ULL},
-  {0xEF87DDD65D7303C9ULL,0xFF8FBD1E0682F7F1ULL,0x34E3D6BEB201094FULL,0x5B5853AB7EE5DE8DULL},
-  {0x66487F32C7F7496AULL,0x1263C4BE5674E809ULL,0x5437818F7C84E929ULL,0x5EFF56FD79831025ULL},
-  {0x9B42337A33110753ULL,0xA0AFFF24387D95E8ULL,0x0A537EF96BF4C714ULL,0x496C944DD9875BA6ULL},
-  {0x1E1AA014F0727E31ULL,0x8820848D105AFF3DULL,0xF1ABA14AF247F4D4ULL,0x9063FEC43CB5923DULL},
-  {0x70F6EE381284C162ULL,0xB629E62E85693BA4ULL,0x899C979A02B3CC30ULL,0xF2ECCAC775922B50ULL},
-  {0x6BF17748D2672D0BULL,0x4721058E67765BADULL,0xC3F92EFD155D5B2CULL,0x11B05C2CA032ACABULL},
-  {0x4D95E23F4C2E9368ULL,0xAC685AABD77A8F5CULL,0xB39605D4268C2510ULL,0x44C757A542F4EA2EULL},
-  {0xFC87E9355CFA0B13ULL,0xB96477925962A7FEULL,0xAF25118C667CFE50ULL,0xFA711B812C495F69ULL},
-  {0xEC5383170A17FFFBULL,0xC824ED8DE2F48367ULL,0xD46192FC93CA03DEULL,0x7421A2207EE73299ULL},
-  {0xADC035A061C9EC99ULL,0xDD0FCA79FBC6122FULL,0x6F4C4AA7C0141F25ULL,0x27245902D8971E91ULL},
-  {0x22F3EA1EF69961A9ULL,0x6C8D4022EA85B8CCULL,0xFC254DAD063761A2ULL,0x7D16D654F0C2AFF0ULL},
-  {0x1CAB284022ADE206ULL,0xF9E7D9F953F8135FULL,0xEDA76EF8C85A7735ULL,0x02DC383426073982ULL},
-  {0x24B035C673C9259DULL,0x0A2F2E365290C498ULL,0x93A39839340DDB53ULL,0x6C9ED1F1528B0215ULL},
-  {0x4BDE4567DD80F7B8ULL,0xEBE8FE7C068927DAULL,0xE72736B58DA5441CULL,0x220FD212E68251DCULL},
-  {0x60D4BC0AADD0E24DULL,0x02EFFC56A922F268ULL,0xD32E20499329765FULL,0x0E8BCBFE1F7F6E75ULL},
-  {0xDF16BFDE36B32256ULL,0xBA3E0E6FB2783DE4ULL,0xD1C2DDB907E84E99ULL,0xBBFD1098EAB76C67ULL},
-  {0x4F9BBDB6E9BF3916ULL,0x7DA8561DE4FDE71DULL,0xCC9A32F695807B1CULL,0x3E18941CC3C6D297ULL},
-  {0xB0F98F6B75F42399ULL,0xA79834450AE0666EULL,0x85BBE59122518037ULL,0xBB99ADCCCDC1D9DDULL},
-  {0x295CAAECB973C154ULL,0x1FDAD0FC2F7AB155ULL,0xECA6E349B85880C6ULL,0xF60547AB6E9C5FD3ULL},
-  {0x67564FA9C4FCAF1BULL,0xF1207378F0681DF2ULL,0x349A7CD0030247AAULL,0x267EB91EB5805268ULL},
-  {0xAE83234BD0B5CCD5ULL,0x43762BB1B12A0DAEULL,0xF6F37A80CF96CA98ULL,0x29A835F6EF7FA1E5ULL},
-  {0xCA49FE9FA101A169ULL,0x5AA184AF7DC7DD54ULL,0xCE660F2326B64948ULL,0x9FB77D64BF06DA7BULL},
-  {0x606CC1F728C2071EULL,0x35DC99AE9DC7F0E2ULL,0xB73BCFB810F5C60DULL,0x5C7BCF8B57F114E0ULL},
-  {0xF28EEC35DF76410BULL,0x9CDD120A88F9ECB1ULL,0xA1FDB7F6DCFCA4C8ULL,0x4EC79BB67B57101CULL},
-  {0x54A90F1E83778EEEULL,0x89C86DB6869AA1B5ULL,0x9689EABA6A81F044ULL,0xA286E222DFE10CFDULL},
-  {0xC2F78EA32F672DCCULL,0xDBDBFA4545D159C8ULL,0x4A84229A4492D18EULL,0x1322378061C6F8EDULL},
-  {0x528593BC18223188ULL,0x660B4C40AD08FD65ULL,0x1913B2E951E98A78ULL,0xC582DB1A3F0F2242ULL},
-  {0xACACF0F99E8C0B97ULL,0x61F1BFFC754A7FE3ULL,0x7A59FBEB7F872C17ULL,0xF6D2878E566894FCULL},
-  {0x6EA8B19F7A20350DULL,0xE4116FB9955B03B0ULL,0xE722AF7F4B70E64DULL,0xE3E77C41288F2602ULL},
-  {0x00C4C24426C2D6A5ULL,0x144A215214A158C6ULL,0xFE7B9A3226C68BDDULL,0x833932BC6747E07AULL},
-  {0xC2DCC5139E7C4BDCULL,0xEE2B59C50953FB43ULL,0x6736C0C76F3DEABAULL,0xC9E33FAEBD8EBA42ULL},
-  {0xF337C42891400283ULL,0x40D455079C90BF84ULL,0x12A9F02D8835B31CULL,0x2B0EB8522710028CULL},
-  {0xD7E81ABE158E3A25ULL,0x1B87FFDEE68E77F0ULL,0xF4F58C7EDF4417BEULL,0xF5202CF5AAEEA58BULL},
-  {0x1D8E3744986DFD2DULL,0xDC575A5D9D88BF35ULL,0xA9B03D2E5C157C70ULL,0x1FEF63EE32EEF0A2ULL},
-  {0x4E9C5FCC12285844ULL,0xC2A96316B7009F2EULL,0x3C574F282F74A87DULL,0x61FE64CAB0952CAEULL},
-  {0xE514CCAB4EAD8875ULL,0x40FD4DA8EA60B9C5ULL,0x13E0B6652777C19EULL,0xA7018D958BA47577ULL},
-  {0x8CDF6B034D730B58ULL,0x93A0C61C53969253ULL,0x80B0F20FB1F047D5ULL,0x5DCF9ABBA9625ED6ULL},
-  {0x71C1BA44202261C4ULL,0xA4EF96C02053DDA5ULL,0x196F7A095EFE39A4ULL,0x20B4ED416A1E7B44ULL},
-  {0xB5E013AD7B5D75D4ULL,0xBA7CEC105675F437ULL,0x4F5321C6C72FBBF4ULL,0x79A6BF4375F1469CULL},
-  {0x07890B9732CF901EULL,0xAFA2968E6AD0383AULL,0x8B67A55B38B5BB6DULL,0xB9C032D256CEB53FULL},
-  {0x1CD5F918D732F63DULL,0x5BD2FE7FD179C778ULL,0xF592A35B6AA3DFE4ULL,0x7669BBD419A4D491ULL},
-  {0x74113E60A8A9C7BEULL,0x3C9F7D58D37497D4ULL,0xE7FC8E69E3A73575ULL,0x8903C32501079BD8ULL},
-  {0x54E5381C1728D1C7ULL,0xBFC9CCBF49B946A9ULL,0x59B20C5C7FA62BAFULL,0x308ABC8DF271F759ULL},
-  {0x7E646DEAA92F7C31ULL,0x363FE84F5F857184ULL,0xECE6A6C1BB8D03EFULL,0x439C8761A2E77C7EULL},
-  {0x8B386FFC46E0AE7EULL,0x3DC0EFBA1E7C3BAAULL,0xA3E82877CC84ED4FULL,0x9EEA970BA856B2FAULL},
-  {0xE7A3A5EFC061B3F3ULL,0xA4FE2811C5AD63E5ULL,0xC8AD5472B59ED28BULL,0x37741CECA4048E11ULL},
-  {0x3E2D7D73DFB1030CULL,0xA30377DA47BFDA71ULL,0x59B2E2688AE7FD33ULL,0xA9FB1702100953B3ULL},
-  {0x73ADC4937C8F23CAULL,0xC7D265223D2FF985ULL,0x7C43C6AC85FABDD9ULL,0xEC191FD87D0769CEULL},
-  {0xC12A2EA16EDB6BE6ULL,0x095F40E131714885ULL,0x7FDB7F5B2F12FA57ULL,0x22F6FE9D21749501ULL},
-  {0xC6FA1F07C4D6F1EBULL,0xB9501BCB9DF23881ULL,0x0DFE79EEC1EC8547ULL,0xEB62F8D9FEC1E3DBULL},
-  {0x18FE128795F1DD0CULL,0x5E5C31D4CD0478C1ULL,0x8B90501CCB71B671ULL,0x737CECA2C0EF7227ULL},
-  {0x6A50C9D52A7644C7ULL,0xCC0C460AA877A9D4ULL,0x8E1016FF4C994E6BULL,0xA3452E9EFB6D4109ULL},
-  {0x7376FEB7CBDDD8FDULL,0x403FFF272D47E778ULL,0xD003FD2A4F18D526ULL,0x2AFC8D09B79176D8ULL},
-  {0x39A367D7C90F9EC4ULL,0xE75BFF36C144FC73ULL,0x893CDE54FE7D037FULL,0x3E5AC9DAC3276F26ULL},
-  {0xE2195FFCF28FA758ULL,0x81F77F6D20CC1376ULL,0xA9E0ED90AFA021A0ULL,0xCB13C152FD511D91ULL},
-  {0xB9BA49275398F5BFULL,0x667BF88857910A17ULL,0x04460F86F8E316A9ULL,0xF48BAD8C6797711CULL},
-  {0x96DAF16940023A52ULL,0xBD698A16D4F7CC85ULL,0x75CCA8922647F48DULL,0x1AB4EABE5E09409DULL},
-  {0x052513A74C5CB298ULL,0x51752863CB1307FCULL,0x6DC0720485EA3AC7ULL,0xA14992CB83926259ULL},
-  {0x6E6D3AB974E88915ULL,0xDC48A4D54D712398ULL,0xA48FA422A26AB982ULL,0x95F9F4E9007E5B9FULL},
-  {0xAC1719774623D24AULL,0x8F80EB5030F288E5ULL,0xACC98A87B5B2CBB8ULL,0x25FCFDE9A199E500ULL},
-  {0x330E97791BC31DF0ULL,0x0A77CD3BDD4B8E8EULL,0x7F5B558099711757ULL,0xDCE1BAE1D655BA51ULL},
-  {0x4A1CD26B230CFE31ULL,0xEE460872C3A3C648ULL,0xAD54FFF12E2B7E47ULL,0x4C112EB60B874288ULL},
-  {0xF6989F4AF7625D8EULL,0x1C48D2CA71BA34FCULL,0xBED88DAAB081F359ULL,0xCC3636A03FDDDDFAULL},
-  {0x2B990FE79D1C74EEULL,0x720880E7A170EE81ULL,0x62AAA2A8FA6231A1ULL,0x80207BDC320BF5DDULL},
-  {0x974CF9844611A32DULL,0xD8B632038D4AEF81ULL,0xB8EAFC4A0B8A7D1CULL,0x329CF0497E15EEC7ULL},
-  {0xFAB139D408DA08FDULL,0x86F6CA493F4D0410ULL,0x0F012D3A60FABCF9ULL,0xA2BE1D5CE78FF974ULL},
-  {0xD0531B7BF7E48E78ULL,0xC4D88C9A59442274ULL,0xC8296F928AC7919DULL,0x8C6F81BE3FAFA5EEULL},
-  {0x132EDA351B0E6A8BULL,0x7548DF4996FBA1C7ULL,0xD7E5F7ECC00FFF00ULL,0x87AECB174E5018B2ULL},
-  {0xB5ACB92B73E05583ULL,0xDE49D768A2CE6B07ULL,0xB2B0965A1F359A6AULL,0x7F42C0962FEB2F73ULL},
-  {0x6380451A6BCF5A43ULL,0xB72392D1B4CAAB61ULL,0xE626A629EC2344AFULL,0xADF1024980D25D7CULL},
-  {0x59A8ED387282765EULL,0x420E372EF1B25B27ULL,0x20742CE382DCE3A1ULL,0xF649BE278CAD9764ULL},
-  {0x6A479E04959B2BA9ULL,0x28643438320C1B9AULL,0xD1A2707A8B81191CULL,0x12DC765BD76AE7E5ULL},
-  {0x4B9A05B50CE815B7ULL,0x85E2A171585AA132ULL,0xBC6284BF0299BEF6ULL,0xD596ADF0E8692A06ULL},
-  {0x7AED0B5FCEB75D77ULL,0x3442F842381CA46BULL,0x9AF16BEDFF84BEA5ULL,0x7A74EEB77CBAFD2EULL},
-  {0xDEAEFC1D527A8FB4ULL,0x143F6871789E1801ULL,0x6C10DD9EF541689DULL,0xE077184B4AE8F705ULL},
-  {0xE87074EBA71766C9ULL,0x9D2D97562560902CULL,0xA16AEAE70726860BULL,0x989969E2DA87A713ULL},
-  {0xB40634E0E75E221DULL,0x787120CEB3D3DCFBULL,0xA295407E1D6FC48AULL,0xEB4C98489093D573ULL},
-  {0xC6842A3C5D6A6F78ULL,0xAA89C2517ACB3B49ULL,0xF2C193E3BFF086CBULL,0xFBF40833439D5A13ULL},
-  {0x323215E1BB0B2155ULL,0xC8968B90EF134F9FULL,0xD1AF1C019C372941ULL,0xEA75B9B25D717861ULL},
-  {0xEDC4EEA88751C8E9ULL,0x8858C96D5C2AE0E1ULL,0x0605F9565D0B48CBULL,0xBFF9597747A99F6DULL},
-  {0x5DE355371641218CULL,0x210E204CE4499809ULL,0xF39BE21F20C98824ULL,0x669985206EDF4AC6ULL},
-  {0xE58D69D900034BFFULL,0x9E3A48E85F75E6BDULL,0x8203371F82B2D435ULL,0xE18414567D6D1E69ULL},
-  {0x8511BE82BC32FEFEULL,0x08846E03CF39AF77ULL,0x68E68E5F65CA6E98ULL,0x70B0123774AF550EULL},
-  {0x6BA1AD6779C75DB1ULL,0x1B68A16B8BAABD74ULL,0x96ED0253B89CAD90ULL,0xCEC5A252BEA17421ULL},
-  {0x7C36F9CE8B75D41DULL,0xBD5E5B8983E05390ULL,0xFB85BDF98BA3985CULL,0xE115B14BEF4695CFULL},
-  {0x0DBDC3A7376AD092ULL,0x127C843F6AAE7094ULL,0x68C8397AA72C1871ULL,0xBA392B1C6B2D9FB7ULL},
-  {0xC86DF5CEB0FA5270ULL,0x60FAFA8DAD6BD3E9ULL,0xA855D6CCBD11F480ULL,0xE9D9DBFE8CF5F5CCULL},
-  {0x645543B704C4AE95ULL,0x572C95E5A88C9F9BULL,0x90C156513A94B17EULL,0x863FDE7FA15C485CULL},
-  {0x98411A4786393FB0ULL,0xD1925B91D06A7F16ULL,0x78925BD67E72CB77ULL,0xE4177CE1C3CD6AC7ULL},
-  {0x15F458116D5CDB70ULL,0x17F7F504AD913997ULL,0xF078A2B656EF3689ULL,0xF019B70EE6EC019BULL},
-  {0x742A49D2E61ED18BULL,0x1F21C4B96899781BULL,0x2D4B1F41E8E1F2CDULL,0x954A5FD857BA3ACFULL},
-  {0x6D3484BD8B8F52D8ULL,0x018A4B27D0C2B67FULL,0x4F6E8C4B8C7E1DA9ULL,0x661A7A5F829B6F85ULL},
-  {0xDCE4BCC5DC937193ULL,0x259D3D49D4D7071AULL,0x3B1FE249298B2059ULL,0x2D5D2FB1F0C30855ULL},
-  {0x2EA84F56A6998EE1ULL,0x44A4DFD4C71E2939ULL,0x0A48C6527272D216ULL,0x390D384A3BD5F0DDULL},
-  {0x49EB5472D554E0FFULL,0x27FCAEDA12D8CF54ULL,0x2217267B7407E987ULL,0x9BD0178E38189569ULL},
-  {0x4CAAD479491151B1ULL,0x69AB2A193A119BCDULL,0x36C7D4DB422413ACULL,0x322F40AE5784E015ULL},
-  {0x2E7ADC173584427BULL,0x691B09730F2F5A05ULL,0xF08B76929336E421ULL,0x618BD6B0D25CA70DULL},
-  {0x46F4CD5580765BB1ULL,0x749D05F7F3C6F942ULL,0x2A8043E25CC46E7AULL,0x171A5EA81577EA38ULL},
-  {0x0CFB9D0FE879992CULL,0x530ED7385E5D1E33ULL,0x53B4F895DC62482CULL,0x07A981F0C21862A8ULL},
-  {0x564EDA1FE8E5111DULL,0x8DD4AB7EB4ECA3D5ULL,0x066CDBDD55881D95ULL,0x782742A71805F085ULL},
-  {0x233B75EFB5753F28ULL,0x0B2A81B7B667E934ULL,0xE83BE30B2469B068ULL,0xADB23BCDB3D069C5ULL},
-  {0xF8A10313D8BFAA77ULL,0x437942CB6F143103ULL,0x664AE51927023AACULL,0xC417FC627085FA15ULL},
-  {0xCEA15631B4E8DBCAULL,0x803ECF119B7B37DEULL,0xEDE375A8A7768DB4ULL,0xD8003C9EE3C842F5ULL},
-  {0xEDEFD3BAFD63C7D4ULL,0xFCC28B6E7E05363CULL,0xFF739D7224E93C3BULL,0xAB1ABA31EEB44621ULL},
-  {0x145C13E1370D26D0ULL,0x68E21A0C41BC83D9ULL,0x3E5BEA50DA005C53ULL,0x211557489FA93B88ULL},
-  {0x8D60B59B78775AF0ULL,0x06145384CB45882AULL,0x869A230B9B8B234EULL,0xF0CF60B09890ACFBULL},
-  {0x585404366834F189ULL,0x12FF023BC1D5723EULL,0xE214EFBAFBF529D3ULL,0xABB1D9F874637668ULL},
-  {0xC063DF8E33D7EBE2ULL,0x0187D172A2928BB5ULL,0x8727D0EEE735F95CULL,0xE42009E9905A1020ULL},
-  {0xC965C33DEF60A55CULL,0x6A3ABD23B7291B99ULL,0xB3393A895C2D6457ULL,0x5B5930F12E9C40BCULL},
-  {0x773BC21FCE5A6758ULL,0x35FB355B732D54E5ULL,0xD1A390E9087063B2ULL,0x2D75E28D461D7353ULL},
-  {0xA873CEAF3D997E7AULL,0x5CED5C2587347D57ULL,0x5F82ED5650796F50ULL,0x5246A8190BBFB291ULL},
-  {0x696766880E818C97ULL,0x6051723FD13F33B1ULL,0x0468B3699E56A1CCULL,0x20CDEEC3C7087181ULL},
-  {0x3D2127766A791EE2ULL,0xD71DBD04093281A1ULL,0x7B97E7464850ED02ULL,0x3C83145DAD9F8748ULL},
-  {0x1F43E13806774BD9ULL,0x3CD436897751B539ULL,0xDA85F832B081510AULL,0x2C649B9CCBDB7371ULL},
-  {0xC89B6F279E79827CULL,0x9AB9C303A5AC3D3EULL,0x7E141041AB9A0D58ULL,0x6CE693B64A37C672ULL},
-  {0xCA8064315FEA15F8ULL,0x4D51DC1ACC7FF3ABULL,0x59AF8F0AE1F2CD33ULL,0x4D0BB49A6ECA0F66ULL},
-  {0xBB8701464E6F4838ULL,0x0FE9F5F52E6A7F0FULL,0xD671D1BC7C1D8834ULL,0xF602C3428593A9A8ULL},
-  {0xB84BDB0B687DC1E8ULL,0x976B0A4182C2E197ULL,0x6DA75836354BBD8CULL,0xCE47C1BA148AD3A5ULL},
-  {0x3EA0CB81B74424A6ULL,0xBF94A7009A919F1AULL,0xF20CA036761D3E56ULL,0xB8F7C3B220701320ULL},
-  {0x3ACA90FE34E4724DULL,0xAC3F7E3252E864D5ULL,0x59B9DE738796437DULL,0x99C193B77DD723DCULL},
-  {0x6A7B5D1F9D9FCAFFULL,0x43F9CBCC9A9A5D6FULL,0xDD7F703A5C6616D1ULL,0xAFB6A74D9849454EULL},
-  {0x4FEEE943170D78D7ULL,0xE8F4BCD445061AD5ULL,0x9E0D21008006C849ULL,0x05386576DAD71615ULL},
-  {0xEAA144EB4217DACAULL,0xA3561BA02581B055ULL,0xFEDD5DCDC96B04F9ULL,0xDA7D67CBC1EDE9D4ULL},
-  {0x201A0942B3D4C97CULL,0x2AA69CCBB27C5DE3ULL,0xA03220D36DC86F1DULL,0x526A576E39F0FE5EULL},
-  {0x384FC1042D30BF01ULL,0x42B8947913733B89ULL,0x59D4F9898AE632B8ULL,0x160E1C1C13342FD4ULL},
-  {0x0973510C413118FFULL,0x4ED6A4741D9F06F0ULL,0x248DFA9FC795E725ULL,0x089D449A941E0B2CULL},
-  {0xEFDC40FC10B751F0ULL,0x64C4A7C57FB1783CULL,0xE3B055FF3A76EC05ULL,0x87092DCBB9C3D254ULL},
-  {0xD5E04D1257CB1F59ULL,0x947024EBADADED8EULL,0xAF23295DBBAEDF94ULL,0xA6C41DB92AC40552ULL},
-  {0x13132BA37855FABBULL,0xA831D46B8EE94EB6ULL,0xEF679714DABD590EULL,0xFE49A6A8B5E46BF1ULL},
-  {0x9BCC260FAC1F082CULL,0x1F628118790AB697ULL,0x6909B852F9E26632ULL,0xA3502B58B72173EBULL},
-  {0x15445F87E05F4513ULL,0xF6B83F0BBC20722CULL,0xDF2F14E0E6E6B47AULL,0x4521954EFCC98263ULL},
-  {0xCD38216E3802DAE8ULL,0x0723325991479180ULL,0x896CFE14E1E232E7ULL,0xC4BE917DF242647BULL},
-  {0xE3E53B1C00110BF3ULL,0x122F37B4E362B4CEULL,0x0D5E401F1F89A5DFULL,0xCD15ABBCD744D485ULL},
-  {0x2F8276B3AA980F1DULL,0x46E9D6DDFEBB2F9AULL,0xC5FF9D3FE0FF41C8ULL,0x57288A5A7CA3E422ULL},
-  {0x368CA50918E00957ULL,0x303E915FF247F131ULL,0x41FD0F367A0737ADULL,0xCFD4D36BEB2E11F2ULL},
-  {0xF91DD80ECF85AD77ULL,0x6DC298F2B98ADC72ULL,0xD02D2BCA8238BDB6ULL,0xB393F59282F351B2ULL},
-  {0x15571284D1F7C189ULL,0xB6A1294D88CE7FE9ULL,0x3332400B303C0236ULL,0x72EA16B532A7336DULL},
-  {0x0B40DA036510BF15ULL,0x7E4FB2920FA94642ULL,0x1D1CDFF595FFA332ULL,0xBC6C2A2742507382ULL},
-  {0xF2972B26153CF7AEULL,0x03215994827A46C2ULL,0xBE59FE0EFE7BA2E7ULL,0xD5E6268B30952422ULL},
-  {0xBCD7E1193D634761ULL,0xDEBCAD9525D3833EULL,0x5E335D7C6651C583ULL,0xD294561FAE72F32DULL},
-  {0x9F80472B943F32B9ULL,0x3E258A390C6F8837ULL,0xDDAD6FF386D416F4ULL,0xB8241453ABC44C57ULL},
-  {0x33DBDDAA4C159DA2ULL,0x34F8C1CF61C95517ULL,0xB9A6F2F56B25E17AULL,0x0D1716223AD8AAA0ULL},
-  {0xAAF2E7FEE70C4914ULL,0x3E3D5F07146DAA1AULL,0xFCB8E1C5C4417C71ULL,0xC1FDAC5AEF4C6F0FULL},
-  {0xFFD4A2378A9CAC00ULL,0xABA23F53473AC509ULL,0x0CB20EB5FF56A798ULL,0x84A519DDEF76C5E2ULL},
-  {0x0AF42CC6EFD684CCULL,0x1F3695B09A737FA3ULL,0xC304752CC3EBBC51ULL,0xFD5A31976FAD6AEEULL},
-  {0xC442706CB1162436ULL,0x750CDD6E478B4D53ULL,0x60E16EFEC6616B21ULL,0x283435F57FB604CBULL},
-  {0xFD8B44803C9C6C81ULL,0x34C5C9A55C1CBF36ULL,0x8DDE31677A24F558ULL,0x563651760897632FULL},
-  {0x6D485C252AA7238EULL,0x4628C2DEF16CA7C5ULL,0x5C272F61469F4B51ULL,0x62331450DFC53EFAULL},
-  {0x4C86D9B453ABD7EDULL,0xC4439820C06950CDULL,0x22CAE425CCD28912ULL,0xB5CE31605D6DD9C6ULL},
-  {0x36140ECA8398EC74ULL,0x2A4DD9882E577009ULL,0x6F88AE8E75EF3DEEULL,0xFD8A17B404F35D09ULL},
-  {0x8FA14CCDEDE3B4EBULL,0xF53E37A6F779F96EULL,0x3788194AAFC545E7ULL,0x933D348378A71F44ULL},
-  {0x4C0AA2C1294C972FULL,0xA53EC8949C2E2D14ULL,0x742AE5605903CBCDULL,0x690CABF4E502BB7EULL},
-  {0x80BA8C8AE7731232ULL,0xCBEA83D0543B5414ULL,0xBD7C4830224AC083ULL,0x2A7D3701A8724B12ULL},
-  {0x64530205740FCB15ULL,0x038DB51F5B614F7DULL,0xEC3A1AE811595767ULL,0x1104E5D422B7AE5AULL},
-  {0xB29290C3823C470EULL,0x4E311DC7780EF885ULL,0xED608A7236699899ULL,0xEA90F8AAE214EE16ULL},
-  {0x5A8A4D093328A002ULL,0xFF794376BE1E0FE1ULL,0x63EEBEBF507B60FAULL,0x0B10C521209643E2ULL},
-  {0x8705125C4861D598ULL,0x796DA2B12C953D0BULL,0x65BD289EA3CF3F38ULL,0xCB7571C4071C5527ULL},
-  {0xB8CFD28FCACD25DCULL,0x4798EC2CFB912159ULL,0xE9D9B4975A476A81ULL,0x086FE370E64F07CEULL},
-  {0xC989A405AD7C287BULL,0xA66D4F3B128A40BEULL,0x76D87F8194D45150ULL,0x7BBBB198EB39973BULL},
-  {0x0B88F4CD1C5829E7ULL,0xC850229916E8671AULL,0x3704B9FBEC634584ULL,0xF6CF592CC0BA6951ULL},
-  {0x59A501E28FF7892AULL,0x51B6D3D004C81952ULL,0x3DC8B39508959AD2ULL,0xA2F2F02A8272DE6EULL},
-  {0xDE22126B399A6B91ULL,0xD13C1E64874D19AFULL,0xDA4EB8A942361149ULL,0x13761DDDC6DF090DULL},
-  {0x41D8F503DD32B289ULL,0xD827B6290F4956A4ULL,0x66F1E75D5B6EF44FULL,0x8613BB848398681DULL},
-  {0x9EFEFF947AF01D02ULL,0x172F8BE29125D146ULL,0xE3853A8E80679F8FULL,0x16D34F6F5C6763DDULL},
-  {0x4E62724AA5A50306ULL,0x187B403215D97CDAULL,0xCAE90A62D359C339ULL,0x838E779334AA6FE6ULL},
-  {0x8684DD3A2AE4C10DULL,0xBB272EEC12268D02ULL,0xE07455D6E011840AULL,0x0CF758B0712ED71DULL},
-  {0xD4070243A8433047ULL,0x010FA5F5D45F9C15ULL,0xEE12A3D284BD1304ULL,0x01FCABF21E19CE68ULL},
-  {0xCBA457B00E5BBFF3ULL,0x69124A884D11E86FULL,0xD2B82857AB89BCDFULL,0xA758410B99A599ACULL},
-  {0x9F9196A00969ED71ULL,0x4851F5B4C551BEC6ULL,0xD6F28D6DA0443C63ULL,0xE15723EB0E0BDBE6ULL},
-  {0x2321DB14EA2A5BC6ULL,0x145C3C656EF5B9CEULL,0x9AEFDF2898B87830ULL,0x82DB2BE0286F2BA0ULL},
-  {0x64576D31AB959AB2ULL,0xF1E32C34D6287DEEULL,0x78BD4E53A05A267FULL,0xFFB0E211C79FBB79ULL},
-  {0x46274C194BDA3DEDULL,0x0B781FE68678A071ULL,0xE1B31E418EEBD8DFULL,0xEC17549240804EADULL},
-  {0xCE8421F87E94E1A4ULL,0x1AE5537D75624288ULL,0xFFC844B2EC0E255AULL,0xF6A9186FF147B9B5ULL},
-  {0x7C5A9C77CF9135B7ULL,0x5A97A55507475344ULL,0x6F36CC8065919B54ULL,0xE8201F92343B36C5ULL},
-  {0x9A5E75B583BC2C2AULL,0x113335366679EB09ULL,0xB328034B88C5BBBCULL,0x8791C0007C09C94DULL},
-  {0x2BFC42F530482421ULL,0x88DFC8A3800FBD26ULL,0xE0C7410B54C44E18ULL,0x7F95ABE7E7418B02ULL},
-  {0x1C034E1464877B20ULL,0x7E8FDBE1BA101D94ULL,0x7FF564D2D4649C6FULL,0x4B985B13C5499026ULL},
-  {0xD322962C0EC8D590ULL,0x337EE58EF1703CDEULL,0xFBF3DD2912D96F70ULL,0x4D00ACDF2F314FAFULL},
-  {0xE92D8FC281135B0DULL,0x5813015563CA5D9CULL,0xFCF8703F93696F42ULL,0x31CE61A87834F52EULL},
-  {0x9E58DDD666A37F4CULL,0xA3ACE5FE00EDFA09ULL,0xD08AFEE77C5FED50ULL,0xA66C002C286827F6ULL},
-  {0xAC7CECEA9251C791ULL,0x9EAD5F6E1AC23FBEULL,0x317CA083C5A8B85CULL,0xBEA2A060505C13BCULL},
-  {0x145E649F093CD690ULL,0x038411DB97AA9E00ULL,0x0775F730082B044BULL,0xB04D308BC1C2BF54ULL},
-  {0x3CDFF8D0D2827928ULL,0x08850091F84DEE33ULL,0x896635EA855323B6ULL,0x74962C3FED9A6E9CULL},
-  {0x2E879C39E237AEFBULL,0x7FCB518A3801AE48ULL,0x9A2D3BD0CFA072C3ULL,0x78DF0C044A69B534ULL},
-  {0x696B0D61F122DB3AULL,0xA165C526765B09F0ULL,0x3E6ECC328653BA7AULL,0x1CBCF83EA363E0D9ULL},
-  {0x53E74FE4532E3EA1ULL,0x30973AAF2A476278ULL,0xCFB33A9B58B3ED6EULL,0x0A24B0CF967E35F9ULL},
-  {0x3D3DE909E9FAE659ULL,0x61B0A806E7BA29C7ULL,0xCC610E2D1C3D61F4ULL,0xD10B5A637AB546BFULL},
-  {0x628E63CC35D070FFULL,0x0C29537E44E2DFBCULL,0x98637931F8D174C9ULL,0xF7515A08EBA21C5CULL},
-  {0x4BB5FD503CEA1A19ULL,0x7B945A2CB52C448EULL,0x341AD4779342C7BCULL,0x7B148EF273E1B131ULL},
-  {0xC19452766A003E5EULL,0x575CCBC1B92846F1ULL,0xA836B1306D41386DULL,0x24ACEEBB582CB5D7ULL},
-  {0x650AB9E0BFCFBBA7ULL,0xD916314A60126028ULL,0x5E29EA94389EE3E6ULL,0x5847F4E06C653033ULL},
-  {0x03CEB16589AB78D7ULL,0x0382EFA16EBD7AD8ULL,0xE6663BB13EE54477ULL,0x876A1E9190531331ULL},
-  {0x1C59E44ECD0676FFULL,0xFB2E9898141A5248ULL,0x86611EEC408082FBULL,0x2CBFAD4D16C07021ULL},
-  {0x1F2D683621FD51C3ULL,0xE869E35F0F5F84CEULL,0xFE5D34E85229B465ULL,0x3DD2802C5F1C8F65ULL},
-  {0x5E85110C7D7FDF1DULL,0x18DB178C5B6AE97EULL,0x4ABE1644BB54CC85ULL,0x328E831D2F2B162CULL},
-  {0x2CA01CF9CFA006A0ULL,0x1EFF9B7B09B3E0E7ULL,0x5BEB39CD9565BCD4ULL,0x5A23A7CA6A97E240ULL},
-  {0x1521F3946DD15E4EULL,0x6EBA68D46C922B6AULL,0x9455941440A8B100ULL,0x627EEA93C6C9B53FULL},
-  {0xB9A8DDB9F08ED1CBULL,0x1173CC47B5E77B19ULL,0xBF2212DBD1165610ULL,0x564BD4F99E6268FDULL},
-  {0xE159BC42F5740C69ULL,0xE38242FC9F565DBBULL,0x716429863BCEF432ULL,0x195A6A65D3790BECULL},
-  {0xE311B5E5F78F0B4DULL,0x29020EE37C6FEF68ULL,0x8EC41538D195EE52ULL,0x4D9EBBCEF2CC8006ULL},
-  {0xA6C56AC1B611509BULL,0x5F87644C84D670E9ULL,0xBF281615D59F06FFULL,0x177C3A61682363ABULL},
-  {0xA595CB8065227081ULL,0xDB2C8E4B4BA05FF4ULL,0x2ABEFB8B098568FCULL,0xFEF23492E8346F32ULL},
-  {0xD49B6626C5955AC8ULL,0x25443EFA80F8AFF3ULL,0x43204DF148EB1618ULL,0x2D1A0B9C8EABA065ULL},
-  {0x519515D95DA85E50ULL,0xEC854514829EF9C8ULL,0x3F2FB1398C08F921ULL,0xEE02CE525CEBC051ULL},
-  {0x1B82796AD0461736ULL,0x4058101D74F00538ULL,0x0225FADE934112D3ULL,0x549B18C310FEAEA1ULL},
-  {0x38C42CF00C2BF1AEULL,0x56C2EBF4E697B218ULL,0xE87A2401B5853625ULL,0x7A7915802F680F1BULL},
-  {0x434E7638ACB46DBDULL,0x6367D24BD545BDCBULL,0x09221F5AE9541031ULL,0xE95E050881AF550DULL},
-  {0x65EA4DB7F6FA955BULL,0xC0691B77AFAFD59DULL,0x9826F5327BFDD80EULL,0xFF49E905EFB16004ULL},
-  {0xC968B4FE49B8C971ULL,0x99285B8755F25512ULL,0x8F1E2E26865118B9ULL,0x62F637C67D886374ULL},
-  {0x33168355C890AFD0ULL,0x212CC034812A9C40ULL,0x125DB2D93D7A3C59ULL,0x0F48823AC5970D4EULL},
-  {0xF56EFC49DCD7AB93ULL,0x206349D541035A94ULL,0x8184265EAC7E0147ULL,0xA0CBC0165E32171CULL},
-  {0x5CB4ABD386BD6433ULL,0x4C2F28D222942E6DULL,0x8B331BA48ED97E73ULL,0x3FFEDF0DA2042946ULL},
-  {0x4D5051F9E7F0C626ULL,0x9FC499670E0E2F82ULL,0x9F4041D3AA231F2BULL,0xA532D00D35013F85ULL},
-  {0xFB57D6B50D57BC3AULL,0xF92BECD5521C791DULL,0xDA3D9A9E27442208ULL,0x9BAD7426D55014A6ULL},
-  {0x23A8F952D8D18DDEULL,0x9926833A3F40D28FULL,0x3FE5BCAA06BDEDC3ULL,0x92C20846CFDF1E8FULL},
-  {0xB1C7B6D69BE933F5ULL,0x526B3399149C3A74ULL,0x07749050C003EED6ULL,0x4094B8AC751A0630ULL},
-  {0x8304A412C16ECAE6ULL,0xFDC4F92F00281A14ULL,0x03DBA14C124095CBULL,0x1F023F2FA2BBECE7ULL},
-  {0xFDDE57F00E50F833ULL,0x2A2EEE650AE28544ULL,0x48732B9FD07ACB6FULL,0x029C04770E713F59ULL},
-  {0x13756CF7EF4E5F1BULL,0xFE067BCF5FC29751ULL,0x83DCA0E503C798F8ULL,0x2DC6CAE5CAC2D887ULL},
-  {0xA2F8FB20B33887F4ULL,0x588E09B215D37A10ULL,0xA4AF8BDAFDEEC2C1ULL,0x35E531B38368C082ULL},
-};
+// _2Gn = grpSize*G
+__device__ __constant__ uint64_t _2Gnx[4];
+__device__ __constant__ uint64_t _2Gny[4];
 
+// SecpK1 Generator table (Contains G,2G,3G,...,(grpSize/2 )G)
+__device__ __constant__ uint64_t Gx[GRP_SIZE_MAX / 2][4];
+__device__ __constant__ uint64_t Gy[GRP_SIZE_MAX / 2][4];
@@ -0,0 +1,90 @@
+/*
+* This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+* Copyright (c) 2019 Jean Luc PONS.
+*
+* This program is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, version 3.
+*
+* This program is distributed in the hope that it will be useful, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+* General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ---------------------------------------------------------------------------------
+// HIP build of GPUEngine.cu (hipcc -DWITHHIP, AMD GPUs): the CUDA runtime calls
+// of the engine are mapped on their HIP equivalents
+// ---------------------------------------------------------------------------------
+
+#ifndef GPUHIPH
+#define GPUHIPH
+
+#include <hip/hip_runtime.h>
+
+#define cudaDeviceGetLimit hipDeviceGetLimit
+#define cudaDeviceProp hipDeviceProp_t
+#define cudaDeviceScheduleBlockingSync hipDeviceScheduleBlockingSync
+#define cudaDeviceScheduleSpin hipDeviceScheduleSpin
+#define cudaDeviceSetCacheConfig hipDeviceSetCacheConfig
+#define cudaDeviceSetLimit hipDeviceSetLimit
+#define cudaErrorNotReady hipErrorNotReady
+#define cudaError_t hipError_t
+#define cudaEventBlockingSync hipEventBlockingSync
+#define cudaEventCreateWithFlags hipEventCreateWithFlags
+#define cudaEventDestroy hipEventDestroy
+#define cudaEventDisableTiming hipEventDisableTiming
+#define cudaEventQuery hipEventQuery
+#define cudaEventRecord hipEventRecord
+#define cudaEventSynchronize hipEventSynchronize
+#define cudaFree hipFree
+#define cudaFreeHost hipHostFree
+#define cudaFuncAttributes hipFuncAttributes
+#define cudaFuncCachePreferL1 hipFuncCachePreferL1
+#define cudaFuncCachePreferShared hipFuncCachePreferShared
+#define cudaGetDeviceCount hipGetDeviceCount
+#define cudaGetDeviceProperties hipGetDeviceProperties
+#define cudaGetErrorString hipGetErrorString
+#define cudaGetLastError hipGetLastError
+#define cudaHostAlloc hipHostMalloc
+#define cudaHostAllocMapped hipHostMallocMapped
+#define cudaHostAllocPortable hipHostMallocPortable
+#define cudaHostAllocWriteCombined hipHostMallocWriteCombined
+#define cudaLimitMallocHeapSize hipLimitMallocHeapSize
+#define cudaLimitStackSize hipLimitStackSize
+#define cudaMalloc hipMalloc
+#define cudaMemcpy hipMemcpy
+#define cudaMemcpyAsync hipMemcpyAsync
+#define cudaMemcpyDeviceToDevice hipMemcpyDeviceToDevice
+#define cudaMemcpyDeviceToHost hipMemcpyDeviceToHost
+#define cudaMemcpyHostToDevice hipMemcpyHostToDevice
+#define cudaMemsetAsync hipMemsetAsync
+#define cudaSetDevice hipSetDevice
+#define cudaSetDeviceFlags hipSetDeviceFlags
+#define cudaStreamCreateWithFlags hipStreamCreateWithFlags
+#define cudaStreamDestroy hipStreamDestroy
+#define cudaStreamNonBlocking hipStreamNonBlocking
+#define cudaStreamSynchronize hipStreamSynchronize
+#define cudaSuccess hipSuccess
+
+// The kernel and symbol arguments are plain pointers in the HIP API
+
+template<class T>
+static inline hipError_t cudaFuncGetAttributes(hipFuncAttributes *attr, T *func) {
+  return hipFuncGetAttributes(attr, (const void *)func);
+}
+
+template<class T>
+static inline hipError_t cudaFuncSetCacheConfig(T *func, hipFuncCache_t config) {
+  return hipFuncSetCacheConfig((const void *)func, config);
+}
+
+template<class T>
+static inline hipError_t cudaMemcpyToSymbol(const T &symbol, const void *src, size_t size) {
+  return hipMemcpyToSymbol((const void *)&symbol, src, size, 0, hipMemcpyHostToDevice);
+}
+
+#endif // GPUHIPH
@@ -23,7 +23,12 @@
 #define NBBLOCK 5
 #define BIFULLSIZE 40
 
-// Assembly directives
+// Carry chains: PTX carry flag (CUDA) or _carry variable (HIP), the functions using
+// them start with CARRY_CHAIN
+#ifndef WITHHIP
+
+#define CARRY_CHAIN
+
 #define UADDO(c, a, b) asm volatile ("add.cc.u64 %0, %1, %2;" : "=l"(c) : "l"(a), "l"(b) : "memory" );
 #define UADDC(c, a, b) asm volatile ("addc.cc.u64 %0, %1, %2;" : "=l"(c) : "l"(a), "l"(b) : "memory" );
 #define UADD(c, a, b) asm volatile ("addc.u64 %0, %1, %2;" : "=l"(c) : "l"(a), "l"(b));
@@ -47,11 +52,43 @@
 #define MADD(r,a,b,c) asm volatile ("madc.hi.u64 %0, %1, %2, %3;" : "=l"(r) : "l"(a), "l"(b), "l"(c));
 #define MADDS(r,a,b,c) asm volatile ("madc.hi.s64 %0, %1, %2, %3;" : "=l"(r) : "l"(a), "l"(b), "l"(c));
 
+#else
+
+// Portable carry chains for the HIP build (no inline PTX). The operands are read
+// before the result is written as they may alias it.
+#define CARRY_CHAIN uint64_t _carry
+
+#define UADDO(c, a, b) { uint64_t _ua = (a); uint64_t _ur = _ua + (b); _carry = (_ur < _ua); (c) = _ur; }
+#define UADDC(c, a, b) { uint64_t _ua = (a); uint64_t _ur = _ua + (b) + _carry; _carry = _carry ? (_ur <= _ua) : (_ur < _ua); (c) = _ur; }
+#define UADD(c, a, b) { (c) = (a) + (b) + _carry; }
+
+#define UADDO1(c, a) UADDO(c, c, a)
+#define UADDC1(c, a) UADDC(c, c, a)
+#define UADD1(c, a) UADD(c, c, a)
+
+#define USUBO(c, a, b) { uint64_t _ua = (a); uint64_t _ub = (b); _carry = (_ua < _ub); (c) = _ua - _ub; }
+#define USUBC(c, a, b) { uint64_t _ua = (a); uint64_t _ub = (b); uint64_t _ur = _ua - _ub - _carry; _carry = _carry ? (_ua <= _ub) : (_ua < _ub); (c) = _ur; }
+#define USUB(c, a, b) { (c) = (a) - (b) - _carry; }
+
+#define USUBO1(c, a) USUBO(c, c, a)
+#define USUBC1(c, a) USUBC(c, c, a)
+#define USUB1(c, a) USUB(c, c, a)
+
+#define UMULLO(lo,a, b) { (lo) = (uint64_t)(a) * (uint64_t)(b); }
+#define UMULHI(hi,a, b) { (hi) = __umul64hi((unsigned long long)(a), (unsigned long long)(b)); }
+#define MADDO(r,a,b,c) UADDO(r, __umul64hi((unsigned long long)(a), (unsigned long long)(b)), c)
+#define MADDC(r,a,b,c) UADDC(r, __umul64hi((unsigned long long)(a), (unsigned long long)(b)), c)
+#define MADD(r,a,b,c) UADD(r, __umul64hi((unsigned long long)(a), (unsigned long long)(b)), c)
+#define MADDS(r,a,b,c) UADD(r, (uint64_t)__mul64hi((long long)(a), (long long)(b)), c)
+
+#endif // WITHHIP
+
 // SECPK1 endomorphism constants
 __device__ __constant__ uint64_t _beta[] = { 0xC1396C28719501EEULL,0x9CF0497512F58995ULL,0x6E64479EAC3434E9ULL,0x7AE96A2B657C0710ULL };
 __device__ __constant__ uint64_t _beta2[] = { 0x3EC693D68E6AFA40ULL,0x630FB68AED0A766AULL,0x919BB86153CBCB16ULL,0x851695D49A83F8EFULL };
 
-#define HSIZE (GRP_SIZE / 2 - 1)
+// Half group size of the kernel (grp template parameter)
+#define HSIZE (grp / 2 - 1)
 
 // 64bits lsb negative inverse of P (mod 2^64)
 #define MM64 0xD838091DD2253531ULL
@@ -193,6 +230,7 @@ __device__ void ShiftR62(uint64_t dest[5],uint64_t r[5],uint64_t carry) {
 
 __device__ void IMult(uint64_t* r,uint64_t* a,int64_t b) {
 
+  CARRY_CHAIN;
   uint64_t t[NBBLOCK];
 
   // Make b positive
@@ -222,6 +260,7 @@ __device__ void IMult(uint64_t* r,uint64_t* a,int64_t b) {
 
 __device__ uint64_t IMultC(uint64_t* r,uint64_t* a,int64_t b) {
 
+  CARRY_CHAIN;
   uint64_t t[NBBLOCK];
   uint64_t carry;
 
@@ -257,6 +296,7 @@ __device__ uint64_t IMultC(uint64_t* r,uint64_t* a,int64_t b) {
 
 __device__ void MulP(uint64_t *r, uint64_t a) {
 
+  CARRY_CHAIN;
   uint64_t ah;
   uint64_t al;
 
@@ -275,6 +315,7 @@ __device__ void MulP(uint64_t *r, uint64_t a) {
 
 __device__ void ModNeg256(uint64_t* r,uint64_t* a) {
 
+  CARRY_CHAIN;
   uint64_t t[4];
   USUBO(t[0],0ULL,a[0]);
   USUBC(t[1],0ULL,a[1]);
@@ -291,6 +332,7 @@ __device__ void ModNeg256(uint64_t* r,uint64_t* a) {
 
 __device__ void ModNeg256(uint64_t* r) {
 
+  CARRY_CHAIN;
   uint64_t t[4];
   USUBO(t[0],0ULL,r[0]);
   USUBC(t[1],0ULL,r[1]);
@@ -307,6 +349,7 @@ __device__ void ModNeg256(uint64_t* r) {
 
 __device__ void ModSub256(uint64_t* r,uint64_t* a,uint64_t* b) {
 
+  CARRY_CHAIN;
   uint64_t t;
   uint64_t T[4];
   USUBO(r[0],a[0],b[0]);
@@ -329,6 +372,7 @@ __device__ void ModSub256(uint64_t* r,uint64_t* a,uint64_t* b) {
 
 __device__ void ModSub256(uint64_t* r,uint64_t* b) {
 
+  CARRY_CHAIN;
   uint64_t t;
   uint64_t T[4];
   USUBO(r[0],r[0],b[0]);
@@ -350,6 +394,9 @@ __device__ void ModSub256(uint64_t* r,uint64_t* b) {
 // ---------------------------------------------------------------------------------------
 
 __device__ __forceinline__ uint32_t ctz(uint64_t x) {
+#ifdef WITHHIP
+  return __ffsll((unsigned long long)x) - 1;
+#else
   uint32_t n;
   asm("{\n\t"
     " .reg .u64 tmp;\n\t"
@@ -358,6 +405,7 @@ __device__ __forceinline__ uint32_t ctz(uint64_t x) {
     "}"
     : "=r"(n) : "l"(x));
   return n;
+#endif
 }
 
 // ---------------------------------------------------------------------------------------
@@ -443,6 +491,7 @@ __device__ void _DivStep62(uint64_t u[5],uint64_t v[5],
 
 __device__ void MatrixVecMulHalf(uint64_t dest[5],uint64_t u[5],uint64_t v[5],int64_t _11,int64_t _12,uint64_t* carry) {
 
+  CARRY_CHAIN;
   uint64_t t1[NBBLOCK];
   uint64_t t2[NBBLOCK];
   uint64_t c1,c2;
@@ -461,6 +510,7 @@ __device__ void MatrixVecMulHalf(uint64_t dest[5],uint64_t u[5],uint64_t v[5],in
 
 __device__ void MatrixVecMul(uint64_t u[5],uint64_t v[5],int64_t _11,int64_t _12,int64_t _21,int64_t _22) {
 
+  CARRY_CHAIN;
   uint64_t t1[NBBLOCK];
   uint64_t t2[NBBLOCK];
   uint64_t t3[NBBLOCK];
@@ -487,6 +537,7 @@ __device__ void MatrixVecMul(uint64_t u[5],uint64_t v[5],int64_t _11,int64_t _12
 
 __device__ uint64_t AddCh(uint64_t r[5],uint64_t a[5],uint64_t carry) {
 
+  CARRY_CHAIN;
   uint64_t carryOut;
 
   UADDO1(r[0],a[0]);
@@ -507,6 +558,7 @@ __device__ __noinline__ void _ModInv(uint64_t* R) {
   // Return 0 if no inverse
   // See IntMod.cpp for more info.
 
+  CARRY_CHAIN;
   int64_t  uu,uv,vu,vv;
   uint64_t mr0,ms0;
   int32_t  pos = NBBLOCK - 1;
@@ -613,6 +665,7 @@ __device__ __noinline__ void _ModInv(uint64_t* R) {
 
 __device__ void _ModMult(uint64_t *r, uint64_t *a, uint64_t *b) {
 
+  CARRY_CHAIN;
   uint64_t r512[8];
   uint64_t t[NBBLOCK];
   uint64_t ah, al;
@@ -663,6 +716,7 @@ __device__ void _ModMult(uint64_t *r, uint64_t *a, uint64_t *b) {
 
 __device__ void _ModMult(uint64_t *r, uint64_t *a) {
 
+  CARRY_CHAIN;
   uint64_t r512[8];
   uint64_t t[NBBLOCK];
   uint64_t ah, al;
@@ -711,6 +765,7 @@ __device__ void _ModMult(uint64_t *r, uint64_t *a) {
 
 __device__ void _ModSqr(uint64_t *rp, const uint64_t *up) {
 
+  CARRY_CHAIN;
   uint64_t r512[8];
 
   uint64_t u10, u11;
@@ -885,23 +940,142 @@ __device__ void _ModSqr(uint64_t *rp, const uint64_t *up) {
 // Compute all ModInv of the group
 // ---------------------------------------------------------------------------------------
 
-__device__ __noinline__ void _ModInvGrouped(uint64_t r[GRP_SIZE / 2 + 1][4]) {
+template<int grp>
+__device__ __noinline__ void _ModInvGrouped(uint64_t r[grp / 2 + 1][4]) {
 
-  uint64_t subp[GRP_SIZE / 2 + 1][4];
+  uint64_t subp[grp / 2 + 1][4];
   uint64_t newValue[4];
   uint64_t inverse[5];
 
   Load256(subp[0], r[0]);
-  for (uint32_t i = 1; i < (GRP_SIZE / 2 + 1); i++) {
+  for (uint32_t i = 1; i < (grp / 2 + 1); i++) {
     _ModMult(subp[i], subp[i - 1], r[i]);
   }
 
   // We need 320bit signed int for ModInv
-  Load256(inverse, subp[(GRP_SIZE / 2 + 1) - 1]);
+  Load256(inverse, subp[(grp / 2 + 1) - 1]);
   inverse[4] = 0;
   _ModInv(inverse);
 
-  for (uint32_t i = (GRP_SIZE / 2 + 1) - 1; i > 0; i--) {
+  for (uint32_t i = (grp / 2 + 1) - 1; i > 0; i--) {
+    _ModMult(newValue, subp[i - 1], inverse);
+    _ModMult(inverse, r[i]);
+    Load256(r[i], newValue);
+  }
+
+  Load256(r[0], inverse);
+
+}
+
+// ---------------------------------------------------------------------------------------
+// Compute all ModInv of the group, one ModInv shared by the block
+// The group products of the threads are combined with a warp prefix and suffix product,
+// then the warp products are inverted by the first thread (blockDim.x must be a multiple
+// of 32). sInv (2*32*4 words of shared memory) holds the warp products and their prefixes.
+// Must be called by all threads of the block.
+// The __shfl_xxx_sync() warp shuffles need CUDA 9 and sm_30, GPU_BLOCK_KERNEL is not
+// defined with older SDK nor with HIP (64 threads wavefronts, the block kernel is not
+// compiled).
+// ---------------------------------------------------------------------------------------
+
+#if defined(CUDART_VERSION) && CUDART_VERSION >= 9000
+#define GPU_BLOCK_KERNEL
+#endif
+
+#ifdef GPU_BLOCK_KERNEL
+
+#define ShflUp256(r, a, d) {\
+  (r)[0] = __shfl_up_sync(0xFFFFFFFF, (a)[0], d); \
+  (r)[1] = __shfl_up_sync(0xFFFFFFFF, (a)[1], d); \
+  (r)[2] = __shfl_up_sync(0xFFFFFFFF, (a)[2], d); \
+  (r)[3] = __shfl_up_sync(0xFFFFFFFF, (a)[3], d);}
+
+#define ShflDown256(r, a, d) {\
+  (r)[0] = __shfl_down_sync(0xFFFFFFFF, (a)[0], d); \
+  (r)[1] = __shfl_down_sync(0xFFFFFFFF, (a)[1], d); \
+  (r)[2] = __shfl_down_sync(0xFFFFFFFF, (a)[2], d); \
+  (r)[3] = __shfl_down_sync(0xFFFFFFFF, (a)[3], d);}
+
+#define SetOne256(r) {\
+  (r)[0] = 1ULL; \
+  (r)[1] = 0ULL; \
+  (r)[2] = 0ULL; \
+  (r)[3] = 0ULL;}
+
+template<int grp>
+__device__ __noinline__ void _ModInvGroupedBlock(uint64_t r[grp / 2 + 1][4], uint64_t *sInv) {
+
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ < 300
+
+  // No warp shuffle (not reached, the engine uses the thread kernel below sm_30)
+  _ModInvGrouped<grp>(r);
+
+#else
+
+  uint64_t subp[grp / 2 + 1][4];
+  uint64_t newValue[4];
+  uint64_t inverse[5];
+  uint64_t pre[4];
+  uint64_t suf[4];
+  uint64_t t[4];
+  uint32_t lane = threadIdx.x & 31;
+  uint32_t warp = threadIdx.x >> 5;
+  uint32_t nbWarp = blockDim.x >> 5;
+
+  Load256(subp[0], r[0]);
+  for (uint32_t i = 1; i < (grp / 2 + 1); i++) {
+    _ModMult(subp[i], subp[i - 1], r[i]);
+  }
+
+  // Inclusive prefix and suffix products of the group products over the warp
+  Load256(pre, subp[(grp / 2 + 1) - 1]);
+  Load256(suf, subp[(grp / 2 + 1) - 1]);
+  for (uint32_t d = 1; d < 32; d <<= 1) {
+    ShflUp256(t, pre, d);
+    if (lane >= d) _ModMult(pre, t);
+    ShflDown256(t, suf, d);
+    if (lane + d < 32) _ModMult(suf, t);
+  }
+
+  // Warp products
+  uint64_t *w = sInv;
+  uint64_t *c = sInv + 32 * 4;
+  if (lane == 31) Load256(w + 4 * warp, pre);
+
+  // Exclusive prefix and suffix (product of the other threads of the warp)
+  ShflUp256(t, pre, 1);
+  if (lane == 0) SetOne256(t);
+  ShflDown256(pre, suf, 1);
+  if (lane == 31) SetOne256(pre);
+  _ModMult(t, pre);
+  __syncthreads();
+
+  if (threadIdx.x == 0) {
+
+    Load256(c, w);
+    for (uint32_t i = 1; i < nbWarp; i++) {
+      _ModMult(c + 4 * i, c + 4 * (i - 1), w + 4 * i);
+    }
+
+    Load256(inverse, c + 4 * (nbWarp - 1));
+    inverse[4] = 0;
+    _ModInv(inverse);
+
+    for (uint32_t i = nbWarp - 1; i > 0; i--) {
+      _ModMult(newValue, c + 4 * (i - 1), inverse);
+      _ModMult(inverse, w + 4 * i);
+      Load256(w + 4 * i, newValue);
+    }
+    Load256(w, inverse);
+
+  }
+  __syncthreads();
+
+  // Inverse of the group product of this thread
+  _ModMult(inverse, w + 4 * warp, t);
+  __syncthreads();
+
+  for (uint32_t i = (grp / 2 + 1) - 1; i > 0; i--) {
     _ModMult(newValue, subp[i - 1], inverse);
     _ModMult(inverse, r[i]);
     Load256(r[i], newValue);
@@ -909,4 +1083,8 @@ __device__ __noinline__ void _ModInvGrouped(uint64_t r[GRP_SIZE / 2 + 1][4]) {
 
   Load256(r[0], inverse);
 
+#endif
+
 }
+
+#endif // GPU_BLOCK_KERNEL
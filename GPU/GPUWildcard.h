@@ -19,41 +19,21 @@
 // Wildcard matcher
 // ---------------------------------------------------------------------------------
 
-__device__ __noinline__ bool _Match(const char *str, const char *pattern) {
-
-  const char *s;
-  const char *p;
-  bool star = false;
-
-loopStart:
-  for (s = str, p = pattern; *s; ++s, ++p) {
-
-    switch (*p) {
-    case '?':
-      if (*s == '.') goto starCheck;
-      break;
-
-    case '*':
-      star = true;
-      str = s, pattern = p;
-      if (!*++pattern) return true;
-      goto loopStart;
-
-    default:
-      //if (mapCaseTable[*s] != mapCaseTable[*p])
-      if (*s != *p)
-        goto starCheck;
-      break;
-    } /* endswitch */
-
-  } /* endfor */
-
-  if (*p == '*') ++p;
-  return (!*p);
-
-starCheck:
-  if (!star) return false;
-  str++;
-  goto loopStart;
+// Run the pattern automaton built by WildcardDFA (see Wildcard.h for the table layout)
+__device__ __noinline__ bool _Match(const char *str, uint16_t *dfa) {
+
+  uint8_t  *charClass = (uint8_t *)dfa;
+  uint16_t *trans = dfa + DFA_HEADER_SIZE;
+  uint32_t s = 1;
+  uint16_t t = 0;
+
+  for (; *str; str++) {
+    t = trans[s * DFA_NB_CLASS + charClass[*str & 0x7F]];
+    if (t & DFA_SINK) return true;
+    s = t & DFA_STATE_MASK;
+    if (s == 0) return false;
+  }
+
+  return (t & DFA_ACCEPT) != 0;
 
 }
@@ -0,0 +1,241 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GroupIFMA.h"
+#include "GroupTable.h"
+#include "IntGroup.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef WIN64
+#include <malloc.h>
+#else
+#include <mm_malloc.h>
+#endif
+
+#define MASK52 0xFFFFFFFFFFFFFULL
+#define K1     0x1000003D1ULL  // 2^256 mod p
+
+// Int (4 64 bits words) to 5 limbs of 52 bits stored every step words
+static inline void toLimbs(uint64_t *l, int step, Int *a) {
+
+  uint64_t *w = a->bits64;
+  l[0] = w[0] & MASK52;
+  l[step] = ((w[0] >> 52) | (w[1] << 12)) & MASK52;
+  l[2 * step] = ((w[1] >> 40) | (w[2] << 24)) & MASK52;
+  l[3 * step] = ((w[2] >> 28) | (w[3] << 36)) & MASK52;
+  l[4 * step] = w[3] >> 16;
+
+}
+
+// Lane l of 5 x 8 limbs to Int, fully reduced mod p
+static inline void toInt(Int *a, uint64_t *l, int lane) {
+
+  uint64_t l0 = l[lane];
+  uint64_t l1 = l[lane + 8];
+  uint64_t l2 = l[lane + 16];
+  uint64_t l3 = l[lane + 24];
+  uint64_t l4 = l[lane + 32];
+  uint64_t *w = a->bits64;
+
+  w[0] = l0 | (l1 << 52);
+  w[1] = (l1 >> 12) | (l2 << 40);
+  w[2] = (l2 >> 24) | (l3 << 28);
+  w[3] = (l3 >> 36) | (l4 << 16);
+  w[4] = 0;
+
+  if (l4 >> 48) {
+    // Value >= 2^256 (< 2^256+2^208), add (l4>>48)*(2^256 mod p)
+    unsigned char c = _addcarry_u64(0, w[0], (l4 >> 48) * K1, (unsigned long long *)(w + 0));
+    c = _addcarry_u64(c, w[1], 0, (unsigned long long *)(w + 1));
+    c = _addcarry_u64(c, w[2], 0, (unsigned long long *)(w + 2));
+    _addcarry_u64(c, w[3], 0, (unsigned long long *)(w + 3));
+  }
+
+  // Value >= p
+  if (w[3] == 0xFFFFFFFFFFFFFFFFULL && w[2] == 0xFFFFFFFFFFFFFFFFULL &&
+      w[1] == 0xFFFFFFFFFFFFFFFFULL && w[0] >= 0xFFFFFFFEFFFFFC2FULL) {
+    w[0] += K1;
+    w[1] = 0;
+    w[2] = 0;
+    w[3] = 0;
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+
+GroupIFMA::GroupIFMA(Point *Gn, int nbPoint) {
+
+  nbBlock = (nbPoint + IFMA_LANES - 1) / IFMA_LANES;
+  gx = (uint64_t *)_mm_malloc(nbBlock * 40 * sizeof(uint64_t), 64);
+  gy = (uint64_t *)_mm_malloc(nbBlock * 40 * sizeof(uint64_t), 64);
+  memset(gx, 0, nbBlock * 40 * sizeof(uint64_t));
+  memset(gy, 0, nbBlock * 40 * sizeof(uint64_t));
+
+  for (int i = 0; i < nbPoint; i++) {
+    toLimbs(gx + (i / IFMA_LANES) * 40 + i % IFMA_LANES, IFMA_LANES, &Gn[i].x);
+    toLimbs(gy + (i / IFMA_LANES) * 40 + i % IFMA_LANES, IFMA_LANES, &Gn[i].y);
+  }
+
+}
+
+GroupIFMA::~GroupIFMA() {
+  _mm_free(gx);
+  _mm_free(gy);
+}
+
+bool GroupIFMA::IsSupported() {
+
+#ifdef WIN64
+  int r[4];
+  __cpuid(r, 0);
+  if (r[0] < 7)
+    return false;
+  __cpuid(r, 1);
+  if ((r[2] & (1 << 27)) == 0) // OSXSAVE
+    return false;
+  uint64_t xcr0 = _xgetbv(0);
+  __cpuidex(r, 7, 0);
+  return (xcr0 & 0xE6) == 0xE6 && (r[1] & (1 << 16)) && (r[1] & (1 << 21)); // ZMM state, AVX512F and AVX512IFMA
+#else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+#endif
+
+}
+
+
+void GroupIFMA::ComputePoints(Point &p, int i, Int *dx, Int *px, Int *py, int center) {
+
+#ifdef WIN64
+  __declspec(align(64)) uint64_t l[40];
+  __declspec(align(64)) uint64_t o[4][40];
+#else
+  uint64_t l[40] __attribute__((aligned(64)));
+  uint64_t o[4][40] __attribute__((aligned(64)));
+#endif
+  uint64_t c[10];
+
+  toLimbs(c, 1, &p.x);
+  toLimbs(c + 5, 1, &p.y);
+  for (int lane = 0; lane < IFMA_LANES; lane++)
+    toLimbs(l + lane, IFMA_LANES, &dx[i + lane]);
+
+  groupifma_8(gx + (i / IFMA_LANES) * 40, gy + (i / IFMA_LANES) * 40, c, l, o[0]);
+
+  for (int lane = 0; lane < IFMA_LANES; lane++) {
+    int k = i + lane + 1;
+    toInt(&px[center + k], o[0], lane);
+    toInt(&py[center + k], o[1], lane);
+    toInt(&px[center - k], o[2], lane);
+    toInt(&py[center - k], o[3], lane);
+  }
+
+}
+
+// Scalar group fill of FindKeyCPU(), r = p + g (or p - g), dx = 1/(g.x-p.x)
+static void addScalar(Point &p, Point &g, bool neg, Int *dx, Int *rx, Int *ry) {
+
+  Int gy(&g.y);
+  Int dy;
+  Int _s;
+  Int _p;
+
+  if (neg) gy.ModNeg();
+  dy.ModSub(&gy, &p.y);
+  _s.ModMulK1(&dy, dx);
+  _p.ModSquareK1(&_s);
+
+  rx->Set(&p.x);
+  rx->ModNeg();
+  rx->ModAdd(&_p);
+  rx->ModSub(&g.x);
+
+  ry->ModSub(&g.x, rx);
+  ry->ModMulK1(&_s);
+  ry->ModSub(&gy);
+
+}
+
+bool GroupIFMA::Check(Secp256K1 *secp, int grpSize) {
+
+  printf("Check GroupIFMA: ");
+  if (!IsSupported()) {
+    printf("AVX-512 IFMA not supported by the CPU\n");
+    return true;
+  }
+
+  const int nbKey = 8;
+  int center = grpSize / 2;
+  int hLength = grpSize / 2 - 1;
+  GroupTable table;
+  table.Init(secp, grpSize);
+  GroupIFMA ifma(table.Gn, grpSize / 2);
+
+  Int *dx = new Int[grpSize / 2];
+  Int *px = new Int[grpSize + 1];
+  Int *py = new Int[grpSize + 1];
+  IntGroup grp(grpSize / 2);
+  grp.Set(dx);
+
+  // Group ends reaching 2*G and -2*G, then random base keys
+  Int keys[nbKey];
+  Int edge((uint64_t)(center + 1));
+  keys[0].Set(&edge);
+  keys[1].Set(&secp->order);
+  keys[1].Sub(&edge);
+  for (int k = 2; k < nbKey; k++) {
+    keys[k].Rand(256);
+    keys[k].Mod(&secp->order);
+  }
+
+  bool ok = true;
+  Int rx;
+  Int ry;
+  for (int k = 0; k < nbKey && ok; k++) {
+
+    Point p = secp->ComputePublicKey(&keys[k]);
+    for (int i = 0; i < grpSize / 2; i++)
+      dx[i].ModSub(&table.Gn[i].x, &p.x);
+    grp.ModInv();
+
+    int nbPoint = 0;
+    for (int i = 0; i + IFMA_LANES <= hLength; i += IFMA_LANES) {
+      ifma.ComputePoints(p, i, dx, px, py, center);
+      nbPoint += IFMA_LANES;
+    }
+
+    for (int i = 0; i < nbPoint && ok; i++) {
+      addScalar(p, table.Gn[i], false, &dx[i], &rx, &ry);
+      ok = rx.IsEqual(&px[center + i + 1]) && ry.IsEqual(&py[center + i + 1]);
+      addScalar(p, table.Gn[i], true, &dx[i], &rx, &ry);
+      ok = ok && rx.IsEqual(&px[center - i - 1]) && ry.IsEqual(&py[center - i - 1]);
+      if (!ok)
+        printf("Failed ! key=%s point=%d\n", keys[k].GetBase16().c_str(), i + 1);
+    }
+
+  }
+
+  if (ok)
+    printf("OK\n");
+
+  delete[] dx;
+  delete[] px;
+  delete[] py;
+  return ok;
+
+}
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GROUPIFMAH
+#define GROUPIFMAH
+
+#include "Point.h"
+#include <stdint.h>
+
+#define IFMA_LANES 8
+
+class Secp256K1;
+
+// AVX-512 IFMA kernel (GroupIFMA_avx512.cpp), limb blocks are 5 limbs x 8 lanes
+void groupifma_8(uint64_t *gx, uint64_t *gy, uint64_t *p, uint64_t *dx, uint64_t *out);
+
+// Group point additions using AVX-512 IFMA field arithmetic (8 lanes, 5x52 bits limbs).
+// Computes P+G[i] and P-G[i] of 8 consecutive i at once, the CPU support must be
+// checked with IsSupported() before creating an instance.
+class GroupIFMA {
+
+public:
+
+  // Gn: generator table of the group, nbPoint = group size/2
+  GroupIFMA(Point *Gn, int nbPoint);
+  ~GroupIFMA();
+
+  static bool IsSupported();
+
+  // Compares ComputePoints() with the scalar group fill on random base keys and
+  // on the keys whose group reaches 2*G and -2*G (-check)
+  static bool Check(Secp256K1 *secp, int grpSize);
+
+  // Compute the points center+(i+l+1) and center-(i+l+1) for l in [0,8)
+  // of the group starting at center point p, dx[] holds the inverses of (G[i].x-p.x).
+  // i must be a multiple of 8.
+  void ComputePoints(Point &p, int i, Int *dx, Int *px, Int *py, int center);
+
+private:
+
+  uint64_t *gx; // Gn x coordinates, blocks of 5 limbs x 8 lanes
+  uint64_t *gy; // Gn y coordinates, blocks of 5 limbs x 8 lanes
+  int nbBlock;
+
+};
+
+#endif // GROUPIFMAH
@@ -0,0 +1,224 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <immintrin.h>
+#include <stdint.h>
+
+// AVX-512 IFMA group point additions (8 lanes).
+// Functions are compiled for AVX-512 IFMA whatever the global target is, the caller
+// must check CPU support before calling them.
+#ifdef WIN64
+#define IFMA_FUNC
+#else
+#define IFMA_FUNC __attribute__((target("avx512f,avx512ifma")))
+#endif
+
+// Field elements are 5 limbs of 52 bits (one __m512i per limb, 8 lanes).
+// Results are kept below 2^256+2^208 with limbs < 2^52 (IFMA uses only the
+// 52 low bits of its inputs), they are fully reduced when converted back to Int.
+#define MASK52 0xFFFFFFFFFFFFFULL
+#define MASK48 0xFFFFFFFFFFFFULL
+#define K1     0x1000003D1ULL  // 2^256 mod p
+#define K16    0x1000003D10ULL // 2^260 mod p
+
+// 4p with borrowed limbs (l0..l3 >= 2^52) for the subtraction
+#define P4_0   0x1FFFFBFFFFF0BCULL
+#define P4_1   0x1FFFFFFFFFFFFEULL
+#define P4_4   0x3FFFFFFFFFFFEULL
+
+#define NORM(u,k) u[k+1] = _mm512_add_epi64(u[k+1], _mm512_srli_epi64(u[k], 52)); u[k] = _mm512_and_si512(u[k], m52);
+
+// Reduce a 10 limbs product modulo p
+IFMA_FUNC static inline void reduce512(__m512i *r, __m512i *t) {
+
+  __m512i m52 = _mm512_set1_epi64(MASK52);
+  __m512i k1 = _mm512_set1_epi64(K1);
+  __m512i k16 = _mm512_set1_epi64(K16);
+  __m512i u[6];
+
+  for (int k = 0; k < 9; k++) {
+    NORM(t, k);
+  }
+
+  // t[5+j] * 2^(260+52j) = t[5+j] * K16 * 2^52j
+  for (int j = 0; j < 5; j++)
+    u[j] = t[j];
+  u[5] = _mm512_setzero_si512();
+  for (int j = 0; j < 5; j++) {
+    u[j] = _mm512_madd52lo_epu64(u[j], t[5 + j], k16);
+    u[j + 1] = _mm512_madd52hi_epu64(u[j + 1], t[5 + j], k16);
+  }
+  for (int k = 0; k < 5; k++) {
+    NORM(u, k);
+  }
+
+  // Fold bits above 2^256
+  __m512i h = _mm512_or_si512(_mm512_srli_epi64(u[4], 48), _mm512_slli_epi64(u[5], 4));
+  u[4] = _mm512_and_si512(u[4], _mm512_set1_epi64(MASK48));
+  u[0] = _mm512_madd52lo_epu64(u[0], h, k1);
+  u[1] = _mm512_madd52hi_epu64(u[1], h, k1);
+  for (int k = 0; k < 4; k++) {
+    NORM(u, k);
+  }
+
+  for (int k = 0; k < 5; k++)
+    r[k] = u[k];
+
+}
+
+IFMA_FUNC static inline void modMul(__m512i *r, __m512i *a, __m512i *b) {
+
+  __m512i t[10];
+  for (int k = 0; k < 10; k++)
+    t[k] = _mm512_setzero_si512();
+
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 5; j++) {
+      t[i + j] = _mm512_madd52lo_epu64(t[i + j], a[i], b[j]);
+      t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], a[i], b[j]);
+    }
+  }
+
+  reduce512(r, t);
+
+}
+
+IFMA_FUNC static inline void modSquare(__m512i *r, __m512i *a) {
+
+  __m512i t[10];
+  for (int k = 0; k < 10; k++)
+    t[k] = _mm512_setzero_si512();
+
+  // Cross products are computed once and doubled
+  for (int i = 0; i < 5; i++) {
+    for (int j = i + 1; j < 5; j++) {
+      t[i + j] = _mm512_madd52lo_epu64(t[i + j], a[i], a[j]);
+      t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], a[i], a[j]);
+    }
+  }
+  for (int k = 0; k < 10; k++)
+    t[k] = _mm512_add_epi64(t[k], t[k]);
+  for (int i = 0; i < 5; i++) {
+    t[2 * i] = _mm512_madd52lo_epu64(t[2 * i], a[i], a[i]);
+    t[2 * i + 1] = _mm512_madd52hi_epu64(t[2 * i + 1], a[i], a[i]);
+  }
+
+  reduce512(r, t);
+
+}
+
+// Bring back a sum of limbs < 2^55 below 2^256+2^208
+IFMA_FUNC static inline void reduce256(__m512i *u) {
+
+  __m512i m52 = _mm512_set1_epi64(MASK52);
+  for (int k = 0; k < 4; k++) {
+    NORM(u, k);
+  }
+  __m512i h = _mm512_srli_epi64(u[4], 48);
+  u[4] = _mm512_and_si512(u[4], _mm512_set1_epi64(MASK48));
+  u[0] = _mm512_madd52lo_epu64(u[0], h, _mm512_set1_epi64(K1));
+  for (int k = 0; k < 4; k++) {
+    NORM(u, k);
+  }
+
+}
+
+IFMA_FUNC static inline void modAdd(__m512i *r, __m512i *a, __m512i *b) {
+
+  for (int k = 0; k < 5; k++)
+    r[k] = _mm512_add_epi64(a[k], b[k]);
+  reduce256(r);
+
+}
+
+// r = a + 4p - b
+IFMA_FUNC static inline void modSub(__m512i *r, __m512i *a, __m512i *b) {
+
+  r[0] = _mm512_sub_epi64(_mm512_add_epi64(a[0], _mm512_set1_epi64(P4_0)), b[0]);
+  r[1] = _mm512_sub_epi64(_mm512_add_epi64(a[1], _mm512_set1_epi64(P4_1)), b[1]);
+  r[2] = _mm512_sub_epi64(_mm512_add_epi64(a[2], _mm512_set1_epi64(P4_1)), b[2]);
+  r[3] = _mm512_sub_epi64(_mm512_add_epi64(a[3], _mm512_set1_epi64(P4_1)), b[3]);
+  r[4] = _mm512_sub_epi64(_mm512_add_epi64(a[4], _mm512_set1_epi64(P4_4)), b[4]);
+  reduce256(r);
+
+}
+
+IFMA_FUNC static inline void modNeg(__m512i *r, __m512i *a) {
+
+  r[0] = _mm512_sub_epi64(_mm512_set1_epi64(P4_0), a[0]);
+  r[1] = _mm512_sub_epi64(_mm512_set1_epi64(P4_1), a[1]);
+  r[2] = _mm512_sub_epi64(_mm512_set1_epi64(P4_1), a[2]);
+  r[3] = _mm512_sub_epi64(_mm512_set1_epi64(P4_1), a[3]);
+  r[4] = _mm512_sub_epi64(_mm512_set1_epi64(P4_4), a[4]);
+  reduce256(r);
+
+}
+
+IFMA_FUNC static inline void load(__m512i *r, uint64_t *l) {
+  for (int k = 0; k < 5; k++)
+    r[k] = _mm512_load_si512((__m512i *)(l + 8 * k));
+}
+
+IFMA_FUNC static inline void store(uint64_t *l, __m512i *r) {
+  for (int k = 0; k < 5; k++)
+    _mm512_store_si512((__m512i *)(l + 8 * k), r[k]);
+}
+
+// ----------------------------------------------------------------------------
+
+// Limb blocks are 5 limbs x 8 lanes, 64 bytes aligned.
+// gx,gy: G[i] block, p: center point (5 limbs x,y), dx: inverses of (G[i].x-p.x) block
+// out: P+G[i] x,y then P-G[i] x,y blocks
+IFMA_FUNC void groupifma_8(uint64_t *gx, uint64_t *gy, uint64_t *p, uint64_t *dx, uint64_t *out) {
+
+  __m512i Px[5], Py[5], Gx[5], Gy[5], Dx[5];
+  __m512i PGx[5], nGy[5];
+  __m512i dy[5], s[5], _p[5], rx[5], ry[5];
+
+  for (int k = 0; k < 5; k++) {
+    Px[k] = _mm512_set1_epi64(p[k]);
+    Py[k] = _mm512_set1_epi64(p[5 + k]);
+  }
+  load(Gx, gx);
+  load(Gy, gy);
+  load(Dx, dx);
+  modAdd(PGx, Px, Gx);
+
+  // P = startP + i*G
+  modSub(dy, Gy, Py);
+  modMul(s, dy, Dx);          // s = (p2.y-p1.y)*inverse(p2.x-p1.x);
+  modSquare(_p, s);           // _p = pow2(s)
+  modSub(rx, _p, PGx);        // rx = pow2(s) - p1.x - p2.x;
+  modSub(ry, Gx, rx);
+  modMul(ry, ry, s);
+  modSub(ry, ry, Gy);         // ry = - p2.y - s*(ret.x-p2.x);
+  store(out, rx);
+  store(out + 40, ry);
+
+  // P = startP - i*G  , if (x,y) = i*G then (x,-y) = -i*G
+  modNeg(nGy, Gy);
+  modSub(dy, nGy, Py);
+  modMul(s, dy, Dx);
+  modSquare(_p, s);
+  modSub(rx, _p, PGx);
+  modSub(ry, Gx, rx);
+  modMul(ry, ry, s);
+  modAdd(ry, ry, Gy);
+  store(out + 80, rx);
+  store(out + 120, ry);
+
+}
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GroupTable.h"
+
+GroupTable::GroupTable() {
+  Gn = NULL;
+  size = 0;
+}
+
+GroupTable::~GroupTable() {
+  delete[] Gn;
+}
+
+int GroupTable::GetSize() {
+  return size;
+}
+
+void GroupTable::Init(Secp256K1 *secp, int size) {
+
+  delete[] Gn;
+  this->size = size;
+  Gn = new Point[size / 2];
+
+  // One inversion for all points, faster than reading and checking a cache
+  Int *keys = new Int[size / 2];
+  for (int i = 0; i < size / 2; i++)
+    keys[i].SetInt32(i + 1);
+  secp->ComputePublicKeys(size / 2, keys, Gn);
+  delete[] keys;
+  _2Gn = secp->DoubleDirect(Gn[size / 2 - 1]);
+
+}
+
+void GroupTable::GetC64(uint64_t *gx, uint64_t *gy) {
+
+  for (int i = 0; i < size / 2; i++) {
+    for (int j = 0; j < 4; j++) {
+      gx[4 * i + j] = Gn[i].x.bits64[j];
+      gy[4 * i + j] = Gn[i].y.bits64[j];
+    }
+  }
+
+}
@@ -0,0 +1,46 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GROUPTABLEH
+#define GROUPTABLEH
+
+#include "SECP256k1.h"
+
+// Generator table of the group search, Gn[i] = (i+1)*G for i < size/2 and _2Gn = size*G
+// Computed at startup for any group size with a single batch inversion
+class GroupTable {
+
+public:
+
+  GroupTable();
+  ~GroupTable();
+
+  void Init(Secp256K1 *secp, int size);
+  int GetSize();
+  // Coordinates as size/2 x 4 64 bits words (device table layout)
+  void GetC64(uint64_t *gx, uint64_t *gy);
+
+  Point *Gn;
+  Point _2Gn;
+
+private:
+
+  int size;
+
+};
+
+#endif // GROUPTABLEH
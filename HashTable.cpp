@@ -0,0 +1,92 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "HashTable.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define EMPTY_VALUE 0xFFFFFFFF
+
+HashTable::HashTable() {
+  entries = NULL;
+  mask = 0;
+}
+
+HashTable::~HashTable() {
+  if (entries) free(entries);
+}
+
+void HashTable::Init(uint32_t nbItem) {
+
+  // Keep the load factor under 0.5
+  uint64_t size = 16;
+  while (size < 2 * (uint64_t)nbItem)
+    size <<= 1;
+
+  if (entries) free(entries);
+  entries = (ENTRY *)malloc(size * sizeof(ENTRY));
+  for (uint64_t i = 0; i < size; i++)
+    entries[i].value = EMPTY_VALUE;
+  mask = size - 1;
+
+}
+
+uint64_t HashTable::getStart(uint32_t *h) {
+  // The first 32 bits are already used by the prefix lookup tables
+  // and are shared by all items of a bucket, use the next 64 bits
+  return (((uint64_t)h[2] << 32) | (uint64_t)h[1]) & mask;
+}
+
+uint32_t HashTable::Add(uint8_t *hash160, uint32_t value) {
+
+  uint32_t h[5];
+  memcpy(h, hash160, 20);
+
+  uint64_t pos = getStart(h);
+  while (entries[pos].value != EMPTY_VALUE) {
+    if (memcmp(entries[pos].h, h, 20) == 0)
+      return entries[pos].value;
+    pos = (pos + 1) & mask;
+  }
+
+  memcpy(entries[pos].h, h, 20);
+  entries[pos].value = value;
+  return value;
+
+}
+
+bool HashTable::Find(uint8_t *hash160, uint32_t *value) {
+
+  uint32_t h[5];
+  memcpy(h, hash160, 20);
+
+  uint64_t pos = getStart(h);
+  while (entries[pos].value != EMPTY_VALUE) {
+    if (memcmp(entries[pos].h, h, 20) == 0) {
+      *value = entries[pos].value;
+      return true;
+    }
+    pos = (pos + 1) & mask;
+  }
+
+  return false;
+
+}
+
+uint64_t HashTable::GetMemory() {
+  return (mask + 1) * sizeof(ENTRY);
+}
@@ -0,0 +1,53 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HASHTABLEH
+#define HASHTABLEH
+
+#include <stdint.h>
+
+// Open addressing (linear probing) set of hash160 used for full address search
+// Each entry holds the hash160 and a 32 bit value, about 48-96 bytes
+// per address (table size is the power of 2 above twice the number of items)
+class HashTable {
+
+public:
+
+  HashTable();
+  ~HashTable();
+
+  void Init(uint32_t nbItem);
+  // Return the value of the entry already present or the given value when added
+  uint32_t Add(uint8_t *hash160, uint32_t value);
+  bool Find(uint8_t *hash160, uint32_t *value);
+  uint64_t GetMemory();
+
+private:
+
+  typedef struct {
+    uint32_t h[5];
+    uint32_t value;
+  } ENTRY;
+
+  uint64_t getStart(uint32_t *h);
+
+  ENTRY *entries;
+  uint64_t mask;
+
+};
+
+#endif // HASHTABLEH
@@ -701,7 +701,8 @@ void Int::ShiftL(uint32_t n) {
     uint32_t nb64 = n/64;
     uint32_t nb   = n%64;
     for(uint32_t i=0;i<nb64;i++) ShiftL64Bit();
-	  shiftL((unsigned char)nb, bits64);
+    // The gcc version of __shiftleft128 does not support n=0
+    if(nb) shiftL((unsigned char)nb, bits64);
   }
   
 }
@@ -19,40 +19,80 @@
 
 using namespace std;
 
-IntGroup::IntGroup(int size) {
+IntGroup::IntGroup(int size, int nbGroup) {
   this->size = size;
-  subp = (Int *)malloc(size * sizeof(Int));
+  this->nbGroup = nbGroup;
+  ints = (Int **)malloc(size * nbGroup * sizeof(Int *));
+  subp = (Int *)malloc(size * nbGroup * sizeof(Int));
 }
 
 IntGroup::~IntGroup() {
+  free(ints);
   free(subp);
 }
 
 void IntGroup::Set(Int *pts) {
-  ints = pts;
+  Set(0, pts);
 }
 
-// Compute modular inversion of the whole group
+void IntGroup::Set(int group, Int *pts) {
+  Int **g = ints + group * size;
+  for (int i = 0; i < size; i++)
+    g[i] = pts + i;
+}
+
+// Compute modular inversion of all groups
+// Elements of even and odd index are multiplied in 2 independent chains
+// (Montgomery trick) to hide the latency of ModMulK1, the product of both
+// chains is inverted once.
 void IntGroup::ModInv() {
 
-  Int newValue;
+  Int newValue0;
+  Int newValue1;
   Int inverse;
+  Int inv[2];
+  int i;
+  int n = size * nbGroup;
+
+  if (n < 2) {
+    ints[0]->ModInv();
+    return;
+  }
 
-  subp[0].Set(&ints[0]);
-  for (int i = 1; i < size; i++) {
-    subp[i].ModMulK1(&subp[i - 1], &ints[i]);
+  subp[0].Set(ints[0]);
+  subp[1].Set(ints[1]);
+  for (i = 2; i + 1 < n; i += 2) {
+    subp[i].ModMulK1(&subp[i - 2], ints[i]);
+    subp[i + 1].ModMulK1(&subp[i - 1], ints[i + 1]);
   }
+  if (i < n)
+    subp[i].ModMulK1(&subp[i - 2], ints[i]);
 
   // Do the inversion
-  inverse.Set(&subp[size - 1]);
+  int last0 = (n - 1) & ~1; // Last element of the even chain
+  int last1 = (n - 2) | 1;  // Last element of the odd chain
+  inverse.ModMulK1(&subp[last0], &subp[last1]);
   inverse.ModInv();
+  inv[0].ModMulK1(&inverse, &subp[last1]);
+  inv[1].ModMulK1(&inverse, &subp[last0]);
 
-  for (int i = size - 1; i > 0; i--) {
-    newValue.ModMulK1(&subp[i - 1], &inverse);
-    inverse.ModMulK1(&ints[i]);
-    ints[i].Set(&newValue);
+  i = n - 1;
+  if (i != last1) {
+    newValue0.ModMulK1(&subp[i - 2], &inv[0]);
+    inv[0].ModMulK1(ints[i]);
+    ints[i]->Set(&newValue0);
+    i--;
+  }
+  for (; i > 2; i -= 2) {
+    newValue1.ModMulK1(&subp[i - 2], &inv[1]);
+    newValue0.ModMulK1(&subp[i - 3], &inv[0]);
+    inv[1].ModMulK1(ints[i]);
+    inv[0].ModMulK1(ints[i - 1]);
+    ints[i]->Set(&newValue1);
+    ints[i - 1]->Set(&newValue0);
   }
 
-  ints[0].Set(&inverse);
+  ints[1]->Set(&inv[1]);
+  ints[0]->Set(&inv[0]);
 
-}
\ No newline at end of file
+}
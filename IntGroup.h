@@ -21,20 +21,24 @@
 #include "Int.h"
 #include <vector>
 
+// Batch modular inversion of nbGroup groups of size elements with a single
+// field inversion, the groups need not be contiguous
 class IntGroup {
 
 public:
 
-	IntGroup(int size);
+	IntGroup(int size, int nbGroup = 1);
 	~IntGroup();
 	void Set(Int *pts);
+	void Set(int group, Int *pts);
 	void ModInv();
 
 private:
 
-	Int *ints;
-  Int *subp;
+	Int **ints;  // Elements of all groups
+  Int *subp;   // Scratch buffer of all groups, allocated once
   int size;
+  int nbGroup;
 
 };
 
@@ -0,0 +1,115 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "MappedFile.h"
+#ifndef WIN64
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() {
+
+  data = NULL;
+  size = 0;
+#ifdef WIN64
+  hFile = INVALID_HANDLE_VALUE;
+  hMap = NULL;
+#else
+  fd = -1;
+#endif
+
+}
+
+MappedFile::~MappedFile() {
+  Close();
+}
+
+bool MappedFile::Open(std::string fileName) {
+
+  Close();
+
+#ifdef WIN64
+
+  hFile = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (hFile == INVALID_HANDLE_VALUE)
+    return false;
+  LARGE_INTEGER sz;
+  if (!GetFileSizeEx(hFile, &sz)) {
+    Close();
+    return false;
+  }
+  size = (size_t)sz.QuadPart;
+  if (size == 0)
+    return true;
+  hMap = CreateFileMapping(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (hMap == NULL) {
+    Close();
+    return false;
+  }
+  data = (const char *)MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+  if (data == NULL) {
+    Close();
+    return false;
+  }
+
+#else
+
+  fd = open(fileName.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    Close();
+    return false;
+  }
+  size = (size_t)st.st_size;
+  if (size == 0)
+    return true;
+  void *p = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (p == MAP_FAILED) {
+    Close();
+    return false;
+  }
+  data = (const char *)p;
+  // Prefetch, the whole file is read
+  madvise(p, size, MADV_WILLNEED);
+
+#endif
+
+  return true;
+
+}
+
+void MappedFile::Close() {
+
+#ifdef WIN64
+  if (data) UnmapViewOfFile(data);
+  if (hMap) CloseHandle(hMap);
+  if (hFile != INVALID_HANDLE_VALUE) CloseHandle(hFile);
+  hFile = INVALID_HANDLE_VALUE;
+  hMap = NULL;
+#else
+  if (data) munmap((void *)data, size);
+  if (fd >= 0) close(fd);
+  fd = -1;
+#endif
+  data = NULL;
+  size = 0;
+
+}
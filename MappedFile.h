@@ -0,0 +1,52 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MAPPEDFILEH
+#define MAPPEDFILEH
+
+#include <string>
+#include <stddef.h>
+#ifdef WIN64
+#include <Windows.h>
+#endif
+
+// Read only memory mapped file
+class MappedFile {
+
+public:
+
+  MappedFile();
+  ~MappedFile();
+
+  bool Open(std::string fileName);
+  void Close();
+
+  const char *data; // NULL for an empty file
+  size_t size;
+
+private:
+
+#ifdef WIN64
+  HANDLE hFile;
+  HANDLE hMap;
+#else
+  int fd;
+#endif
+
+};
+
+#endif // MAPPEDFILEH
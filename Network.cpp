@@ -0,0 +1,287 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Network.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef WIN64
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#define closesocket_ closesocket
+#define SEND_FLAGS 0
+typedef int socklen_t;
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <unistd.h>
+#define closesocket_ close
+#define SEND_FLAGS MSG_NOSIGNAL
+#endif
+#include "Timer.h"
+#include "hash/sha256.h"
+
+#define INVALID_FD ((intptr_t)-1)
+
+static bool initNetwork() {
+
+#ifdef WIN64
+  static bool wsaInit = false;
+  if (!wsaInit) {
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+      printf("TcpSocket: WSAStartup failed\n");
+      return false;
+    }
+    wsaInit = true;
+  }
+#endif
+  return true;
+
+}
+
+TcpSocket::TcpSocket() {
+  fd = INVALID_FD;
+}
+
+TcpSocket::~TcpSocket() {
+  Close();
+}
+
+bool TcpSocket::Listen(int port, std::string bindAddr) {
+
+  if (!initNetwork())
+    return false;
+
+  struct addrinfo hints;
+  struct addrinfo *res;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags = AI_PASSIVE;
+  if (getaddrinfo(bindAddr.c_str(), NULL, &hints, &res) != 0) {
+    printf("TcpSocket: cannot resolve %s\n", bindAddr.c_str());
+    return false;
+  }
+
+  struct sockaddr_in addr;
+  memcpy(&addr, res->ai_addr, sizeof(addr));
+  addr.sin_port = htons((uint16_t)port);
+  freeaddrinfo(res);
+
+  fd = (intptr_t)socket(AF_INET, SOCK_STREAM, 0);
+  if (fd == INVALID_FD) {
+    printf("TcpSocket: cannot create socket\n");
+    return false;
+  }
+
+  int yes = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, (const char *)&yes, sizeof(yes));
+
+  if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(fd, 16) != 0) {
+    printf("TcpSocket: cannot listen on %s:%d\n", bindAddr.c_str(), port);
+    Close();
+    return false;
+  }
+
+  return true;
+
+}
+
+TcpSocket *TcpSocket::Accept() {
+
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  intptr_t s = (intptr_t)accept(fd, (struct sockaddr *)&addr, &len);
+  if (s == INVALID_FD)
+    return NULL;
+
+  int yes = 1;
+  setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (const char *)&yes, sizeof(yes));
+
+  char tmp[64];
+  sprintf(tmp, "%s:%d", inet_ntoa(addr.sin_addr), (int)ntohs(addr.sin_port));
+
+  TcpSocket *ret = new TcpSocket();
+  ret->fd = s;
+  ret->peerName = std::string(tmp);
+  return ret;
+
+}
+
+bool TcpSocket::Connect(std::string host, int port) {
+
+  if (!initNetwork())
+    return false;
+
+  struct addrinfo hints;
+  struct addrinfo *res;
+  char portStr[16];
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  sprintf(portStr, "%d", port);
+
+  if (getaddrinfo(host.c_str(), portStr, &hints, &res) != 0) {
+    printf("TcpSocket: cannot resolve %s\n", host.c_str());
+    return false;
+  }
+
+  fd = (intptr_t)socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+  if (fd == INVALID_FD || connect(fd, res->ai_addr, (socklen_t)res->ai_addrlen) != 0) {
+    printf("TcpSocket: cannot connect to %s:%d\n", host.c_str(), port);
+    freeaddrinfo(res);
+    Close();
+    return false;
+  }
+  freeaddrinfo(res);
+
+  int yes = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (const char *)&yes, sizeof(yes));
+  peerName = host + ":" + std::string(portStr);
+  return true;
+
+}
+
+bool TcpSocket::ReadLine(std::string &line) {
+
+  char tmp[1024];
+  size_t pos;
+
+  while ((pos = buffer.find('\n')) == std::string::npos) {
+    if (fd == INVALID_FD)
+      return false;
+    if (buffer.length() > TCP_MAX_LINE) {
+      printf("\nTcpSocket: line too long from %s, peer dropped\n", peerName.c_str());
+      buffer.clear();
+      Close();
+      return false;
+    }
+    int nb = (int)recv(fd, tmp, sizeof(tmp), 0);
+    if (nb <= 0)
+      return false;
+    buffer.append(tmp, nb);
+  }
+
+  line = buffer.substr(0, pos);
+  buffer.erase(0, pos + 1);
+  if (line.length() > 0 && line[line.length() - 1] == '\r')
+    line.erase(line.length() - 1);
+  return true;
+
+}
+
+bool TcpSocket::WriteLine(std::string line) {
+
+  if (fd == INVALID_FD)
+    return false;
+
+  line += "\n";
+  const char *p = line.c_str();
+  int toSend = (int)line.length();
+  while (toSend > 0) {
+    int nb = (int)send(fd, p, toSend, SEND_FLAGS);
+    if (nb <= 0)
+      return false;
+    p += nb;
+    toSend -= nb;
+  }
+  return true;
+
+}
+
+static bool setTimeout(intptr_t fd, int opt, int seconds) {
+
+  if (fd == INVALID_FD)
+    return false;
+
+#ifdef WIN64
+  DWORD tv = (DWORD)seconds * 1000;
+#else
+  struct timeval tv;
+  tv.tv_sec = seconds;
+  tv.tv_usec = 0;
+#endif
+  return setsockopt(fd, SOL_SOCKET, opt, (const char *)&tv, sizeof(tv)) == 0;
+
+}
+
+bool TcpSocket::SetTimeout(int seconds) {
+  return setTimeout(fd, SO_RCVTIMEO, seconds);
+}
+
+bool TcpSocket::SetSendTimeout(int seconds) {
+  return setTimeout(fd, SO_SNDTIMEO, seconds);
+}
+
+void TcpSocket::Shutdown() {
+
+  if (fd != INVALID_FD) {
+#ifdef WIN64
+    shutdown((SOCKET)fd, SD_BOTH);
+#else
+    shutdown(fd, SHUT_RDWR);
+#endif
+  }
+
+}
+
+void TcpSocket::Close() {
+
+  if (fd != INVALID_FD) {
+    Shutdown();
+    closesocket_(fd);
+    fd = INVALID_FD;
+  }
+
+}
+
+std::string TcpSocket::GetPeerName() {
+  return peerName;
+}
+
+// Random shared secret (hex), printed by the server when none is given
+std::string TcpSocket::NewToken() {
+  return Timer::getSeed(16);
+}
+
+// Challenge response, the token itself never goes on the link
+std::string TcpSocket::AuthDigest(std::string nonce, std::string token) {
+
+  std::string msg = nonce + ":" + token;
+  uint8_t digest[32];
+  sha256((uint8_t *)msg.c_str(), (int)msg.length(), digest);
+  return sha256_hex(digest);
+
+}
+
+// Constant time comparison
+bool TcpSocket::SameDigest(std::string a, std::string b) {
+
+  if (a.length() != b.length())
+    return false;
+  unsigned char d = 0;
+  for (size_t i = 0; i < a.length(); i++)
+    d |= (unsigned char)(a[i] ^ b[i]);
+  return d == 0;
+
+}
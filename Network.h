@@ -0,0 +1,74 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NETWORKH
+#define NETWORKH
+
+#include <string>
+#include <stdint.h>
+
+// Longest accepted line, the peer is dropped beyond
+#define TCP_MAX_LINE 4096
+
+// Default listening address, other hosts reach the port only when given explicitly
+#define TCP_DEFAULT_BIND "127.0.0.1"
+
+// Seconds a peer has to complete the authentication handshake
+#define TCP_AUTH_TIMEOUT 10
+
+// Seconds a line may wait for a peer that stops reading, the peer is dropped beyond
+#define TCP_SEND_TIMEOUT 30
+
+// Minimal blocking TCP socket exchanging text lines (distributed search).
+// The link is neither encrypted nor integrity protected: found private keys
+// travel in clear text, use it on a trusted network or through a tunnel.
+class TcpSocket {
+
+public:
+
+  TcpSocket();
+  ~TcpSocket();
+
+  bool Listen(int port, std::string bindAddr = TCP_DEFAULT_BIND);
+  TcpSocket *Accept();
+  bool Connect(std::string host, int port);
+  bool ReadLine(std::string &line);
+  bool WriteLine(std::string line);
+  // Receive timeout in seconds (0 waits forever), ReadLine() fails on expiry
+  bool SetTimeout(int seconds);
+  // Send timeout in seconds (0 waits forever), WriteLine() fails on expiry
+  bool SetSendTimeout(int seconds);
+  // Wakes up a ReadLine() blocked in another thread, the socket stays allocated
+  void Shutdown();
+  void Close();
+  std::string GetPeerName();
+
+  // Shared secret authentication
+  static std::string NewToken();
+  static std::string AuthDigest(std::string nonce, std::string token);
+  static bool SameDigest(std::string a, std::string b);
+
+private:
+
+  // SOCKET on Windows, file descriptor elsewhere
+  intptr_t fd;
+  std::string buffer;
+  std::string peerName;
+
+};
+
+#endif // NETWORKH
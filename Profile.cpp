@@ -0,0 +1,132 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Profile.h"
+
+#ifdef WITHPROFILE
+
+#include "Timer.h"
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+
+// One cache line pair per slot, only written by its owner thread
+typedef struct {
+
+  uint64_t cycles[PROF_NB_PHASE];
+  uint64_t count[PROF_NB_PHASE];
+
+} PROF_COUNTER;
+
+#ifdef WIN64
+__declspec(align(128)) static PROF_COUNTER counters[PROF_NB_SLOT];
+#else
+static PROF_COUNTER counters[PROF_NB_SLOT] __attribute__((aligned(128)));
+#endif
+
+static thread_local int currentSlot = -1;
+static volatile sig_atomic_t dumpRequest = 0;
+static double startTime;
+static uint64_t startTick;
+
+static const char *phaseName[] = {
+  "ModInv","Points","Hash","Check","Verify","Output","GPU launch","GPU host"
+};
+
+static void sigDump(int sig) {
+  dumpRequest = 1;
+  signal(sig, sigDump);
+}
+
+// ----------------------------------------------------------------------------
+
+void Profile::Init() {
+
+  memset(counters, 0, sizeof(counters));
+  startTime = Timer::get_tick();
+  startTick = Tick();
+  dumpRequest = 0;
+#ifdef WIN64
+  signal(SIGBREAK, sigDump);
+#else
+  signal(SIGUSR1, sigDump);
+#endif
+
+}
+
+void Profile::SetSlot(int slot) {
+
+  currentSlot = (slot >= 0 && slot < PROF_NB_SLOT) ? slot : -1;
+
+}
+
+void Profile::Add(int phase, uint64_t cycles) {
+
+  if (currentSlot < 0)
+    return;
+  counters[currentSlot].cycles[phase] += cycles;
+  counters[currentSlot].count[phase]++;
+
+}
+
+bool Profile::DumpRequested() {
+
+  if (!dumpRequest)
+    return false;
+  dumpRequest = 0;
+  return true;
+
+}
+
+void Profile::Dump() {
+
+  // Calibrate the TSC against the wall clock since Init()
+  double elapsed = Timer::get_tick() - startTime;
+  double elapsedTick = (double)(Tick() - startTick);
+  if (elapsed <= 0.0 || elapsedTick <= 0.0)
+    return;
+  double freq = elapsedTick / elapsed;
+
+  printf("\nProfile: %.3f s, TSC %.0f MHz\n", elapsed, freq / 1e6);
+  printf("  %-10s %-10s %12s %10s %7s %12s\n", "Thread", "Phase", "Calls", "Time (s)", "Share", "Cycles/call");
+
+  for (int s = 0; s < PROF_NB_SLOT; s++) {
+
+    char name[32];
+    if (s < 0x80)
+      sprintf(name, "CPU #%d", s);
+    else if (s < PROF_VERIFY_SLOT)
+      sprintf(name, "GPU #%d", s - 0x80);
+    else
+      sprintf(name, "Verify #%d", s - PROF_VERIFY_SLOT);
+
+    for (int p = 0; p < PROF_NB_PHASE; p++) {
+      uint64_t count = counters[s].count[p];
+      if (count == 0)
+        continue;
+      double cycles = (double)counters[s].cycles[p];
+      printf("  %-10s %-10s %12llu %10.3f %6.2f%% %12.0f\n", name, phaseName[p], (unsigned long long)count,
+        cycles / freq, 100.0 * cycles / elapsedTick, cycles / (double)count);
+    }
+
+  }
+
+  fflush(stdout);
+
+}
+
+#endif // WITHPROFILE
@@ -0,0 +1,96 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PROFILEH
+#define PROFILEH
+
+// Phase level profiling, enabled when compiling with -DWITHPROFILE (make prof=1).
+// Phases are timed with the TSC and accumulated per thread, the table is
+// printed at the end of the search or on SIGUSR1 (Ctrl+Break on Windows).
+// When WITHPROFILE is not defined, all probes compile to nothing.
+
+// Phases
+#define PROF_MODINV     0 // Fill group and grouped ModInv
+#define PROF_POINTS     1 // Point generation and endomorphisms
+#define PROF_HASH       2 // hash160 (Scalar, SSE, AVX2 or AVX-512)
+#define PROF_CHECK      3 // Prefix lookup (checkAddr, pushFound)
+#define PROF_VERIFY     4 // Candidate verification (matchAddr, checkPrivKeys)
+#define PROF_OUTPUT     5 // Result output (included in PROF_VERIFY)
+#define PROF_GPU_LAUNCH 6 // Kernel wait and result copy
+#define PROF_GPU_HOST   7 // Host processing of GPU results
+#define PROF_NB_PHASE   8
+
+// Slots: CPU threads 0x00-0x7F, GPU threads 0x80-0xFF, verify threads 0x100-
+#define PROF_VERIFY_SLOT 0x100
+#define PROF_NB_SLOT     (PROF_VERIFY_SLOT + 16)
+
+#ifdef WITHPROFILE
+
+// NVTX ranges (visible in Nsight Systems), CUDA build only
+#if (defined(WITHGPU) || defined(__CUDACC__)) && !defined(WITHHIP)
+#include <nvToolsExt.h>
+#define PROF_RANGE_PUSH(name) nvtxRangePushA(name)
+#define PROF_RANGE_POP()      nvtxRangePop()
+#else
+#define PROF_RANGE_PUSH(name)
+#define PROF_RANGE_POP()
+#endif
+
+#ifndef __CUDACC__
+
+#include "Int.h" // __rdtsc()
+
+class Profile {
+
+public:
+
+  static void Init();
+  static void SetSlot(int slot);
+  static void Dump();
+  static bool DumpRequested();
+
+  static inline uint64_t Tick() {
+    return __rdtsc();
+  }
+
+  static void Add(int phase, uint64_t cycles);
+
+};
+
+#define PROF_INIT()          Profile::Init()
+#define PROF_THREAD(slot)    Profile::SetSlot(slot)
+#define PROF_START(phase)    uint64_t _prof_##phase = Profile::Tick()
+#define PROF_STOP(phase)     Profile::Add(phase, Profile::Tick() - _prof_##phase)
+#define PROF_POLL()          if (Profile::DumpRequested()) Profile::Dump()
+#define PROF_DUMP()          Profile::Dump()
+
+#endif // __CUDACC__
+
+#else
+
+#define PROF_RANGE_PUSH(name)
+#define PROF_RANGE_POP()
+#define PROF_INIT()
+#define PROF_THREAD(slot)
+#define PROF_START(phase)
+#define PROF_STOP(phase)
+#define PROF_POLL()
+#define PROF_DUMP()
+
+#endif // WITHPROFILE
+
+#endif // PROFILEH
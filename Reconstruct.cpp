@@ -0,0 +1,490 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Reconstruct.h"
+#include "Base58.h"
+#include "Bech32.h"
+#include "Timer.h"
+#include "hash/ripemd160.h"
+#include <string.h>
+#include <errno.h>
+#include <ctype.h>
+
+using namespace std;
+
+// ----------------------------------------------------------------------------
+
+#ifdef WIN64
+DWORD WINAPI _ReconstructKeys(LPVOID lpParam) {
+#else
+void *_ReconstructKeys(void *lpParam) {
+#endif
+  RP_PARAM *p = (RP_PARAM *)lpParam;
+  p->obj->ReconstructKeys(p);
+  return 0;
+}
+
+KeyReconstructor::KeyReconstructor(Secp256K1 *secp, string outputFile, int nbThread) {
+
+  this->secp = secp;
+  this->outputFile = outputFile;
+  this->nbThread = (nbThread > 0) ? nbThread : 1;
+  writer = NULL;
+  pos = NULL;
+  lineIdx = 0;
+  error = false;
+  nbEntry = 0;
+  nbFound = 0;
+
+#ifdef WIN64
+  mutex = CreateMutex(NULL, FALSE, NULL);
+#else
+  pthread_mutex_init(&mutex, NULL);
+#endif
+
+}
+
+KeyReconstructor::~KeyReconstructor() {
+
+#ifdef WIN64
+  CloseHandle(mutex);
+#else
+  pthread_mutex_destroy(&mutex);
+#endif
+
+}
+
+void KeyReconstructor::lock() {
+
+#ifdef WIN64
+  WaitForSingleObject(mutex, INFINITE);
+#else
+  pthread_mutex_lock(&mutex);
+#endif
+
+}
+
+void KeyReconstructor::unlock() {
+
+#ifdef WIN64
+  ReleaseMutex(mutex);
+#else
+  pthread_mutex_unlock(&mutex);
+#endif
+
+}
+
+// ----------------------------------------------------------------------------
+
+// Next non empty line of the input file, ending spaces removed
+bool KeyReconstructor::nextLine(string &line) {
+
+  const char *end = file.data + file.size;
+
+  while (pos < end) {
+
+    const char *e = (const char *)memchr(pos, '\n', end - pos);
+    if (e == NULL) e = end;
+
+    const char *l = e;
+    while (l > pos && isspace((unsigned char)l[-1]))
+      l--;
+
+    const char *b = pos;
+    pos = e + 1;
+    if (l > b) {
+      line.assign(b, l - b);
+      lineIdx++;
+      return true;
+    }
+
+  }
+
+  return false;
+
+}
+
+// Read the next batch of (PubAddress, PartialPriv) entries
+int KeyReconstructor::nextEntries(RP_ENTRY *entries) {
+
+  int nb = 0;
+  string l1;
+  string l2;
+
+  lock();
+
+  while (!error && nb < RP_BATCH_SIZE) {
+
+    int line = lineIdx;
+    if (!nextLine(l1))
+      break;
+
+    if (l1.substr(0, 12) != "PubAddress: ") {
+      printf("Invalid partialkey info file at line %d (\"PubAddress: \" expected)\n", line);
+      error = true;
+      break;
+    }
+
+    if (!nextLine(l2) || l2.substr(0, 13) != "PartialPriv: ") {
+      printf("Invalid partialkey info file at line %d (\"PartialPriv: \" expected)\n", line);
+      error = true;
+      break;
+    }
+
+    RP_ENTRY &e = entries[nb];
+    e.line = line;
+    e.addr = l1.substr(12);
+    e.partialPriv = l2.substr(13);
+
+    switch (e.addr.data()[0]) {
+    case '1':
+      e.type = P2PKH; break;
+    case '3':
+      e.type = P2SH; break;
+    case 'b':
+    case 'B':
+      e.type = BECH32; break;
+    default:
+      printf("Invalid partialkey info file at line %d\n", line);
+      printf("%s Address format not supported\n", e.addr.c_str());
+      continue;
+    }
+
+    nb++;
+    nbEntry++;
+
+  }
+
+  unlock();
+
+  return nb;
+
+}
+
+// Address to hash160, candidates are compared on the hash160
+bool KeyReconstructor::decodeAddress(RP_ENTRY &e, uint8_t *hash160) {
+
+  if (e.type == BECH32) {
+
+    uint8_t witprog[40];
+    size_t witprog_len;
+    int witver;
+    string addr = e.addr;
+    for (size_t i = 0; i < addr.length(); i++)
+      addr[i] = tolower(addr[i]);
+    if (!segwit_addr_decode(&witver, witprog, &witprog_len, "bc", addr.c_str()) || witprog_len != 20)
+      return false;
+    memcpy(hash160, witprog, 20);
+
+  } else {
+
+    vector<unsigned char> result;
+    if (!DecodeBase58(e.addr, result) || result.size() != 25)
+      return false;
+    memcpy(hash160, result.data() + 1, 20);
+
+  }
+
+  return true;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void KeyReconstructor::reconstructBatch(int nbEntry, RP_ENTRY *entries, IntGroup *grp, Int *keys, Point *pts,
+                                        Int *dx, Int *rx, Int *ry) {
+
+  uint8_t target[RP_BATCH_SIZE][20];
+  int order[RP_BATCH_SIZE];
+  int found[RP_BATCH_SIZE];
+  bool valid[RP_BATCH_SIZE];
+  vector<int> special;
+  int typeEnd[3];
+  int nbValid = 0;
+
+  // Decode the partial keys
+  for (int i = 0; i < nbEntry; i++) {
+
+    RP_ENTRY &e = entries[i];
+    bool partialMode;
+    valid[i] = false;
+    found[i] = -1;
+    keys[i].SetInt32(1);
+
+    if (!decodeAddress(e, target[i])) {
+      printf("Invalid partialkey info file at line %d\n", e.line);
+      printf("%s Address format not supported\n", e.addr.c_str());
+      continue;
+    }
+
+    Int k = secp->DecodePrivateKey((char *)e.partialPriv.c_str(), &partialMode);
+    if (k.IsNegative() || k.IsZero()) {
+      printf("Invalid partialkey info file at line %d\n", e.line);
+      error = true;
+      continue;
+    }
+
+    if (partialMode != compressed) {
+      printf("Warning, Invalid partialkey at line %d (Wrong compression mode, ignoring key)\n", e.line);
+      continue;
+    }
+
+    keys[i].Set(&k);
+    valid[i] = true;
+
+  }
+
+  // Valid entries sorted by address type, the 6 candidates of an entry are consecutive
+  for (int t = 0; t < 3; t++) {
+    for (int i = 0; i < nbEntry; i++)
+      if (valid[i] && entries[i].type == t)
+        order[nbValid++] = i;
+    typeEnd[t] = 6 * nbValid;
+  }
+  int nbCand = 6 * nbValid;
+
+  // One grouped inversion for the partial public keys
+  secp->ComputePublicKeys(nbEntry, keys, pts);
+
+  // One grouped inversion for the 6*nbValid additions
+  for (int c = 0; c < nbCand; c++) {
+    dx[c].ModSub(&privPub[c % 6].x, &pts[order[c / 6]].x);
+    if (dx[c].IsZero()) {
+      // P = +/-Q, computed apart
+      special.push_back(c);
+      dx[c].SetInt32(1);
+    }
+  }
+  for (int c = nbCand; c < 6 * RP_BATCH_SIZE; c++)
+    dx[c].SetInt32(1);
+  grp->ModInv();
+
+  Int dy;
+  Int _s;
+  Int _p;
+  for (int c = 0; c < nbCand; c++) {
+
+    Point &p = pts[order[c / 6]];
+    Point &q = privPub[c % 6];
+
+    dy.ModSub(&q.y, &p.y);
+    _s.ModMulK1(&dy, &dx[c]);       // s = (q.y-p.y)*inverse(q.x-p.x);
+    _p.ModSquareK1(&_s);            // _p = pow2(s)
+
+    rx[c].ModSub(&_p, &p.x);
+    rx[c].ModSub(&q.x);             // rx = pow2(s) - p.x - q.x;
+
+    ry[c].ModSub(&p.x, &rx[c]);
+    ry[c].ModMulK1(&_s);
+    ry[c].ModSub(&p.y);             // ry = s*(p.x-rx) - p.y;
+
+  }
+
+  for (int i = 0; i < (int)special.size(); i++) {
+    int c = special[i];
+    Int k;
+    k.ModAddK1order(&privKey[c % 6], &keys[order[c / 6]]);
+    if (k.IsZero()) {
+      // Point at infinity, never matches
+      rx[c].SetInt32(0);
+      ry[c].SetInt32(0);
+    } else {
+      Point r = secp->ComputePublicKey(&k);
+      rx[c].Set(&r.x);
+      ry[c].Set(&r.y);
+    }
+  }
+
+  // Hash the candidates 4 by 4 (SSE)
+  Int lx[4];
+  Int ly[4];
+  uint8_t h[4][20];
+  int start = 0;
+  for (int t = 0; t < 3; t++) {
+
+    for (int c = start; c < typeEnd[t]; c += 4) {
+
+      int nbLane = typeEnd[t] - c;
+      if (nbLane > 4) nbLane = 4;
+      for (int l = 0; l < 4; l++) {
+        int cl = c + ((l < nbLane) ? l : nbLane - 1);
+        lx[l].Set(&rx[cl]);
+        ly[l].Set(&ry[cl]);
+      }
+      secp->GetHash160(t, compressed, 4, lx, ly, h);
+
+      for (int l = 0; l < nbLane; l++) {
+        int i = order[(c + l) / 6];
+        if (found[i] < 0 && ripemd160_comp_hash(h[l], target[i]))
+          found[i] = (c + l) % 6;
+      }
+
+    }
+    start = typeEnd[t];
+
+  }
+
+  // Results in file order
+  static const char *typeName[] = { "p2pkh","p2wpkh-p2sh","p2wpkh" };
+  string r;
+  int nbOK = 0;
+  for (int i = 0; i < nbEntry; i++) {
+
+    if (!valid[i])
+      continue;
+
+    if (found[i] < 0) {
+      printf("Unable to reconstruct final key from partialkey line %d\n Addr: %s\n PartKey: %s\n",
+        entries[i].line, entries[i].addr.c_str(), entries[i].partialPriv.c_str());
+      continue;
+    }
+
+    Int fullPriv;
+    fullPriv.ModAddK1order(&privKey[found[i]], &keys[i]);
+    r.append("\nPub Addr: " + entries[i].addr + "\n");
+    r.append("Priv (WIF): " + string(typeName[entries[i].type]) + ":" + secp->GetPrivAddress(compressed, fullPriv) + "\n");
+    r.append("Priv (HEX): 0x" + fullPriv.GetBase16() + "\n");
+    nbOK++;
+
+  }
+
+  if (r.length() > 0)
+    writer->Write(r);
+
+  lock();
+  nbFound += nbOK;
+  unlock();
+
+}
+
+void KeyReconstructor::ReconstructKeys(RP_PARAM *p) {
+
+  RP_ENTRY *entries = new RP_ENTRY[RP_BATCH_SIZE];
+  Int *keys = new Int[RP_BATCH_SIZE];
+  Point *pts = new Point[RP_BATCH_SIZE];
+  Int *dx = new Int[6 * RP_BATCH_SIZE];
+  Int *rx = new Int[6 * RP_BATCH_SIZE];
+  Int *ry = new Int[6 * RP_BATCH_SIZE];
+  IntGroup *grp = new IntGroup(6 * RP_BATCH_SIZE);
+  grp->Set(dx);
+
+  int nb;
+  while ((nb = nextEntries(entries)) > 0)
+    reconstructBatch(nb, entries, grp, keys, pts, dx, rx, ry);
+
+  delete grp;
+  delete[] ry;
+  delete[] rx;
+  delete[] dx;
+  delete[] pts;
+  delete[] keys;
+  delete[] entries;
+
+  p->isRunning = false;
+
+}
+
+// ----------------------------------------------------------------------------
+
+bool KeyReconstructor::Run(string privAddr, string fileName) {
+
+  Int k = secp->DecodePrivateKey((char *)privAddr.c_str(), &compressed);
+  if (k.IsNegative() || k.IsZero())
+    return false;
+
+  Int lambda;
+  Int lambda2;
+  Int beta;
+  Int beta2;
+  lambda.SetBase16("5363ad4cc05c30e0a5261c028812645a122e22ea20816678df02967c1b23bd72");
+  lambda2.SetBase16("ac9c52b33fa3cf1f5ad9e3fd77ed9ba4a880b9fc8ec739c2e0cfc810b51283ce");
+  beta.SetBase16("7ae96a2b657c07106e64479eac3434e99cf0497512f58995c1396c28719501ee");
+  beta2.SetBase16("851695d49a83f8ef919bb86153cbcb16630fb68aed0a766a3ec693d68e6afa40");
+
+  // No sym + endo 0,1,2 then sym + endo 0,1,2
+  // if (x, y) = k * G, then (beta*x, y) = lambda*k*G and (x, -y) = -k*G
+  privKey[0].Set(&k);
+  privKey[1].Set(&k);
+  privKey[1].ModMulK1order(&lambda);
+  privKey[2].Set(&k);
+  privKey[2].ModMulK1order(&lambda2);
+  privPub[0] = secp->ComputePublicKey(&k);
+  privPub[1] = privPub[0];
+  privPub[1].x.ModMulK1(&beta);
+  privPub[2] = privPub[0];
+  privPub[2].x.ModMulK1(&beta2);
+  for (int i = 0; i < 3; i++) {
+    privKey[i + 3].Set(&privKey[i]);
+    privKey[i + 3].Neg();
+    privKey[i + 3].Add(&secp->order);
+    privPub[i + 3] = privPub[i];
+    privPub[i + 3].y.ModNeg();
+  }
+
+  if (!file.Open(fileName)) {
+    printf("Error: Cannot open %s %s\n", fileName.c_str(), strerror(errno));
+    return false;
+  }
+  pos = file.data;
+  lineIdx = 0;
+  error = false;
+  nbEntry = 0;
+  nbFound = 0;
+  bool progress = file.size > 100000 && outputFile.length() > 0;
+
+  double t0 = Timer::get_tick();
+  writer = new ResultWriter(outputFile, "", SYNC_NONE);
+
+  RP_PARAM *params = (RP_PARAM *)malloc(nbThread * sizeof(RP_PARAM));
+  memset(params, 0, nbThread * sizeof(RP_PARAM));
+  for (int i = 0; i < nbThread; i++) {
+    params[i].obj = this;
+    params[i].threadId = i;
+    params[i].isRunning = true;
+#ifdef WIN64
+    DWORD thread_id;
+    CreateThread(NULL, 0, _ReconstructKeys, (void*)(params + i), 0, &thread_id);
+#else
+    pthread_t thread_id;
+    pthread_create(&thread_id, NULL, &_ReconstructKeys, (void*)(params + i));
+#endif
+  }
+
+  for (int i = 0; i < nbThread; i++) {
+    while (params[i].isRunning) {
+      Timer::SleepMillis(50);
+      if (progress) {
+        lock();
+        double done = (file.size > 0) ? (double)(pos - file.data) * 100.0 / (double)file.size : 100.0;
+        unlock();
+        printf("[Reconstructing %5.1f%%]\r", (done > 100.0) ? 100.0 : done);
+      }
+    }
+  }
+
+  // Write pending results
+  delete writer;
+  writer = NULL;
+  free(params);
+  file.Close();
+
+  double t1 = Timer::get_tick();
+  printf("[Reconstructed %u/%u keys in %.3f s]\n", nbFound, nbEntry, t1 - t0);
+
+  return !error;
+
+}
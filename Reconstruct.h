@@ -0,0 +1,103 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef RECONSTRUCTH
+#define RECONSTRUCTH
+
+#include <string>
+#include "SECP256k1.h"
+#include "IntGroup.h"
+#include "MappedFile.h"
+#include "ResultWriter.h"
+#ifdef WIN64
+#include <Windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// Number of partial keys per batch (6 candidates per key)
+#define RP_BATCH_SIZE 1024
+
+typedef struct {
+
+  int line;
+  int type;
+  std::string addr;
+  std::string partialPriv;
+
+} RP_ENTRY;
+
+class KeyReconstructor;
+
+typedef struct {
+
+  KeyReconstructor *obj;
+  int threadId;
+  bool isRunning;
+
+} RP_PARAM;
+
+// Reconstruct final private keys from a partial key info file (-rp).
+// The file is mapped and read by batches of entries, each thread computes
+// the public keys of its batch with one grouped inversion, then adds the
+// 6 points (endomorphisms and symmetrics) of the private key to all of them
+// with a second grouped inversion. Results are written as batches end.
+class KeyReconstructor {
+
+public:
+
+  KeyReconstructor(Secp256K1 *secp, std::string outputFile, int nbThread);
+  ~KeyReconstructor();
+
+  bool Run(std::string privAddr, std::string fileName);
+  void ReconstructKeys(RP_PARAM *p);
+
+private:
+
+  int nextEntries(RP_ENTRY *entries);
+  bool decodeAddress(RP_ENTRY &e, uint8_t *hash160);
+  bool nextLine(std::string &line);
+  void reconstructBatch(int nbEntry, RP_ENTRY *entries, IntGroup *grp, Int *keys, Point *pts, Int *dx, Int *rx, Int *ry);
+  void lock();
+  void unlock();
+
+  Secp256K1 *secp;
+  std::string outputFile;
+  int nbThread;
+  bool compressed;
+  Int privKey[6];
+  Point privPub[6];
+
+  // Input file cursor (protected by the mutex)
+  MappedFile file;
+  const char *pos;
+  int lineIdx;
+  volatile bool error;
+
+  ResultWriter *writer;
+  uint32_t nbEntry;
+  uint32_t nbFound;
+
+#ifdef WIN64
+  HANDLE mutex;
+#else
+  pthread_mutex_t mutex;
+#endif
+
+};
+
+#endif // RECONSTRUCTH
@@ -0,0 +1,245 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ResultWriter.h"
+#include "Timer.h"
+#ifdef WIN64
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// ----------------------------------------------------------------------------
+
+#ifdef WIN64
+DWORD WINAPI _WriteThread(LPVOID lpParam) {
+#else
+void *_WriteThread(void *lpParam) {
+#endif
+  ((ResultWriter *)lpParam)->WriteThread();
+  return 0;
+}
+
+ResultWriter::ResultWriter(string fileName, string header, int syncPolicy) {
+
+  this->fileName = fileName;
+  this->syncPolicy = syncPolicy;
+  records = new string[RESULT_QUEUE_SIZE];
+  head = 0;
+  tail = 0;
+  written = 0;
+  f = stdout;
+
+  if (fileName.length() > 0) {
+    f = fopen(fileName.c_str(), "a");
+    if (f == NULL) {
+      printf("Cannot open %s for writing\n", fileName.c_str());
+      f = stdout;
+    } else if (header.length() > 0 && ftell(f) == 0) {
+      fputs(header.c_str(), f);
+      fflush(f);
+    }
+  }
+
+#ifdef WIN64
+  mutex = CreateMutex(NULL, FALSE, NULL);
+  notEmpty = CreateEvent(NULL, FALSE, FALSE, NULL);
+  notFull = CreateEvent(NULL, TRUE, FALSE, NULL);
+#else
+  pthread_mutex_init(&mutex, NULL);
+  pthread_cond_init(&notEmpty, NULL);
+  pthread_cond_init(&notFull, NULL);
+#endif
+
+  endOfWrite = false;
+#ifdef WIN64
+  DWORD thread_id;
+  thread = CreateThread(NULL, 0, _WriteThread, (void*)this, 0, &thread_id);
+#else
+  pthread_create(&thread, NULL, &_WriteThread, (void*)this);
+#endif
+
+}
+
+ResultWriter::~ResultWriter() {
+
+  // Write pending records before leaving
+  lock();
+  endOfWrite = true;
+#ifdef WIN64
+  SetEvent(notEmpty);
+#else
+  pthread_cond_signal(&notEmpty);
+#endif
+  unlock();
+
+#ifdef WIN64
+  WaitForSingleObject(thread, INFINITE);
+  CloseHandle(thread);
+#else
+  pthread_join(thread, NULL);
+#endif
+
+  if (f != stdout)
+    fclose(f);
+  delete[] records;
+
+#ifdef WIN64
+  CloseHandle(notEmpty);
+  CloseHandle(notFull);
+  CloseHandle(mutex);
+#else
+  pthread_cond_destroy(&notEmpty);
+  pthread_cond_destroy(&notFull);
+  pthread_mutex_destroy(&mutex);
+#endif
+
+}
+
+void ResultWriter::lock() {
+
+#ifdef WIN64
+  WaitForSingleObject(mutex, INFINITE);
+#else
+  pthread_mutex_lock(&mutex);
+#endif
+
+}
+
+void ResultWriter::unlock() {
+
+#ifdef WIN64
+  ReleaseMutex(mutex);
+#else
+  pthread_mutex_unlock(&mutex);
+#endif
+
+}
+
+void ResultWriter::sync() {
+
+  fflush(f);
+  if (f == stdout)
+    return;
+#ifdef WIN64
+  _commit(_fileno(f));
+#else
+  fsync(fileno(f));
+#endif
+
+}
+
+void ResultWriter::Write(string &record) {
+
+  lock();
+  while (tail - head >= RESULT_QUEUE_SIZE) {
+    // Ring full, wait for the writer
+#ifdef WIN64
+    unlock();
+    WaitForSingleObject(notFull, INFINITE);
+    lock();
+#else
+    pthread_cond_wait(&notFull, &mutex);
+#endif
+  }
+  records[tail % RESULT_QUEUE_SIZE].swap(record);
+  tail++;
+#ifdef WIN64
+  SetEvent(notEmpty);
+#else
+  pthread_cond_signal(&notEmpty);
+#endif
+  unlock();
+
+}
+
+// Wait until the records already queued are written
+void ResultWriter::Flush() {
+
+  lock();
+  uint32_t end = tail;
+  while ((int32_t)(written - end) < 0) {
+#ifdef WIN64
+    unlock();
+    WaitForSingleObject(notFull, INFINITE);
+    lock();
+#else
+    pthread_cond_wait(&notFull, &mutex);
+#endif
+  }
+  unlock();
+
+}
+
+void ResultWriter::WriteThread() {
+
+  string batch;
+
+  lock();
+
+  while (true) {
+
+    while (head == tail && !endOfWrite) {
+#ifdef WIN64
+      unlock();
+      WaitForSingleObject(notEmpty, INFINITE);
+      lock();
+#else
+      pthread_cond_wait(&notEmpty, &mutex);
+#endif
+    }
+
+    if (head == tail)
+      break;
+
+#ifdef WIN64
+    // Set again when the batch is written
+    ResetEvent(notFull);
+#endif
+    while (head != tail) {
+      string &r = records[head % RESULT_QUEUE_SIZE];
+      batch.append(r);
+      r.clear();
+      head++;
+      if (syncPolicy == SYNC_ALWAYS)
+        break;
+    }
+    uint32_t end = head;
+    unlock();
+
+    fputs(batch.c_str(), f);
+    batch.clear();
+    if (syncPolicy == SYNC_NONE)
+      fflush(f);
+    else
+      sync();
+
+    lock();
+    written = end;
+#ifdef WIN64
+    SetEvent(notFull);
+#else
+    pthread_cond_broadcast(&notFull);
+#endif
+
+  }
+
+  unlock();
+
+}
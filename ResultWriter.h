@@ -0,0 +1,88 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef RESULTWRITERH
+#define RESULTWRITERH
+
+#include <string>
+#include <stdio.h>
+#include <stdint.h>
+#ifdef WIN64
+#include <Windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// Output formats
+#define OUTPUT_TEXT  0
+#define OUTPUT_JSONL 1
+#define OUTPUT_CSV   2
+
+// Sync policies
+#define SYNC_NONE   0 // Flush after each batch, no fsync
+#define SYNC_BATCH  1 // fsync after each batch
+#define SYNC_ALWAYS 2 // fsync after each result
+
+#define RESULT_QUEUE_SIZE 4096
+
+// Dedicated thread writing results to a file (or stdout) opened once.
+// Search threads only copy the formatted result in a bounded ring buffer,
+// they wait only when the ring is full.
+class ResultWriter {
+
+public:
+
+  // header is written when the file is created (or empty)
+  ResultWriter(std::string fileName, std::string header, int syncPolicy);
+  ~ResultWriter();
+
+  void Write(std::string &record);
+  void Flush();
+  void WriteThread();
+
+private:
+
+  void lock();
+  void unlock();
+  void sync();
+
+  std::string fileName;
+  FILE *f;
+  int syncPolicy;
+
+  std::string *records;
+  uint32_t head;
+  uint32_t tail;
+
+  uint32_t written;  // Records written and flushed
+  bool endOfWrite;
+
+#ifdef WIN64
+  HANDLE mutex;
+  HANDLE notEmpty;
+  HANDLE notFull;   // Signaled after each batch
+  HANDLE thread;
+#else
+  pthread_mutex_t mutex;
+  pthread_cond_t notEmpty;
+  pthread_cond_t notFull;
+  pthread_t thread;
+#endif
+
+};
+
+#endif // RESULTWRITERH
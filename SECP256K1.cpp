@@ -20,6 +20,8 @@
 #include "hash/ripemd160.h"
 #include "Base58.h"
 #include "Bech32.h"
+#include "IntGroup.h"
+#include "Timer.h"
 #include <string.h>
 
 Secp256K1::Secp256K1() {
@@ -169,6 +171,54 @@ void Secp256K1::Check() {
 }
 
 
+// Compares each lane of the SSE (4), AVX2 (8) or AVX-512 (16) hash160 kernels
+// with the scalar GetHash160() for compressed, uncompressed and P2SH keys.
+// CPU support must be checked by the caller.
+bool Secp256K1::CheckHash160(int nbLane) {
+
+  printf("Check Hash160 %s (%d lanes) :", nbLane == 16 ? "AVX-512" : nbLane == 8 ? "AVX2" : "SSE", nbLane);
+
+  static const int types[3] = { P2PKH, P2PKH, P2SH };
+  static const bool modes[3] = { true, false, true };
+  Int x[16];
+  Int y[16];
+  Point p[16];
+  uint8_t h[16][20];
+  uint8_t ref[20];
+  Int k;
+  bool ok = true;
+
+  for (int r = 0; r < 16 && ok; r++) {
+
+    for (int l = 0; l < nbLane; l++) {
+      k.Rand(256);
+      k.Mod(&order);
+      p[l] = ComputePublicKey(&k);
+      x[l].Set(&p[l].x);
+      y[l].Set(&p[l].y);
+    }
+
+    for (int t = 0; t < 3 && ok; t++) {
+      if (nbLane == 4)
+        GetHash160(types[t], modes[t], x, y, h[0], h[1], h[2], h[3]);
+      else
+        GetHash160(types[t], modes[t], nbLane, x, y, h);
+      for (int l = 0; l < nbLane && ok; l++) {
+        GetHash160(types[t], modes[t], p[l], ref);
+        ok = ripemd160_comp_hash(h[l], ref);
+        if (!ok)
+          printf("Failed ! %s lane %d\n", types[t] == P2SH ? "P2SH" : modes[t] ? "compressed" : "uncompressed", l);
+      }
+    }
+
+  }
+
+  if (ok)
+    PrintResult(true);
+  return ok;
+
+}
+
 Point Secp256K1::ComputePublicKey(Int *privKey) {
 
   int i = 0;
@@ -182,6 +232,8 @@ Point Secp256K1::ComputePublicKey(Int *privKey) {
     if(b)
       break;
   }
+  if (i == 32)
+    return Q;
   Q = GTable[256 * i + (b-1)];
   i++;
 
@@ -191,11 +243,106 @@ Point Secp256K1::ComputePublicKey(Int *privKey) {
       Q = Add2(Q, GTable[256 * i + (b-1)]);
   }
 
+  // Add2() met a doubling or an opposite point
+  if (Q.z.IsZero())
+    return ComputePublicKeyAffine(privKey);
+
   Q.Reduce();
   return Q;
 
 }
 
+Point Secp256K1::ComputePublicKeyAffine(Int *privKey) {
+
+  // Same table walk with one inversion per byte, the doubling and the
+  // point at infinity (returned cleared, z = 0) are handled
+  Point Q;
+  Q.Clear();
+  bool infinity = true;
+
+  for (int i = 0; i < 32; i++) {
+    uint8_t b = privKey->GetByte(i);
+    if (!b)
+      continue;
+    Point &T = GTable[256 * i + (b - 1)];
+    if (infinity) {
+      Q = T;
+      infinity = false;
+    } else if (!Q.x.IsEqual(&T.x)) {
+      Q = AddDirect(Q, T);
+    } else if (Q.y.IsEqual(&T.y)) {
+      Q = DoubleDirect(Q);
+    } else {
+      Q.Clear();
+      infinity = true;
+    }
+  }
+
+  return Q;
+
+}
+
+void Secp256K1::ComputePublicKeys(int nbKey, Int *privKeys, Point *pubKeys) {
+
+  // Same fixed-base table walk as ComputePublicKey() but the points
+  // are left in projective coordinates and reduced together with a
+  // single grouped inversion
+  Int *zs = new Int[nbKey];
+  bool *affine = new bool[nbKey];
+  IntGroup grp(nbKey);
+
+  for (int k = 0; k < nbKey; k++) {
+
+    int i = 0;
+    uint8_t b;
+    Point Q;
+
+    for (i = 0; i < 32; i++) {
+      b = privKeys[k].GetByte(i);
+      if (b)
+        break;
+    }
+
+    bool zero = (i == 32);
+    if (!zero) {
+      Q = GTable[256 * i + (b - 1)];
+      i++;
+      for (; i < 32; i++) {
+        b = privKeys[k].GetByte(i);
+        if (b)
+          Q = Add2(Q, GTable[256 * i + (b - 1)]);
+      }
+    }
+
+    // A zero key or a degenerate Add2() (z = 0) would poison the grouped
+    // inversion, it takes the affine path and stays out of the group
+    affine[k] = zero || Q.z.IsZero();
+    if (affine[k]) {
+      pubKeys[k] = ComputePublicKeyAffine(&privKeys[k]);
+      zs[k].SetInt32(1);
+    } else {
+      pubKeys[k] = Q;
+      zs[k].Set(&Q.z);
+    }
+
+  }
+
+  grp.Set(zs);
+  grp.ModInv();
+
+  for (int k = 0; k < nbKey; k++) {
+    if (affine[k])
+      continue;
+    pubKeys[k].x.ModMulK1(&zs[k]);
+    pubKeys[k].y.ModMulK1(&zs[k]);
+    pubKeys[k].z.SetInt32(1);
+  }
+
+  delete[] affine;
+  delete[] zs;
+
+}
+
 Point Secp256K1::NextKey(Point &key) {
   // Input key must be reduced and different from G
   // in order to use AddDirect
@@ -273,16 +420,16 @@ Int Secp256K1::DecodePrivateKey(char *key,bool *compressed) {
 
 }
 
-#define KEYBUFFCOMP(buff,p) \
-(buff)[0] = ((p).x.bits[7] >> 8) | ((uint32_t)(0x2 + (p).y.IsOdd()) << 24); \
-(buff)[1] = ((p).x.bits[6] >> 8) | ((p).x.bits[7] <<24); \
-(buff)[2] = ((p).x.bits[5] >> 8) | ((p).x.bits[6] <<24); \
-(buff)[3] = ((p).x.bits[4] >> 8) | ((p).x.bits[5] <<24); \
-(buff)[4] = ((p).x.bits[3] >> 8) | ((p).x.bits[4] <<24); \
-(buff)[5] = ((p).x.bits[2] >> 8) | ((p).x.bits[3] <<24); \
-(buff)[6] = ((p).x.bits[1] >> 8) | ((p).x.bits[2] <<24); \
-(buff)[7] = ((p).x.bits[0] >> 8) | ((p).x.bits[1] <<24); \
-(buff)[8] = 0x00800000 | ((p).x.bits[0] <<24); \
+#define KEYBUFFCOMPXY(buff,x,y) \
+(buff)[0] = ((x).bits[7] >> 8) | ((uint32_t)(0x2 + (y).IsOdd()) << 24); \
+(buff)[1] = ((x).bits[6] >> 8) | ((x).bits[7] <<24); \
+(buff)[2] = ((x).bits[5] >> 8) | ((x).bits[6] <<24); \
+(buff)[3] = ((x).bits[4] >> 8) | ((x).bits[5] <<24); \
+(buff)[4] = ((x).bits[3] >> 8) | ((x).bits[4] <<24); \
+(buff)[5] = ((x).bits[2] >> 8) | ((x).bits[3] <<24); \
+(buff)[6] = ((x).bits[1] >> 8) | ((x).bits[2] <<24); \
+(buff)[7] = ((x).bits[0] >> 8) | ((x).bits[1] <<24); \
+(buff)[8] = 0x00800000 | ((x).bits[0] <<24); \
 (buff)[9] = 0; \
 (buff)[10] = 0; \
 (buff)[11] = 0; \
@@ -291,24 +438,24 @@ Int Secp256K1::DecodePrivateKey(char *key,bool *compressed) {
 (buff)[14] = 0; \
 (buff)[15] = 0x108;
 
-#define KEYBUFFUNCOMP(buff,p) \
-(buff)[0] = ((p).x.bits[7] >> 8) | 0x04000000; \
-(buff)[1] = ((p).x.bits[6] >> 8) | ((p).x.bits[7] <<24); \
-(buff)[2] = ((p).x.bits[5] >> 8) | ((p).x.bits[6] <<24); \
-(buff)[3] = ((p).x.bits[4] >> 8) | ((p).x.bits[5] <<24); \
-(buff)[4] = ((p).x.bits[3] >> 8) | ((p).x.bits[4] <<24); \
-(buff)[5] = ((p).x.bits[2] >> 8) | ((p).x.bits[3] <<24); \
-(buff)[6] = ((p).x.bits[1] >> 8) | ((p).x.bits[2] <<24); \
-(buff)[7] = ((p).x.bits[0] >> 8) | ((p).x.bits[1] <<24); \
-(buff)[8] = ((p).y.bits[7] >> 8) | ((p).x.bits[0] <<24); \
-(buff)[9] = ((p).y.bits[6] >> 8) | ((p).y.bits[7] <<24); \
-(buff)[10] = ((p).y.bits[5] >> 8) | ((p).y.bits[6] <<24); \
-(buff)[11] = ((p).y.bits[4] >> 8) | ((p).y.bits[5] <<24); \
-(buff)[12] = ((p).y.bits[3] >> 8) | ((p).y.bits[4] <<24); \
-(buff)[13] = ((p).y.bits[2] >> 8) | ((p).y.bits[3] <<24); \
-(buff)[14] = ((p).y.bits[1] >> 8) | ((p).y.bits[2] <<24); \
-(buff)[15] = ((p).y.bits[0] >> 8) | ((p).y.bits[1] <<24); \
-(buff)[16] = 0x00800000 | ((p).y.bits[0] <<24); \
+#define KEYBUFFUNCOMPXY(buff,x,y) \
+(buff)[0] = ((x).bits[7] >> 8) | 0x04000000; \
+(buff)[1] = ((x).bits[6] >> 8) | ((x).bits[7] <<24); \
+(buff)[2] = ((x).bits[5] >> 8) | ((x).bits[6] <<24); \
+(buff)[3] = ((x).bits[4] >> 8) | ((x).bits[5] <<24); \
+(buff)[4] = ((x).bits[3] >> 8) | ((x).bits[4] <<24); \
+(buff)[5] = ((x).bits[2] >> 8) | ((x).bits[3] <<24); \
+(buff)[6] = ((x).bits[1] >> 8) | ((x).bits[2] <<24); \
+(buff)[7] = ((x).bits[0] >> 8) | ((x).bits[1] <<24); \
+(buff)[8] = ((y).bits[7] >> 8) | ((x).bits[0] <<24); \
+(buff)[9] = ((y).bits[6] >> 8) | ((y).bits[7] <<24); \
+(buff)[10] = ((y).bits[5] >> 8) | ((y).bits[6] <<24); \
+(buff)[11] = ((y).bits[4] >> 8) | ((y).bits[5] <<24); \
+(buff)[12] = ((y).bits[3] >> 8) | ((y).bits[4] <<24); \
+(buff)[13] = ((y).bits[2] >> 8) | ((y).bits[3] <<24); \
+(buff)[14] = ((y).bits[1] >> 8) | ((y).bits[2] <<24); \
+(buff)[15] = ((y).bits[0] >> 8) | ((y).bits[1] <<24); \
+(buff)[16] = 0x00800000 | ((y).bits[0] <<24); \
 (buff)[17] = 0; \
 (buff)[18] = 0; \
 (buff)[19] = 0; \
@@ -325,6 +472,9 @@ Int Secp256K1::DecodePrivateKey(char *key,bool *compressed) {
 (buff)[30] = 0; \
 (buff)[31] = 0x208;
 
+#define KEYBUFFCOMP(buff,p) KEYBUFFCOMPXY(buff,(p).x,(p).y)
+#define KEYBUFFUNCOMP(buff,p) KEYBUFFUNCOMPXY(buff,(p).x,(p).y)
+
 #define KEYBUFFSCRIPT(buff,h) \
 (buff)[0] = 0x00140000 | (uint32_t)h[0] << 8 | (uint32_t)h[1]; \
 (buff)[1] = (uint32_t)h[2] << 24 | (uint32_t)h[3] << 16 | (uint32_t)h[4] << 8 | (uint32_t)h[5];\
@@ -343,8 +493,9 @@ Int Secp256K1::DecodePrivateKey(char *key,bool *compressed) {
 (buff)[14] = 0; \
 (buff)[15] = 0xB0;
 
-void Secp256K1::GetHash160(int type,bool compressed,
-  Point &k0,Point &k1,Point &k2,Point &k3,
+// Compute hash160 of 4 points at once using the SSE kernels, the coordinates
+// are read from 4 consecutive x[] and y[] entries (structure of arrays)
+void Secp256K1::GetHash160(int type,bool compressed,Int *x,Int *y,
   uint8_t *h0,uint8_t *h1,uint8_t *h2,uint8_t *h3) {
 
 #ifdef WIN64
@@ -372,10 +523,10 @@ void Secp256K1::GetHash160(int type,bool compressed,
       uint32_t b2[32];
       uint32_t b3[32];
 
-      KEYBUFFUNCOMP(b0, k0);
-      KEYBUFFUNCOMP(b1, k1);
-      KEYBUFFUNCOMP(b2, k2);
-      KEYBUFFUNCOMP(b3, k3);
+      KEYBUFFUNCOMPXY(b0, x[0], y[0]);
+      KEYBUFFUNCOMPXY(b1, x[1], y[1]);
+      KEYBUFFUNCOMPXY(b2, x[2], y[2]);
+      KEYBUFFUNCOMPXY(b3, x[3], y[3]);
 
       sha256sse_2B(b0, b1, b2, b3, sh0, sh1, sh2, sh3);
       ripemd160sse_32(sh0, sh1, sh2, sh3, h0, h1, h2, h3);
@@ -387,10 +538,10 @@ void Secp256K1::GetHash160(int type,bool compressed,
       uint32_t b2[16];
       uint32_t b3[16];
 
-      KEYBUFFCOMP(b0, k0);
-      KEYBUFFCOMP(b1, k1);
-      KEYBUFFCOMP(b2, k2);
-      KEYBUFFCOMP(b3, k3);
+      KEYBUFFCOMPXY(b0, x[0], y[0]);
+      KEYBUFFCOMPXY(b1, x[1], y[1]);
+      KEYBUFFCOMPXY(b2, x[2], y[2]);
+      KEYBUFFCOMPXY(b3, x[3], y[3]);
 
       sha256sse_1B(b0, b1, b2, b3, sh0, sh1, sh2, sh3);
       ripemd160sse_32(sh0, sh1, sh2, sh3, h0, h1, h2, h3);
@@ -408,21 +559,160 @@ void Secp256K1::GetHash160(int type,bool compressed,
     unsigned char kh2[20];
     unsigned char kh3[20];
 
-    GetHash160(P2PKH,compressed,k0,k1,k2,k3,kh0,kh1,kh2,kh3);
+    GetHash160(P2PKH,compressed,x,y,kh0,kh1,kh2,kh3);
+    GetScriptHash160(kh0, kh1, kh2, kh3, h0, h1, h2, h3);
 
-    // Redeem Script (1 to 1 P2SH)
-    uint32_t b0[16];
-    uint32_t b1[16];
-    uint32_t b2[16];
-    uint32_t b3[16];
+  }
+  break;
+
+  }
+
+}
+
+// Compute the P2SH hash160 (1 to 1 P2WPKH-P2SH redeem script) of 4 public key
+// hash160 at once using the SSE kernels
+void Secp256K1::GetScriptHash160(uint8_t *kh0, uint8_t *kh1, uint8_t *kh2, uint8_t *kh3,
+  uint8_t *h0, uint8_t *h1, uint8_t *h2, uint8_t *h3) {
+
+#ifdef WIN64
+  __declspec(align(16)) unsigned char sh0[64];
+  __declspec(align(16)) unsigned char sh1[64];
+  __declspec(align(16)) unsigned char sh2[64];
+  __declspec(align(16)) unsigned char sh3[64];
+#else
+  unsigned char sh0[64] __attribute__((aligned(16)));
+  unsigned char sh1[64] __attribute__((aligned(16)));
+  unsigned char sh2[64] __attribute__((aligned(16)));
+  unsigned char sh3[64] __attribute__((aligned(16)));
+#endif
+
+  // Redeem Script (1 to 1 P2SH)
+  uint32_t b0[16];
+  uint32_t b1[16];
+  uint32_t b2[16];
+  uint32_t b3[16];
+
+  KEYBUFFSCRIPT(b0, kh0);
+  KEYBUFFSCRIPT(b1, kh1);
+  KEYBUFFSCRIPT(b2, kh2);
+  KEYBUFFSCRIPT(b3, kh3);
+
+  sha256sse_1B(b0, b1, b2, b3, sh0, sh1, sh2, sh3);
+  ripemd160sse_32(sh0, sh1, sh2, sh3, h0, h1, h2, h3);
+
+}
+
+// Compute the P2SH hash160 of nbLane public key hash160 (1, 4, 8 or 16 lanes)
+void Secp256K1::GetScriptHash160(int nbLane, uint8_t kh[][20], uint8_t h[][20]) {
+
+  if (nbLane == 1) {
+
+    unsigned char script[64];
+    unsigned char shapk[64];
+    script[0] = 0x00;  // OP_0
+    script[1] = 0x14;  // PUSH 20 bytes
+    memcpy(script + 2, kh[0], 20);
+    sha256(script, 22, shapk);
+    ripemd160_32(shapk, h[0]);
+    return;
+
+  }
+
+  if (nbLane == 4) {
+    GetScriptHash160(kh[0], kh[1], kh[2], kh[3], h[0], h[1], h[2], h[3]);
+    return;
+  }
 
-    KEYBUFFSCRIPT(b0, kh0);
-    KEYBUFFSCRIPT(b1, kh1);
-    KEYBUFFSCRIPT(b2, kh2);
-    KEYBUFFSCRIPT(b3, kh3);
+  uint32_t b[16][16];
+  uint8_t sh[16][64];
+  uint32_t *bs[16];
+  uint8_t *shs[16];
+  uint8_t *hs[16];
+
+  for (int l = 0; l < nbLane; l++) {
+    KEYBUFFSCRIPT(b[l], kh[l]);
+    bs[l] = b[l];
+    shs[l] = sh[l];
+    hs[l] = h[l];
+  }
+
+  if (nbLane == 16) {
+    sha256avx512_1B(bs, shs);
+    ripemd160avx512_32(shs, hs);
+  } else {
+    sha256avx2_1B(bs, shs);
+    ripemd160avx2_32(shs, hs);
+  }
+
+}
+
+// Compute hash160 of nbLane points at once using the AVX2 (8 lanes)
+// or AVX-512 (16 lanes) kernels. CPU support must be checked by the caller.
+// 1 and 4 lanes use the scalar and SSE functions.
+void Secp256K1::GetHash160(int type, bool compressed, int nbLane, Int *x, Int *y, uint8_t h[][20]) {
+
+  if (nbLane == 1) {
+    Point p;
+    p.x.Set(x);
+    p.y.Set(y);
+    GetHash160(type, compressed, p, h[0]);
+    return;
+  }
 
-    sha256sse_1B(b0, b1, b2, b3, sh0, sh1, sh2, sh3);
-    ripemd160sse_32(sh0, sh1, sh2, sh3, h0, h1, h2, h3);
+  if (nbLane == 4) {
+    GetHash160(type, compressed, x, y, h[0], h[1], h[2], h[3]);
+    return;
+  }
+
+  uint32_t b[16][32];
+  uint8_t sh[16][64];
+  uint32_t *bs[16];
+  uint8_t *shs[16];
+  uint8_t *hs[16];
+
+  for (int l = 0; l < nbLane; l++) {
+    bs[l] = b[l];
+    shs[l] = sh[l];
+    hs[l] = h[l];
+  }
+
+  switch (type) {
+
+  case P2PKH:
+  case BECH32:
+  {
+
+    if (!compressed) {
+
+      for (int l = 0; l < nbLane; l++) {
+        KEYBUFFUNCOMPXY(b[l], x[l], y[l]);
+      }
+      if (nbLane == 16) sha256avx512_2B(bs, shs);
+      else              sha256avx2_2B(bs, shs);
+
+    } else {
+
+      for (int l = 0; l < nbLane; l++) {
+        KEYBUFFCOMPXY(b[l], x[l], y[l]);
+      }
+      if (nbLane == 16) sha256avx512_1B(bs, shs);
+      else              sha256avx2_1B(bs, shs);
+
+    }
+
+    if (nbLane == 16) ripemd160avx512_32(shs, hs);
+    else              ripemd160avx2_32(shs, hs);
+
+  }
+  break;
+
+  case P2SH:
+  {
+
+    uint8_t kh[16][20];
+
+    GetHash160(P2PKH, compressed, nbLane, x, y, kh);
+    GetScriptHash160(nbLane, kh, h);
 
   }
   break;
@@ -1067,3 +1357,86 @@ bool Secp256K1::EC(Point &p) {
   return _s.IsZero(); // ( ((pow2(y) - (pow3(x) + 7)) % P) == 0 );
 
 }
+
+// Run code nbTry times (nbItem items per call), keep the best of BENCH_RUN runs
+#define BENCH(name,unit,nbItem,nbTry,code) {                      \
+  double best = 0.0;                                              \
+  for (int r = 0; r < BENCH_RUN; r++) {                           \
+    double t0 = Timer::get_tick();                                \
+    for (int n = 0; n < (nbTry); n++) { code; }                   \
+    double t1 = Timer::get_tick();                                \
+    if (r == 0 || (t1 - t0) < best) best = t1 - t0;               \
+  }                                                               \
+  printf("%-24s: %s\n", name, Timer::getResult(unit, (nbItem)*(nbTry), 0.0, best).c_str()); \
+}
+
+void Secp256K1::Bench() {
+
+  // Fixed inputs
+  Int a;
+  Int b;
+  char name[64];
+  a.SetBase16("46b9e861b63d3509c88b7817275a30d22d62c8cd8fa6486ddee35ef0d8e0495f");
+  b.SetBase16("6c1f4b2a29b1f3a95d1f7fa5e68e1b7b4d2c0a6e0e7d4f1c3b5a79e8e0f1d2c3");
+
+  BENCH("Int::ModMulK1", "mul", 1, 1000000, a.ModMulK1(&a, &b));
+  BENCH("Int::ModSquareK1", "sqr", 1, 1000000, a.ModSquareK1(&a));
+  BENCH("Int::ModInv", "inv", 1, 10000, a.ModInv());
+
+  int grpSize[] = { 16, 64, 256, 513, 1024 };
+  for (int s = 0; s < 5; s++) {
+    int size = grpSize[s];
+    Int *dx = new Int[size];
+    for (int i = 0; i < size; i++) {
+      dx[i].Set(&a);
+      dx[i].AddOne();
+      a.ModMulK1(&dx[i], &b);
+    }
+    IntGroup grp(size);
+    grp.Set(dx);
+    sprintf(name, "IntGroup::ModInv(%d)", size);
+    BENCH(name, "inv", size, 100000 / size, grp.ModInv());
+    delete[] dx;
+  }
+
+  // Hash functions (4 lanes per call)
+  Point p[4];
+  Int px[4];
+  Int py[4];
+  uint8_t h[4][32];
+  uint32_t b1[4][16];
+  uint32_t b2[4][32];
+  Int k(&a);
+  for (int i = 0; i < 4; i++) {
+    p[i] = ComputePublicKey(&k);
+    px[i].Set(&p[i].x);
+    py[i].Set(&p[i].y);
+    KEYBUFFCOMP(b1[i], p[i]);
+    KEYBUFFUNCOMP(b2[i], p[i]);
+    k.AddOne();
+  }
+
+  BENCH("sha256sse_1B", "hash", 4, 200000,
+    sha256sse_1B(b1[0], b1[1], b1[2], b1[3], h[0], h[1], h[2], h[3]));
+  BENCH("sha256sse_2B", "hash", 4, 100000,
+    sha256sse_2B(b2[0], b2[1], b2[2], b2[3], h[0], h[1], h[2], h[3]));
+  BENCH("ripemd160sse_32", "hash", 4, 200000,
+    ripemd160sse_32(h[0], h[1], h[2], h[3], h[0], h[1], h[2], h[3]));
+  BENCH("GetHash160 (P2PKH)", "hash", 4, 100000,
+    GetHash160(P2PKH, true, px, py, h[0], h[1], h[2], h[3]));
+  BENCH("GetHash160 (P2SH)", "hash", 4, 50000,
+    GetHash160(P2SH, true, px, py, h[0], h[1], h[2], h[3]));
+
+  // Address encoding
+  unsigned char add[25];
+  char output[128];
+  add[0] = 0;
+  memcpy(add + 1, h[0], 20);
+  sha256_checksum(add, 21, add + 21);
+  BENCH("EncodeBase58", "addr", 1, 200000, EncodeBase58(add, add + 25));
+  BENCH("segwit_addr_encode", "addr", 1, 200000, segwit_addr_encode(output, "bc", 0, h[0], 20));
+
+  // Scalar multiplication
+  BENCH("ComputePublicKey", "key", 1, 20000, p[0] = ComputePublicKey(&k); k.AddOne());
+
+}
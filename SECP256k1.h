@@ -35,16 +35,25 @@ public:
   ~Secp256K1();
   void Init();
   Point ComputePublicKey(Int *privKey);
+  void ComputePublicKeys(int nbKey, Int *privKeys, Point *pubKeys);
   Point NextKey(Point &key);
   void Check();
+  bool CheckHash160(int nbLane);
+  void Bench();
   bool  EC(Point &p);
 
-  void GetHash160(int type,bool compressed,
-    Point &k0, Point &k1, Point &k2, Point &k3,
+  void GetHash160(int type,bool compressed,Int *x,Int *y,
     uint8_t *h0, uint8_t *h1, uint8_t *h2, uint8_t *h3);
 
   void GetHash160(int type,bool compressed, Point &pubKey, unsigned char *hash);
 
+  void GetHash160(int type,bool compressed,int nbLane,Int *x,Int *y,uint8_t h[][20]);
+
+  void GetScriptHash160(uint8_t *kh0, uint8_t *kh1, uint8_t *kh2, uint8_t *kh3,
+    uint8_t *h0, uint8_t *h1, uint8_t *h2, uint8_t *h3);
+
+  void GetScriptHash160(int nbLane, uint8_t kh[][20], uint8_t h[][20]);
+
   std::string GetAddress(int type, bool compressed, Point &pubKey);
   std::string GetAddress(int type, bool compressed, unsigned char *hash160);
   std::vector<std::string> GetAddress(int type, bool compressed, unsigned char *h1, unsigned char *h2, unsigned char *h3, unsigned char *h4);
@@ -70,6 +79,7 @@ private:
   uint8_t GetByte(std::string &str,int idx);
 
   Int GetY(Int x, bool isEven);
+  Point ComputePublicKeyAffine(Int *privKey);
   Point GTable[256*32];       // Generator table
 
 };
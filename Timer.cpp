@@ -31,6 +31,8 @@ LARGE_INTEGER Timer::qwTicksPerSec;
 #include <sys/time.h>
 #include <unistd.h>
 #include <string.h>
+#include <pthread.h>
+#include <sched.h>
 time_t Timer::tickStart;
 
 #endif
@@ -164,8 +166,23 @@ int Timer::getCoreNumber() {
   GetSystemInfo(&sysinfo);
   return sysinfo.dwNumberOfProcessors;
 #else
-  // TODO
-  return 1;
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return (n > 0) ? (int)n : 1;
+#endif
+
+}
+
+bool Timer::SetAffinity(int core) {
+
+  // Pin the calling thread to the given logical core (modulo the number of cores)
+  core %= getCoreNumber();
+#ifdef WIN64
+  return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << (core % 64)) != 0;
+#else
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(core % CPU_SETSIZE, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
 #endif
 
 }
@@ -23,9 +23,11 @@
 #include "IntGroup.h"
 #include "Wildcard.h"
 #include "Timer.h"
+#include "Profile.h"
 #include "hash/ripemd160.h"
 #include <string.h>
 #include <math.h>
+#include <signal.h>
 #include <algorithm>
 #ifndef WIN64
 #include <pthread.h>
@@ -33,40 +35,197 @@
 
 using namespace std;
 
-Point Gn[CPU_GRP_SIZE / 2];
+GroupTable groupTable;
+Point *Gn;
 Point _2Gn;
+Point _bGn;
+
+// ----------------------------------------------------------------------------
+
+// Return the number of lanes of the widest hash kernel supported by the CPU and the OS
+int VanitySearch::GetCPUHashLanes() {
+
+#ifdef WIN64
+  int r[4];
+  __cpuid(r, 0);
+  if (r[0] < 7)
+    return 4;
+  __cpuid(r, 1);
+  if ((r[2] & (1 << 27)) == 0) // OSXSAVE
+    return 4;
+  uint64_t xcr0 = _xgetbv(0);
+  __cpuidex(r, 7, 0);
+  if ((xcr0 & 0xE6) == 0xE6 && (r[1] & (1 << 16))) // ZMM state and AVX512F
+    return 16;
+  if ((xcr0 & 0x6) == 0x6 && (r[1] & (1 << 5)))    // YMM state and AVX2
+    return 8;
+  return 4;
+#else
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    return 16;
+  if (__builtin_cpu_supports("avx2"))
+    return 8;
+  return 4;
+#endif
+
+}
+
+// ----------------------------------------------------------------------------
+
+static inline uint64_t getHash160Key(uint8_t *hash160) {
+
+  // First 64 bits of the hash160 (big endian)
+  uint64_t k = 0;
+  for (int i = 0; i < 8; i++)
+    k = (k << 8) | hash160[i];
+  return k;
+
+}
+
+static bool rangeLess(const HRANGE &a, const HRANGE &b) {
+  return a.min < b.min;
+}
+
+// Address type of an encoded address
+static inline int addressType(const string &addr) {
+  switch (addr[0]) {
+  case '1':
+    return P2PKH;
+  case '3':
+    return P2SH;
+  }
+  return BECH32;
+}
+
+// Hash160 of an address type, public key hash (P2PKH) or script hash (P2SH)
+static inline int hashType(int type) {
+  return (type == P2SH) ? P2SH : P2PKH;
+}
+
+// Fixed bits of a Bech32 hash160 interval (prefix bits followed by 0s or 1s)
+static void getBech32Mask(uint8_t *hMin, uint8_t *hMax, BECH32_MASK *m) {
+  uint8_t *mask = (uint8_t *)m->mask;
+  uint8_t *value = (uint8_t *)m->value;
+  for (int i = 0; i < 20; i++) {
+    mask[i] = ~(hMin[i] ^ hMax[i]);
+    value[i] = hMin[i] & mask[i];
+  }
+}
+
+static inline bool bech32Match(uint8_t *hash160, BECH32_MASK &m) {
+  uint32_t *h = (uint32_t *)hash160;
+  return ((h[0] & m.mask[0]) == m.value[0]) && ((h[1] & m.mask[1]) == m.value[1]) &&
+         ((h[2] & m.mask[2]) == m.value[2]) && ((h[3] & m.mask[3]) == m.value[3]) &&
+         ((h[4] & m.mask[4]) == m.value[4]);
+}
+
+// LSD radix sort of keys of nbBit bits, 16 bits digits
+static void radixSort(vector<uint64_t> &keys, int nbBit) {
+
+  vector<uint64_t> tmp(keys.size());
+  vector<size_t> count(65536);
+  for (int shift = 0; shift < nbBit && keys.size() > 0; shift += 16) {
+
+    fill(count.begin(), count.end(), 0);
+    for (size_t i = 0; i < keys.size(); i++)
+      count[(keys[i] >> shift) & 0xFFFF]++;
+    if (count[(keys[0] >> shift) & 0xFFFF] == keys.size())
+      continue; // Same digit everywhere
+
+    size_t pos = 0;
+    for (int d = 0; d < 65536; d++) {
+      size_t c = count[d];
+      count[d] = pos;
+      pos += c;
+    }
+    for (size_t i = 0; i < keys.size(); i++)
+      tmp[count[(keys[i] >> shift) & 0xFFFF]++] = keys[i];
+    keys.swap(tmp);
+
+  }
+
+}
 
 // ----------------------------------------------------------------------------
 
 VanitySearch::VanitySearch(Secp256K1 *secp, vector<std::string> &inputPrefixes,string seed,int searchMode,
-                           bool useGpu, bool stop, string outputFile, bool useSSE, uint32_t maxFound,
-                           uint64_t rekey, bool caseSensitive, Point &startPubKey, bool paranoiacSeed)
+                           bool useGpu, bool stop, string outputFile, bool useSSE, bool useAVX, int cpuGrpSize,
+                           uint32_t maxFound, uint64_t rekey, bool caseSensitive, Point &startPubKey, bool paranoiacSeed,
+                           string indexFile)
   :inputPrefixes(inputPrefixes) {
 
   this->secp = secp;
   this->searchMode = searchMode;
   this->useGpu = useGpu;
   this->stopWhenFound = stop;
+  this->quota = stop ? 1 : 0;
+  this->prefixVersion = 0;
   this->outputFile = outputFile;
+  this->outputFormat = OUTPUT_TEXT;
+  this->outputSync = SYNC_NONE;
   this->useSSE = useSSE;
+  this->cpuGrpSize = cpuGrpSize;
+  this->nbVerifyThread = 0;
+  this->foundQueue = new FoundQueue(FOUND_QUEUE_SIZE);
+  this->cpuLanes = useSSE ? (useAVX ? GetCPUHashLanes() : 4) : 1;
+  this->groupIFMA = NULL;
+  this->gpuPrefixTable = NULL;
+  this->prefixIndex = NULL;
   this->nbGPUThread = 0;
+  this->useScheduler = false;
+  this->nbParked = 0;
   this->maxFound = maxFound;
+  this->gpuBackend = GPU_BACKEND;
   this->rekey = rekey;
-  this->searchType = -1;
+  this->searchTypes = 0;
   this->startPubKey = startPubKey;
   this->hasPattern = false;
+  this->hasDFA = false;
+  this->hasPatternMask = false;
+  this->caseFold = false;
   this->caseSensitive = caseSensitive;
   this->startPubKeySpecified = !startPubKey.isZero();
 
-  lastRekey = 0;
-  prefixes.clear();
+  this->valid = true;
+  this->keepResults = false;
+  this->stopRequest = false;
+  this->interrupted = false;
+  this->nbFoundKey = 0;
+  this->server = NULL;
+  this->listener = NULL;
+  this->netBind = TCP_DEFAULT_BIND;
+  openOutput();
+  this->workers = NULL;
+  this->nbWorker = 0;
+  this->doneCount = 0;
+#ifdef WIN64
+  ghMutex = CreateMutex(NULL, FALSE, NULL);
+  netMutex = CreateMutex(NULL, FALSE, NULL);
+  monitorEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+#else
+  pthread_mutex_init(&ghMutex, NULL);
+  pthread_mutex_init(&netMutex, NULL);
+  pthread_mutex_init(&monitorMutex, NULL);
+  pthread_cond_init(&monitorCond, NULL);
+  monitorSignaled = false;
+#endif
+  this->resumeCount = 0;
+  this->checkpointDelay = 0;
+  memset(stats, 0, sizeof(stats));
+  this->nbHit = 0;
+  this->nbQueued = 0;
+  this->nbVerified = 0;
+  memset(devMetrics, 0, sizeof(devMetrics));
+  memset(verifyTime, 0, sizeof(verifyTime));
 
-  // Create a 65536 items lookup table
-  PREFIX_TABLE_ITEM t;
-  t.found = true;
-  t.items = NULL;
-  for(int i=0;i<65536;i++)
-    prefixes.push_back(t);
+  lastRekey = 0;
+  prefixStart = NULL;
+  memset(prefixBits, 0, sizeof(prefixBits));
+  prefixLeft = new std::atomic<uint32_t>[65536];
+  for (int i = 0; i < 65536; i++)
+    prefixLeft[i] = 0;
+  diffCursor = 0;
 
   // Check is inputPrefixes contains wildcard character
   for (int i = 0; i < (int)inputPrefixes.size() && !hasPattern; i++) {
@@ -74,6 +233,15 @@ VanitySearch::VanitySearch(Secp256K1 *secp, vector<std::string> &inputPrefixes,s
                    (inputPrefixes[i].find('?') != std::string::npos) );
   }
 
+  // Hit count and found bit of each input
+  int nbInput = (int)inputPrefixes.size();
+  inputCount = new std::atomic<uint32_t>[nbInput];
+  foundBits = new std::atomic<uint64_t>[(nbInput + 63) / 64];
+  for (int i = 0; i < nbInput; i++)
+    inputCount[i] = 0;
+  for (int i = 0; i < (nbInput + 63) / 64; i++)
+    foundBits[i] = 0;
+
   if (!hasPattern) {
 
     // No wildcard used, standard search
@@ -82,134 +250,242 @@ VanitySearch::VanitySearch(Secp256K1 *secp, vector<std::string> &inputPrefixes,s
     if (loadingProgress)
       printf("[Building lookup16   0.0%%]\r");
 
-    nbPrefix = 0;
-    onlyFull = true;
-    for (int i = 0; i < (int)inputPrefixes.size(); i++) {
-
-      PREFIX_ITEM it;
-      std::vector<PREFIX_ITEM> itPrefixes;
-
-      if (!caseSensitive) {
-
-        // For caseunsensitive search, loop through all possible combination
-        // and fill up lookup table
-        vector<string> subList;
-        enumCaseUnsentivePrefix(inputPrefixes[i], subList);
-
-        bool *found = new bool;
-        *found = false;
-
-        for (int j = 0; j < (int)subList.size(); j++) {
-          if (initPrefix(subList[j], &it)) {
-            it.found = found;
-            it.prefix = strdup(it.prefix); // We need to allocate here, subList will be destroyed
-            itPrefixes.push_back(it);
-          }
-        }
-
-        if (itPrefixes.size() > 0) {
-
-          // Compute difficulty for case unsensitive search
-          // Not obvious to perform the right calculation here using standard double
-          // Improvement are welcome
-
-          // Get the min difficulty and divide by the number of item having the same difficulty
-          // Should give good result when difficulty is large enough
-          double dMin = itPrefixes[0].difficulty;
-          int nbMin = 1;
-          for (int j = 1; j < (int)itPrefixes.size(); j++) {
-            if (itPrefixes[j].difficulty == dMin) {
-              nbMin++;
-            } else if (itPrefixes[j].difficulty < dMin) {
-              dMin = itPrefixes[j].difficulty;
-              nbMin = 1;
-            }
-          }
-
-          dMin /= (double)nbMin;
-
-          // Updates
-          for (int j = 0; j < (int)itPrefixes.size(); j++)
-            itPrefixes[j].difficulty = dMin;
-
-        }
-
-      } else {
-
-        if (initPrefix(inputPrefixes[i], &it)) {
-          bool *found = new bool;
-          *found = false;
-          it.found = found;
-          itPrefixes.push_back(it);
-        }
-
+    // Decode all inputs (Base58/Bech32, case combinations, difficulty), items of
+    // input i are decoded[itemStart[i]..itemStart[i+1]). Large lists are decoded
+    // in parallel or loaded from the binary index.
+    vector<PREFIX_ITEM> decoded;
+    vector<uint32_t> itemStart;
+    // Case unsensitive prefixes: only the first CASE_FOLD_LETTERS letters are
+    // expanded in case combinations, the remaining characters are compared case
+    // folded by the CPU and by the GPU (automaton of all the prefixes)
+    if (!caseSensitive) {
+      caseFold = true;
+      if (useGpu) {
+        vector<string> folded(inputPrefixes.begin(), inputPrefixes.end());
+        for (int i = 0; i < nbInput; i++)
+          folded[i].push_back('*');
+        caseFold = hasDFA = patternDFA.Compile(folded, false);
+        if (hasDFA)
+          patternDFA.GetTable(patternTable);
+        else
+          printf("Warning, too many case unsensitive prefixes, all case combinations are searched\n");
       }
+    }
 
-      if (itPrefixes.size() > 0) {
+    uint64_t inputHash = getPrefixHash();
+    if (!loadPrefixIndex(indexFile, inputHash, decoded, itemStart)) {
+      decodePrefixes(decoded, itemStart);
+      if (indexFile.length() > 0)
+        savePrefixIndex(indexFile, inputHash, decoded, itemStart);
+    }
+    for (size_t k = 0; k < decoded.size(); k++)
+      searchTypes |= TYPE_MASK(decoded[k].type);
 
-        // Add the item to all correspoding prefixes in the lookup table
-        for (int j = 0; j < (int)itPrefixes.size(); j++) {
+    // Flat lookup table, the items of the 16 bits prefix p are
+    // prefixEntry[prefixStart[p]..prefixStart[p+1]) in input order
+    nbPrefix = 0;
+    onlyFull = true;
+    size_t arenaSize = 0;
+    prefixStart = new uint32_t[65537];
+    memset(prefixStart, 0, 65537 * sizeof(uint32_t));
+    for (int i = 0; i < nbInput; i++) {
+      if (itemStart[i + 1] > itemStart[i]) {
+        onlyFull &= decoded[itemStart[i + 1] - 1].isFull;
+        nbPrefix++;
+      }
+    }
+    for (size_t k = 0; k < decoded.size(); k++) {
+      prefixStart[decoded[k].sPrefix + 1]++;
+      arenaSize += decoded[k].prefixLength + 1;
+    }
+    for (int p = 0; p < 65536; p++) {
+      if (prefixStart[p + 1] > 0) {
+        usedPrefix.push_back((prefix_t)p);
+        prefixBits[p >> 6] |= 1ULL << (p & 63);
+        prefixLeft[p] = prefixStart[p + 1];
+      }
+      prefixStart[p + 1] += prefixStart[p];
+    }
 
-          prefix_t p = itPrefixes[j].sPrefix;
+    // Hash set of all addresses (duplicates share the same found bit),
+    // 64 bit keys for the GPU Bloom filter and (16 bits prefix, 32 bits prefix) keys
+    vector<uint64_t> lKeys;
+    if (onlyFull) {
+      fullTable.Init(nbPrefix);
+      lKeys.reserve(decoded.size());
+    }
 
-          if (prefixes[p].items == NULL) {
-            prefixes[p].items = new vector<PREFIX_ITEM>();
-            prefixes[p].found = false;
-            usedPrefix.push_back(p);
+    vector<uint32_t> pos(prefixStart, prefixStart + 65536);
+    prefixEntry.resize(decoded.size());
+    prefixDifficulty.resize(decoded.size());
+    prefixArena.reserve(arenaSize);
+    for (int i = 0; i < nbInput; i++) {
+
+      for (uint32_t k = itemStart[i]; k < itemStart[i + 1]; k++) {
+
+        PREFIX_ITEM &it = decoded[k];
+        uint32_t idx = pos[it.sPrefix]++;
+        PREFIX_ENTRY &e = prefixEntry[idx];
+        e.min = getHash160Key(it.hash160Min);
+        e.max = getHash160Key(it.hash160Max);
+        e.found = (uint32_t)i;
+        e.prefix = (uint32_t)prefixArena.size();
+        e.prefixLength = (uint16_t)it.prefixLength;
+        e.type = (uint8_t)it.type;
+        e.mask = 0;
+        if (it.type == BECH32) {
+          BECH32_MASK m;
+          getBech32Mask(it.hash160Min, it.hash160Max, &m);
+          e.mask = (uint32_t)bech32Mask.size();
+          bech32Mask.push_back(m);
+        }
+        prefixArena.insert(prefixArena.end(), it.prefix, it.prefix + it.prefixLength + 1);
+        prefixDifficulty[idx] = it.difficulty;
+
+        if (onlyFull) {
+          uint32_t id = fullTable.Add(it.hash160, (uint32_t)fullFound.size());
+          if (id == (uint32_t)fullFound.size()) {
+            fullFound.push_back(e.found);
+            fullType.push_back((uint8_t)it.type);
+            uint64_t bKey;
+            memcpy(&bKey, it.hash160 + 4, 8);
+            usedBloomKey.push_back(bKey);
+          } else {
+            e.found = fullFound[id];
           }
-          (*prefixes[p].items).push_back(itPrefixes[j]);
-
+          lKeys.push_back(((uint64_t)it.sPrefix << 32) | it.lPrefix);
         }
 
-        onlyFull &= it.isFull;
-        nbPrefix++;
-
       }
 
       if (loadingProgress && i % 1000 == 0)
         printf("[Building lookup16 %5.1f%%]\r", (((double)i) / (double)(inputPrefixes.size() - 1)) * 100.0);
     }
 
+    // Case combinations are allocated by decodePrefix()
+    if (!caseSensitive && prefixIndex == NULL) {
+      for (size_t k = 0; k < decoded.size(); k++)
+        free(decoded[k].prefix);
+    }
+    vector<PREFIX_ITEM>().swap(decoded);
+    if (prefixIndex) {
+      delete prefixIndex;
+      prefixIndex = NULL;
+    }
+
     if (loadingProgress)
       printf("\n");
 
     //dumpPrefixes();
 
-    if (!caseSensitive && searchType == BECH32) {
+    if (!caseSensitive && (searchTypes & TYPE_MASK(BECH32))) {
       printf("Error, case unsensitive search with BECH32 not allowed.\n");
-      exit(1);
+      valid = false;
+      return;
     }
 
+    if (searchMode == SEARCH_UNCOMPRESSED && searchTypes == TYPE_MASK(BECH32))
+      printf("Warning, BECH32 addresses use compressed keys, nothing can be found with -u\n");
+
     if (nbPrefix == 0) {
       printf("VanitySearch: nothing to search !\n");
-      exit(1);
+      valid = false;
+      return;
     }
 
-    // Second level lookup
-    uint32_t unique_sPrefix = 0;
+    // Second level lookup, keys sorted with a radix sort
+    uint32_t unique_sPrefix = (uint32_t)usedPrefix.size();
     uint32_t minI = 0xFFFFFFFF;
     uint32_t maxI = 0;
-    for (int i = 0; i < (int)prefixes.size(); i++) {
-      if (prefixes[i].items) {
-        LPREFIX lit;
-        lit.sPrefix = i;
-        if (prefixes[i].items) {
-          for (int j = 0; j < (int)prefixes[i].items->size(); j++) {
-            lit.lPrefixes.push_back((*prefixes[i].items)[j].lPrefix);
+    for (int i = 0; i < (int)usedPrefix.size(); i++) {
+      uint32_t n = prefixStart[usedPrefix[i] + 1] - prefixStart[usedPrefix[i]];
+      if (n > maxI) maxI = n;
+      if (n < minI) minI = n;
+    }
+    radixSort(lKeys, 48);
+
+    for (size_t i = 0; i < lKeys.size();) {
+      LPREFIX lit;
+      lit.sPrefix = (prefix_t)(lKeys[i] >> 32);
+      while (i < lKeys.size() && (prefix_t)(lKeys[i] >> 32) == lit.sPrefix)
+        lit.lPrefixes.push_back((prefixl_t)lKeys[i++]);
+      usedPrefixL.push_back(lit);
+    }
+    vector<uint64_t>().swap(lKeys);
+
+    if (!onlyFull) {
+
+      // Hash160 intervals of each 16 bits prefix for the GPU filter,
+      // clipped to the 16 bits prefix and merged when they overlap
+      nbPrefixRange = 0;
+      bool rangeOverflow = false;
+      for (int i = 0; i < (int)usedPrefix.size(); i++) {
+        prefix_t p = usedPrefix[i];
+        uint64_t bMin = ((uint64_t)(p & 0xFF) << 56) | ((uint64_t)(p >> 8) << 48);
+        uint64_t bMax = bMin | 0xFFFFFFFFFFFFULL;
+        vector<HRANGE> r;
+        for (uint32_t j = prefixStart[p]; j < prefixStart[p + 1]; j++) {
+          HRANGE hr;
+          hr.min = prefixEntry[j].min;
+          hr.max = prefixEntry[j].max;
+          if (hr.min < bMin) hr.min = bMin;
+          if (hr.max > bMax) hr.max = bMax;
+          if (hr.min > hr.max) {
+            hr.min = bMin;
+            hr.max = bMax;
+          }
+          r.push_back(hr);
+        }
+        sort(r.begin(), r.end(), rangeLess);
+        RPREFIX rit;
+        rit.sPrefix = p;
+        for (int j = 0; j < (int)r.size(); j++) {
+          if (rit.ranges.size() > 0 &&
+              (rit.ranges.back().max == UINT64_MAX || r[j].min <= rit.ranges.back().max + 1)) {
+            if (r[j].max > rit.ranges.back().max) rit.ranges.back().max = r[j].max;
+          } else {
+            rit.ranges.push_back(r[j]);
           }
         }
-        sort(lit.lPrefixes.begin(), lit.lPrefixes.end());
-        usedPrefixL.push_back(lit);
-        if ((uint32_t)lit.lPrefixes.size() > maxI) maxI = (uint32_t)lit.lPrefixes.size();
-        if ((uint32_t)lit.lPrefixes.size() < minI) minI = (uint32_t)lit.lPrefixes.size();
-        unique_sPrefix++;
+        nbPrefixRange += (uint32_t)rit.ranges.size();
+        if (rit.ranges.size() > 0xFFFF)
+          rangeOverflow = true;
+        usedPrefixR.push_back(rit);
+      }
+
+      // The range count of a 16 bits prefix is 16 bits wide on the device
+      if (rangeOverflow) {
+        printf("Warning, more than 65535 hash160 ranges for a 16 bits prefix, GPU uses the 16 bits lookup only\n");
+        vector<RPREFIX>().swap(usedPrefixR);
+        nbPrefixRange = 0;
       }
-      if (loadingProgress)
-        printf("[Building lookup32 %.1f%%]\r", ((double)i*100.0) / (double)prefixes.size());
+
     }
 
-    if (loadingProgress)
-      printf("\n");
+    // Entries of each input id (updated when the input is found) and
+    // entries sorted by difficulty for the next most probable item
+    nbLeft = (uint32_t)usedPrefix.size();
+    inputEntryStart.assign(nbInput + 1, 0);
+    inputEntryPrefix.resize(prefixEntry.size());
+    for (size_t j = 0; j < prefixEntry.size(); j++)
+      inputEntryStart[prefixEntry[j].found + 1]++;
+    for (int i = 0; i < nbInput; i++)
+      inputEntryStart[i + 1] += inputEntryStart[i];
+    vector<uint32_t> ePos(inputEntryStart.begin(), inputEntryStart.end() - 1);
+    for (int i = 0; i < (int)usedPrefix.size(); i++) {
+      prefix_t p = usedPrefix[i];
+      for (uint32_t j = prefixStart[p]; j < prefixStart[p + 1]; j++)
+        inputEntryPrefix[ePos[prefixEntry[j].found]++] = p;
+    }
+
+    if (!onlyFull) {
+      diffOrder.resize(prefixEntry.size());
+      for (uint32_t j = 0; j < (uint32_t)prefixEntry.size(); j++)
+        diffOrder[j] = j;
+      std::sort(diffOrder.begin(), diffOrder.end(), [this](uint32_t a, uint32_t b) {
+        return prefixDifficulty[a] < prefixDifficulty[b];
+      });
+    }
 
     _difficulty = getDiffuclty();
     string seachInfo = string(searchModes[searchMode]) + (startPubKeySpecified ? ", with public key" : "");
@@ -232,50 +508,97 @@ VanitySearch::VanitySearch(Secp256K1 *secp, vector<std::string> &inputPrefixes,s
 
   } else {
 
-    // Wild card search
-    switch (inputPrefixes[0].data()[0]) {
+    // Wild card search, each pattern gives its address type
+    for (int i = 0; i < nbInput; i++) {
+      switch (inputPrefixes[i].data()[0]) {
+
+      case '1':
+        searchTypes |= TYPE_MASK(P2PKH);
+        break;
+      case '3':
+        searchTypes |= TYPE_MASK(P2SH);
+        break;
+      case 'b':
+      case 'B':
+        searchTypes |= TYPE_MASK(BECH32);
+        break;
+
+      default:
+        printf("Invalid start character 1,3 or b, expected (%s)\n", inputPrefixes[i].c_str());
+        valid = false;
+        return;
 
-    case '1':
-      searchType = P2PKH;
-      break;
-    case '3':
-      searchType = P2SH;
-      break;
-    case 'b':
-    case 'B':
-      searchType = BECH32;
-      break;
+      }
+    }
+
+    if (searchMode == SEARCH_UNCOMPRESSED && searchTypes == TYPE_MASK(BECH32))
+      printf("Warning, BECH32 addresses use compressed keys, nothing can be found with -u\n");
+
+    // The GPU pattern kernels search a single address type
+    if (useGpu && (searchTypes & (searchTypes - 1)) != 0) {
+      printf("Error, patterns of different address types (1, 3, bc1) cannot be searched on GPU\n");
+      valid = false;
+      return;
+    }
+
+    nbLeft = (uint32_t)inputPrefixes.size();
+
+    // Bech32 patterns with fixed character positions are checked on the
+    // hash160 bits, the address is encoded only for matching hash160
+    if (searchTypes == TYPE_MASK(BECH32)) {
+      patternMask.resize(nbInput);
+      hasPatternMask = true;
+      for (int i = 0; i < nbInput && hasPatternMask; i++)
+        hasPatternMask = initPatternMask(inputPrefixes[i], &patternMask[i]);
+      if (!hasPatternMask)
+        patternMask.clear();
+    }
 
-    default:
-      printf("Invalid start character 1,3 or b, expected");
-      exit(1);
+    // The GPU searches Bech32 patterns with masks only (no Bech32 encoding on the device)
+    if (useGpu && searchTypes == TYPE_MASK(BECH32) && !hasPatternMask) {
+      printf("Error, Bech32 patterns must be bc1q followed by characters or '?' and end with '*' on GPU\n");
+      valid = false;
+      return;
+    }
 
+    // Merge all patterns in a single automaton
+    hasDFA = patternDFA.Compile(inputPrefixes, caseSensitive);
+    if (hasDFA) {
+      patternDFA.GetTable(patternTable);
+    } else {
+      printf("Warning, too many pattern combinations, patterns will be checked one by one\n");
+      if (!hasPatternMask)
+        printf("Warning, GPU will search only for %s\n", inputPrefixes[0].c_str());
+      WildcardDFA firstDFA;
+      vector<string> firstPattern(1, inputPrefixes[0]);
+      firstDFA.Compile(firstPattern, caseSensitive);
+      firstDFA.GetTable(patternTable);
     }
 
     string searchInfo = string(searchModes[searchMode]) + (startPubKeySpecified ? ", with public key" : "");
     if (inputPrefixes.size() == 1) {
       printf("Search: %s [%s]\n", inputPrefixes[0].c_str(), searchInfo.c_str());
+    } else if (hasDFA) {
+      printf("Search: %d patterns (%d states) [%s]\n", (int)inputPrefixes.size(), patternDFA.GetNbState(), searchInfo.c_str());
     } else {
       printf("Search: %d patterns [%s]\n", (int)inputPrefixes.size(), searchInfo.c_str());
     }
 
-    patternFound = (bool *)malloc(inputPrefixes.size()*sizeof(bool));
-    memset(patternFound,0, inputPrefixes.size() * sizeof(bool));
-
   }
 
-  // Compute Generator table G[n] = (n+1)*G
+  // Generator table G[n] = (n+1)*G, _2Gn = cpuGrpSize*G, _bGn = CPU_GRP_BATCH*cpuGrpSize*G.
+  // groupTable is built once for a group size, the daemon jobs share it.
+  if (groupTable.GetSize() != cpuGrpSize)
+    groupTable.Init(secp, cpuGrpSize);
+  Gn = groupTable.Gn;
+  _2Gn = groupTable._2Gn;
+  _bGn = _2Gn;
+  for (int b = 1; b < CPU_GRP_BATCH; b++)
+    _bGn = (b == 1) ? secp->DoubleDirect(_2Gn) : secp->AddDirect(_bGn, _2Gn);
 
-  Point g = secp->G;
-  Gn[0] = g;
-  g = secp->DoubleDirect(g);
-  Gn[1] = g;
-  for (int i = 2; i < CPU_GRP_SIZE/2; i++) {
-    g = secp->AddDirect(g,secp->G);
-    Gn[i] = g;
-  }
-  // _2Gn = CPU_GRP_SIZE*G
-  _2Gn = secp->DoubleDirect(Gn[CPU_GRP_SIZE/2-1]);
+  // AVX-512 IFMA group point additions
+  if (useSSE && useAVX && GroupIFMA::IsSupported())
+    groupIFMA = new GroupIFMA(Gn, cpuGrpSize / 2);
 
   // Constant for endomorphism
   // if a is a nth primitive root of unity, a^-1 is also a nth primitive root.
@@ -319,6 +642,31 @@ VanitySearch::VanitySearch(Secp256K1 *secp, vector<std::string> &inputPrefixes,s
 
 }
 
+VanitySearch::~VanitySearch() {
+
+  delete resultWriter;
+  delete foundQueue;
+  delete[] prefixLeft;
+  delete[] inputCount;
+  delete[] foundBits;
+  delete[] prefixStart;
+  if (groupIFMA) delete groupIFMA;
+#ifdef WITHGPU
+  if (gpuPrefixTable) delete gpuPrefixTable;
+#endif
+#ifdef WIN64
+  CloseHandle(ghMutex);
+  CloseHandle(netMutex);
+  CloseHandle(monitorEvent);
+#else
+  pthread_mutex_destroy(&ghMutex);
+  pthread_mutex_destroy(&netMutex);
+  pthread_mutex_destroy(&monitorMutex);
+  pthread_cond_destroy(&monitorCond);
+#endif
+
+}
+
 // ----------------------------------------------------------------------------
 
 bool VanitySearch::isSingularPrefix(std::string pref) {
@@ -334,6 +682,75 @@ bool VanitySearch::isSingularPrefix(std::string pref) {
 
 }
 
+// ----------------------------------------------------------------------------
+
+int VanitySearch::getAddressType(std::string &prefix) {
+
+  // Bech32 prefixes are converted to lower case
+  switch (prefix.data()[0]) {
+  case '1':
+    return P2PKH;
+  case '3':
+    return P2SH;
+  case 'b':
+  case 'B':
+    std::transform(prefix.begin(), prefix.end(), prefix.begin(), ::tolower);
+    if(strncmp(prefix.c_str(), "bc1q", 4) == 0)
+      return BECH32;
+    break;
+  }
+  return -1;
+
+}
+
+// Address types of a hash160 for a wildcard search, type is the hash160 type
+// (P2PKH for a public key hash, BECH32 when returned by a Bech32 pattern kernel)
+int VanitySearch::getPatternTypes(int type, bool mode, int *types) {
+
+  int n = 0;
+  if (type == P2SH) {
+    types[n++] = P2SH;
+    return n;
+  }
+  if (type != BECH32 && (searchTypes & TYPE_MASK(P2PKH)))
+    types[n++] = P2PKH;
+  // BECH32 addresses use compressed keys only
+  if (mode && (searchTypes & TYPE_MASK(BECH32)))
+    types[n++] = BECH32;
+  return n;
+
+}
+
+// Kernel type: public key hash160 (P2PKH, BECH32), script hash160 (P2SH) or both
+int VanitySearch::getGPUSearchType() {
+
+  // Patterns of a single address type
+  if (hasPattern) {
+    if (searchTypes & TYPE_MASK(P2SH))
+      return P2SH;
+    return (searchTypes & TYPE_MASK(BECH32)) ? BECH32 : P2PKH;
+  }
+  if ((searchTypes & KEY_HASH_TYPES) && (searchTypes & TYPE_MASK(P2SH)))
+    return P2PKH_P2SH;
+  return (searchTypes & TYPE_MASK(P2SH)) ? P2SH : P2PKH;
+
+}
+
+// "bc1q" followed by characters or '?' and ending with '*'
+bool VanitySearch::initPatternMask(std::string &pattern, BECH32_MASK *m) {
+
+  size_t length = pattern.length();
+  if (length < 5 || strncmp(pattern.c_str(), "bc1q", 4) != 0 || pattern[length - 1] != '*')
+    return false;
+
+  string data = pattern.substr(4, length - 5);
+  if (data.find('*') != string::npos)
+    return false;
+
+  return bech32_mask_nocheck((uint8_t *)m->mask, (uint8_t *)m->value, data.c_str()) != 0;
+
+}
+
 // ----------------------------------------------------------------------------
 bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
 
@@ -347,34 +764,14 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
     return false;
   }
 
-  int aType = -1;
-
-
-  switch (prefix.data()[0]) {
-  case '1':
-    aType = P2PKH;
-    break;
-  case '3':
-    aType = P2SH;
-    break;
-  case 'b':
-  case 'B':
-    std::transform(prefix.begin(), prefix.end(), prefix.begin(), ::tolower);
-    if(strncmp(prefix.c_str(), "bc1q", 4) == 0)
-      aType = BECH32;
-    break;
-  }
+  int aType = getAddressType(prefix);
 
   if (aType==-1) {
     printf("Ignoring prefix \"%s\" (must start with 1 or 3 or bc1q)\n", prefix.c_str());
     return false;
   }
 
-  if (searchType == -1) searchType = aType;
-  if (aType != searchType) {
-    printf("Ignoring prefix \"%s\" (P2PKH, P2SH or BECH32 allowed at once)\n", prefix.c_str());
-    return false;
-  }
+  it->type = aType;
 
   if (aType == BECH32) {
 
@@ -393,6 +790,8 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
       it->difficulty = pow(2, 160);
       it->isFull = true;
       memcpy(it->hash160, witprog, 20);
+      memcpy(it->hash160Min, witprog, 20);
+      memcpy(it->hash160Max, witprog, 20);
       it->sPrefix = *(prefix_t *)(it->hash160);
       it->lPrefix = *(prefixl_t *)(it->hash160);
       it->prefix = (char *)prefix.c_str();
@@ -419,6 +818,13 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
       return false;
     }
 
+    // Hash160 interval, prefix bits followed by 0s or 1s
+    int nbBit = 5 * ((int)prefix.length() - 4);
+    memcpy(it->hash160Min, data, 20);
+    memcpy(it->hash160Max, data, 20);
+    for (int b = nbBit; b < 160; b++)
+      it->hash160Max[b >> 3] |= 0x80 >> (b & 7);
+
     // Difficulty
     it->sPrefix = *(prefix_t *)data;
     it->difficulty = pow(2, 5*(prefix.length()-4));
@@ -451,6 +857,8 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
       it->difficulty = pow(2, 160);
       it->isFull = true;
       memcpy(it->hash160, result.data() + 1, 20);
+      memcpy(it->hash160Min, result.data() + 1, 20);
+      memcpy(it->hash160Max, result.data() + 1, 20);
       it->sPrefix = *(prefix_t *)(it->hash160);
       it->lPrefix = *(prefixl_t *)(it->hash160);
       it->prefix = (char *)prefix.c_str();
@@ -467,6 +875,11 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
         return false;
       }
 
+      // Hash160 starting with length-1 zero bytes
+      memset(it->hash160Min, 0, 20);
+      memset(it->hash160Max, 0xFF, 20);
+      memset(it->hash160Max, 0, prefix.length() - 1);
+
       // Difficulty
       it->difficulty = pow(256, prefix.length() - 1);
       it->isFull = false;
@@ -488,7 +901,7 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
       }
     }
 
-    if (searchType == P2SH) {
+    if (aType == P2SH) {
       if (result.data()[0] != 5) {
         if(caseSensitive)
           printf("Ignoring prefix \"%s\" (Unreachable, 31h1 to 3R2c only)\n", prefix.c_str());
@@ -513,6 +926,22 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
       nbDigit++;
     }
 
+    // Hash160 interval of the addresses of this length, given by prefix+"11..1"
+    // and prefix+"zz..z" (the checksum only matters at the bounds)
+    uint8_t version = (aType == P2SH) ? 5 : 0;
+    std::vector<unsigned char> rMin;
+    std::vector<unsigned char> rMax;
+    DecodeBase58(prefix + string(nbDigit, '1'), rMin);
+    DecodeBase58(prefix + string(nbDigit, 'z'), rMax);
+    if (rMin.size() == 25 && rMin[0] == version)
+      memcpy(it->hash160Min, rMin.data() + 1, 20);
+    else
+      memset(it->hash160Min, 0, 20);
+    if (rMax.size() == 25 && rMax[0] == version)
+      memcpy(it->hash160Max, rMax.data() + 1, 20);
+    else
+      memset(it->hash160Max, 0xFF, 20);
+
     // Difficulty
     it->difficulty = pow(2, 192) / pow(58, nbDigit);
     it->isFull = false;
@@ -527,90 +956,490 @@ bool VanitySearch::initPrefix(std::string &prefix,PREFIX_ITEM *it) {
 
 // ----------------------------------------------------------------------------
 
-void VanitySearch::dumpPrefixes() {
+int VanitySearch::decodePrefix(std::string &prefix, std::vector<PREFIX_ITEM> &items) {
+
+  PREFIX_ITEM it;
+  size_t first = items.size();
 
-  for (int i = 0; i < 0xFFFF; i++) {
-    if (prefixes[i].items) {
-      printf("%04X\n", i);
-      for (int j = 0; j < (int)prefixes[i].items->size(); j++) {
-        printf("  %d\n", (*prefixes[i].items)[j].sPrefix);
-        printf("  %g\n", (*prefixes[i].items)[j].difficulty);
-        printf("  %s\n", (*prefixes[i].items)[j].prefix);
+  if (!caseSensitive) {
+
+    // For caseunsensitive search, loop through all possible combination
+    // of the first letters, the whole prefix is then compared case folded
+    string head = prefix.substr(0, getCaseFoldLength(prefix));
+    double dFold = 1.0;
+    for (size_t j = head.length(); j < prefix.length(); j++) {
+      int nbCase = getCaseCount(prefix.data()[j]);
+      if (nbCase == 0) {
+        printf("Ignoring prefix \"%s\" (0 not allowed)\n", prefix.c_str());
+        return 0;
       }
+      dFold *= 58.0 / (double)nbCase;
     }
-  }
 
-}
-// ----------------------------------------------------------------------------
+    vector<string> subList;
+    enumCaseUnsentivePrefix(head, subList);
+
+    for (int j = 0; j < (int)subList.size(); j++) {
+      if (initPrefix(subList[j], &it)) {
+        if (it.isFull || head.length() == prefix.length()) {
+          it.prefix = strdup(it.prefix); // We need to allocate here, subList will be destroyed
+        } else {
+          it.prefix = strdup(prefix.c_str());
+          it.prefixLength = (int)prefix.length();
+          it.difficulty *= dFold;
+        }
+        items.push_back(it);
+      }
+    }
 
-void VanitySearch::enumCaseUnsentivePrefix(std::string s, std::vector<std::string> &list) {
+    if (items.size() > first) {
+
+      // Compute difficulty for case unsensitive search
+      // Not obvious to perform the right calculation here using standard double
+      // Improvement are welcome
+
+      // Get the min difficulty and divide by the number of item having the same difficulty
+      // Should give good result when difficulty is large enough
+      double dMin = items[first].difficulty;
+      int nbMin = 1;
+      for (size_t j = first + 1; j < items.size(); j++) {
+        if (items[j].difficulty == dMin) {
+          nbMin++;
+        } else if (items[j].difficulty < dMin) {
+          dMin = items[j].difficulty;
+          nbMin = 1;
+        }
+      }
 
-  char letter[64];
-  int letterpos[64];
-  int nbLetter = 0;
-  int length = (int)s.length();
+      dMin /= (double)nbMin;
+
+      // Updates
+      for (size_t j = first; j < items.size(); j++)
+        items[j].difficulty = dMin;
+
+      // Intervals of the first letters may span a few 16 bits prefixes
+      size_t last = items.size();
+      for (size_t j = first; j < last && head.length() < prefix.length(); j++) {
+        int pMin = (items[j].hash160Min[0] << 8) | items[j].hash160Min[1];
+        int pMax = (items[j].hash160Max[0] << 8) | items[j].hash160Max[1];
+        for (int p = pMin; p <= pMax && pMax - pMin < 16; p++) {
+          prefix_t sPrefix = (prefix_t)((p >> 8) | ((p & 0xFF) << 8));
+          if (sPrefix != items[j].sPrefix) {
+            it = items[j];
+            it.sPrefix = sPrefix;
+            it.prefix = strdup(prefix.c_str());
+            items.push_back(it);
+          }
+        }
+      }
 
-  for (int i = 1; i < length; i++) {
-    char c = s.data()[i];
-    if( (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ) {
-      letter[nbLetter] = tolower(c);
-      letterpos[nbLetter] = i;
-      nbLetter++;
     }
+
+  } else {
+
+    if (initPrefix(prefix, &it)) {
+      items.push_back(it);
+    }
+
   }
 
-  int total = 1 << nbLetter;
+  return (int)(items.size() - first);
 
-  for (int i = 0; i < total; i++) {
+}
 
-    char tmp[64];
-    strcpy(tmp, s.c_str());
+// ----------------------------------------------------------------------------
 
-    for (int j = 0; j < nbLetter; j++) {
-      int mask = 1 << j;
-      if (mask&i) tmp[letterpos[j]] = toupper(letter[j]);
-      else         tmp[letterpos[j]] = letter[j];
-    }
+#ifdef WIN64
+DWORD WINAPI _DecodePrefixes(LPVOID lpParam) {
+#else
+void *_DecodePrefixes(void *lpParam) {
+#endif
+  DECODE_PARAM *p = (DECODE_PARAM *)lpParam;
+  p->obj->DecodePrefixes(p);
+  return 0;
+}
 
-    list.push_back(string(tmp));
+void VanitySearch::DecodePrefixes(DECODE_PARAM *p) {
 
+  for (int i = p->start; i < p->end; i++) {
+    p->nbItem.push_back(decodePrefix(inputPrefixes[i], p->items));
+    p->nbDone++;
   }
+  p->isRunning = false;
 
 }
 
-// ----------------------------------------------------------------------------
+void VanitySearch::decodePrefixes(std::vector<PREFIX_ITEM> &items, std::vector<uint32_t> &itemStart) {
 
-double VanitySearch::getDiffuclty() {
+  int nbInput = (int)inputPrefixes.size();
 
-  double min = pow(2,160);
+  int nbThread = 1;
+  if (nbInput >= DECODE_MIN_INPUT) {
+    nbThread = Timer::getCoreNumber();
+    if (nbThread > MAX_DECODE_THREAD) nbThread = MAX_DECODE_THREAD;
+  }
 
-  if (onlyFull)
-    return min;
+  DECODE_PARAM *params = new DECODE_PARAM[nbThread];
+  for (int t = 0; t < nbThread; t++) {
+    params[t].obj = this;
+    params[t].start = (int)(((uint64_t)nbInput * t) / nbThread);
+    params[t].end = (int)(((uint64_t)nbInput * (t + 1)) / nbThread);
+    params[t].nbItem.reserve(params[t].end - params[t].start);
+    params[t].nbDone = 0;
+    params[t].isRunning = true;
+  }
 
-  for (int i = 0; i < (int)usedPrefix.size(); i++) {
-    int p = usedPrefix[i];
-    if (prefixes[p].items) {
-      for (int j = 0; j < (int)prefixes[p].items->size(); j++) {
-        if (!*((*prefixes[p].items)[j].found)) {
-          if ((*prefixes[p].items)[j].difficulty < min)
-            min = (*prefixes[p].items)[j].difficulty;
-        }
+  if (nbThread == 1) {
+
+    DecodePrefixes(params);
+
+  } else {
+
+    for (int t = 0; t < nbThread; t++) {
+#ifdef WIN64
+      DWORD thread_id;
+      CreateThread(NULL, 0, _DecodePrefixes, (void*)(params + t), 0, &thread_id);
+#else
+      pthread_t thread_id;
+      pthread_create(&thread_id, NULL, &_DecodePrefixes, (void*)(params + t));
+      pthread_detach(thread_id);
+#endif
+    }
+
+    bool running = true;
+    while (running) {
+      Timer::SleepMillis(50);
+      running = false;
+      uint64_t nbDone = 0;
+      for (int t = 0; t < nbThread; t++) {
+        running |= params[t].isRunning;
+        nbDone += params[t].nbDone;
       }
+      printf("[Decoding prefixes %5.1f%%]\r", ((double)nbDone * 100.0) / (double)nbInput);
     }
+    printf("\n");
+
   }
 
-  return min;
+  // Concatenate the items in input order
+  size_t total = 0;
+  for (int t = 0; t < nbThread; t++)
+    total += params[t].items.size();
+  items.clear();
+  items.reserve(total);
+  itemStart.clear();
+  itemStart.reserve(nbInput + 1);
+  for (int t = 0; t < nbThread; t++) {
+    uint32_t pos = (uint32_t)items.size();
+    for (int i = 0; i < (int)params[t].nbItem.size(); i++) {
+      itemStart.push_back(pos);
+      pos += params[t].nbItem[i];
+    }
+    items.insert(items.end(), params[t].items.begin(), params[t].items.end());
+    vector<PREFIX_ITEM>().swap(params[t].items);
+  }
+  itemStart.push_back((uint32_t)items.size());
+  delete[] params;
 
 }
 
-double log1(double x) {
-  // Use taylor series to approximate log(1-x)
-  return -x - (x*x)/2.0 - (x*x*x)/3.0 - (x*x*x*x)/4.0;
+// ----------------------------------------------------------------------------
+
+static inline size_t getIndexItemOffset(uint32_t nbInput) {
+  // Header, (nbInput+1) item starts, 8 bytes aligned
+  return (sizeof(PREFIX_INDEX_HEADER) + (nbInput + 1) * 4 + 7) & ~(size_t)7;
 }
 
-string VanitySearch::GetExpectedTime(double keyRate,double keyCount) {
+static int32_t getItemTypes(std::vector<PREFIX_ITEM> &items) {
+  // Address types of the decoded items (searchTypes bit mask)
+  int32_t types = 0;
+  for (size_t i = 0; i < items.size(); i++)
+    types |= TYPE_MASK(items[i].type);
+  return types;
+}
 
-  char tmp[128];
+bool VanitySearch::loadPrefixIndex(std::string fileName, uint64_t hash, std::vector<PREFIX_ITEM> &items, std::vector<uint32_t> &itemStart) {
+
+  if (fileName.length() == 0)
+    return false;
+
+  MappedFile *f = new MappedFile();
+  if (!f->Open(fileName)) {
+    // Not created yet
+    delete f;
+    return false;
+  }
+
+  PREFIX_INDEX_HEADER *h = (PREFIX_INDEX_HEADER *)f->data;
+  if (f->size < sizeof(PREFIX_INDEX_HEADER) || h->magic != PREFIX_INDEX_MAGIC || h->version != PREFIX_INDEX_VERSION) {
+    printf("Prefix index %s: invalid file, rebuilding it\n", fileName.c_str());
+    delete f;
+    return false;
+  }
+
+  if (h->nbInput != (uint32_t)inputPrefixes.size() || h->prefixHash != hash || h->caseSensitive != getIndexCaseMode()) {
+    printf("Prefix index %s does not match the input prefixes, rebuilding it\n", fileName.c_str());
+    delete f;
+    return false;
+  }
+
+  size_t itemOffset = getIndexItemOffset(h->nbInput);
+  size_t arenaOffset = itemOffset + (size_t)h->nbItem * sizeof(PREFIX_INDEX_ITEM);
+  if (f->size != arenaOffset + h->arenaSize) {
+    printf("Prefix index %s: invalid size, rebuilding it\n", fileName.c_str());
+    delete f;
+    return false;
+  }
+
+  const uint32_t *start = (const uint32_t *)(f->data + sizeof(PREFIX_INDEX_HEADER));
+  const PREFIX_INDEX_ITEM *r = (const PREFIX_INDEX_ITEM *)(f->data + itemOffset);
+  const char *arena = f->data + arenaOffset;
+
+  for (uint32_t i = 0; i < h->nbInput; i++) {
+    if (start[i] > start[i + 1] || start[h->nbInput] != h->nbItem) {
+      printf("Prefix index %s: invalid item table, rebuilding it\n", fileName.c_str());
+      delete f;
+      return false;
+    }
+  }
+
+  itemStart.assign(start, start + h->nbInput + 1);
+  items.resize(h->nbItem);
+  for (uint32_t i = 0; i < h->nbItem; i++) {
+    PREFIX_ITEM &it = items[i];
+    if (r[i].prefixOffset + r[i].prefixLength >= h->arenaSize) {
+      printf("Prefix index %s: invalid item, rebuilding it\n", fileName.c_str());
+      items.clear();
+      delete f;
+      return false;
+    }
+    // Prefix strings are read from the mapped file
+    it.prefix = (char *)(arena + r[i].prefixOffset);
+    it.prefixLength = r[i].prefixLength;
+    it.sPrefix = r[i].sPrefix;
+    it.difficulty = r[i].difficulty;
+    it.type = r[i].type;
+    memcpy(it.hash160Min, r[i].hash160Min, 20);
+    memcpy(it.hash160Max, r[i].hash160Max, 20);
+    it.isFull = r[i].isFull != 0;
+    it.lPrefix = r[i].lPrefix;
+    memcpy(it.hash160, r[i].hash160, 20);
+  }
+
+  if (h->searchTypes != getItemTypes(items)) {
+    printf("Prefix index %s: invalid address types, rebuilding it\n", fileName.c_str());
+    items.clear();
+    delete f;
+    return false;
+  }
+
+  // Bech32 inputs are converted to lower case as by initPrefix()
+  for (int i = 0; i < (int)inputPrefixes.size(); i++) {
+    if (inputPrefixes[i].length() >= 2)
+      getAddressType(inputPrefixes[i]);
+  }
+
+  // Kept mapped until the lookup table is built
+  prefixIndex = f;
+  printf("Prefix index: %s (%u items)\n", fileName.c_str(), h->nbItem);
+  return true;
+
+}
+
+void VanitySearch::savePrefixIndex(std::string fileName, uint64_t hash, std::vector<PREFIX_ITEM> &items, std::vector<uint32_t> &itemStart) {
+
+  // Write a temporary file first, a crash while writing keeps the previous index
+  string tmpFile = fileName + ".tmp";
+  FILE *f = fopen(tmpFile.c_str(), "wb");
+  if (f == NULL) {
+    printf("Cannot write prefix index %s: %s\n", tmpFile.c_str(), strerror(errno));
+    return;
+  }
+
+  PREFIX_INDEX_HEADER h;
+  memset(&h, 0, sizeof(h));
+  h.magic = PREFIX_INDEX_MAGIC;
+  h.version = PREFIX_INDEX_VERSION;
+  h.prefixHash = hash;
+  h.nbInput = (uint32_t)inputPrefixes.size();
+  h.nbItem = (uint32_t)items.size();
+  h.searchTypes = getItemTypes(items);
+  h.caseSensitive = getIndexCaseMode();
+  for (size_t i = 0; i < items.size(); i++)
+    h.arenaSize += items[i].prefixLength + 1;
+
+  bool ok = fwrite(&h, sizeof(h), 1, f) == 1;
+  ok = ok && fwrite(itemStart.data(), 4, itemStart.size(), f) == itemStart.size();
+  uint8_t pad[8];
+  memset(pad, 0, 8);
+  size_t padSize = getIndexItemOffset(h.nbInput) - (sizeof(h) + itemStart.size() * 4);
+  ok = ok && (padSize == 0 || fwrite(pad, 1, padSize, f) == padSize);
+
+  uint32_t offset = 0;
+  for (size_t i = 0; i < items.size() && ok; i++) {
+    PREFIX_INDEX_ITEM r;
+    memset(&r, 0, sizeof(r));
+    r.difficulty = items[i].difficulty;
+    r.prefixOffset = offset;
+    r.prefixLength = (uint16_t)items[i].prefixLength;
+    r.sPrefix = items[i].sPrefix;
+    r.lPrefix = items[i].lPrefix;
+    r.isFull = items[i].isFull;
+    r.type = (uint8_t)items[i].type;
+    memcpy(r.hash160, items[i].hash160, 20);
+    memcpy(r.hash160Min, items[i].hash160Min, 20);
+    memcpy(r.hash160Max, items[i].hash160Max, 20);
+    offset += items[i].prefixLength + 1;
+    ok = fwrite(&r, sizeof(r), 1, f) == 1;
+  }
+
+  // String arena
+  for (size_t i = 0; i < items.size() && ok; i++)
+    ok = fwrite(items[i].prefix, 1, items[i].prefixLength + 1, f) == (size_t)(items[i].prefixLength + 1);
+
+  ok = (fclose(f) == 0) && ok;
+  if (!ok) {
+    printf("Cannot write prefix index %s: %s\n", tmpFile.c_str(), strerror(errno));
+    remove(tmpFile.c_str());
+    return;
+  }
+
+#ifdef WIN64
+  remove(fileName.c_str());
+#endif
+  if (rename(tmpFile.c_str(), fileName.c_str()) != 0) {
+    printf("Cannot rename %s to %s\n", tmpFile.c_str(), fileName.c_str());
+    remove(tmpFile.c_str());
+    return;
+  }
+  printf("Prefix index: %s saved (%u items)\n", fileName.c_str(), h.nbItem);
+
+}
+
+// ----------------------------------------------------------------------------
+
+void VanitySearch::dumpPrefixes() {
+
+  for (int i = 0; i < (int)usedPrefix.size(); i++) {
+    prefix_t p = usedPrefix[i];
+    printf("%04X\n", p);
+    for (uint32_t j = prefixStart[p]; j < prefixStart[p + 1]; j++) {
+      printf("  %d\n", p);
+      printf("  %g\n", prefixDifficulty[j]);
+      printf("  %s\n", prefixArena.data() + prefixEntry[j].prefix);
+    }
+  }
+
+}
+// ----------------------------------------------------------------------------
+
+// Length of the prefix part expanded in case combinations
+int VanitySearch::getCaseFoldLength(std::string &prefix) {
+
+  if (!caseFold)
+    return (int)prefix.length();
+
+  int nbLetter = 0;
+  int length = 1;
+  while (length < (int)prefix.length()) {
+    if (isalpha(prefix.data()[length])) {
+      if (nbLetter == CASE_FOLD_LETTERS)
+        break;
+      nbLetter++;
+    }
+    length++;
+  }
+  return length;
+
+}
+
+// Number of Base58 characters equal to c, case folded
+int VanitySearch::getCaseCount(char c) {
+
+  static const char *b58 = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+  int nb = 0;
+  if (strchr(b58, tolower(c))) nb++;
+  if (isalpha(c) && strchr(b58, toupper(c))) nb++;
+  return nb;
+
+}
+
+// Case folded prefix comparison
+bool VanitySearch::prefixMatch(char *prefix, char *addr) {
+
+  while (*prefix && tolower(*prefix) == tolower(*addr)) {
+    prefix++;
+    addr++;
+  }
+  return *prefix == 0;
+
+}
+
+void VanitySearch::enumCaseUnsentivePrefix(std::string s, std::vector<std::string> &list) {
+
+  char letter[64];
+  int letterpos[64];
+  int nbLetter = 0;
+  int length = (int)s.length();
+
+  for (int i = 1; i < length; i++) {
+    char c = s.data()[i];
+    if( (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ) {
+      letter[nbLetter] = tolower(c);
+      letterpos[nbLetter] = i;
+      nbLetter++;
+    }
+  }
+
+  int total = 1 << nbLetter;
+
+  for (int i = 0; i < total; i++) {
+
+    char tmp[64];
+    strcpy(tmp, s.c_str());
+
+    for (int j = 0; j < nbLetter; j++) {
+      int mask = 1 << j;
+      if (mask&i) tmp[letterpos[j]] = toupper(letter[j]);
+      else         tmp[letterpos[j]] = letter[j];
+    }
+
+    list.push_back(string(tmp));
+
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+
+double VanitySearch::getDiffuclty() {
+
+  double min = pow(2,160);
+
+  if (onlyFull)
+    return min;
+
+  // Found states only grow, skip the found entries from the last position
+  uint32_t c = diffCursor;
+  uint32_t n = c;
+  while (n < (uint32_t)diffOrder.size() && isFound(prefixEntry[diffOrder[n]].found))
+    n++;
+  while (n > c && !diffCursor.compare_exchange_weak(c, n));
+  if (n < (uint32_t)diffOrder.size())
+    min = prefixDifficulty[diffOrder[n]];
+
+  return min;
+
+}
+
+double log1(double x) {
+  // Use taylor series to approximate log(1-x)
+  return -x - (x*x)/2.0 - (x*x*x)/3.0 - (x*x*x*x)/4.0;
+}
+
+string VanitySearch::GetExpectedTime(double keyRate,double keyCount) {
+
+  char tmp[128];
   string ret;
 
   if(hasPattern)
@@ -666,244 +1495,416 @@ string VanitySearch::GetExpectedTime(double keyRate,double keyCount) {
 
 // ----------------------------------------------------------------------------
 
-void VanitySearch::output(string addr,string pAddr,string pAddrHex) {
+void VanitySearch::lock() {
 
 #ifdef WIN64
-   WaitForSingleObject(ghMutex,INFINITE);
+  WaitForSingleObject(ghMutex, INFINITE);
 #else
   pthread_mutex_lock(&ghMutex);
 #endif
 
-  FILE *f = stdout;
-  bool needToClose = false;
-
-  if (outputFile.length() > 0) {
-    f = fopen(outputFile.c_str(), "a");
-    if (f == NULL) {
-      printf("Cannot open %s for writing\n", outputFile.c_str());
-      f = stdout;
-    } else {
-      needToClose = true;
-    }
-  }
-
-  if(!needToClose)
-    printf("\n");
+}
 
-  fprintf(f, "PubAddress: %s\n", addr.c_str());
+void VanitySearch::unlock() {
 
-  if (startPubKeySpecified) {
+#ifdef WIN64
+  ReleaseMutex(ghMutex);
+#else
+  pthread_mutex_unlock(&ghMutex);
+#endif
 
-    fprintf(f, "PartialPriv: %s\n", pAddr.c_str());
+}
 
-  } else {
+void VanitySearch::notifyMonitor(TH_PARAM *ph) {
 
-    switch (searchType) {
-    case P2PKH:
-      fprintf(f, "Priv (WIF): p2pkh:%s\n", pAddr.c_str());
-      break;
-    case P2SH:
-      fprintf(f, "Priv (WIF): p2wpkh-p2sh:%s\n", pAddr.c_str());
-      break;
-    case BECH32:
-      fprintf(f, "Priv (WIF): p2wpkh:%s\n", pAddr.c_str());
-      break;
-    }
-    fprintf(f, "Priv (HEX): 0x%s\n", pAddrHex.c_str());
+  // A search thread ending (ph) clears its isRunning flag with the notification
+#ifdef WIN64
+  if (ph) ph->isRunning = false;
+  SetEvent(monitorEvent);
+#else
+  pthread_mutex_lock(&monitorMutex);
+  if (ph) ph->isRunning = false;
+  monitorSignaled = true;
+  pthread_cond_signal(&monitorCond);
+  pthread_mutex_unlock(&monitorMutex);
+#endif
 
-  }
+}
 
-  if(needToClose)
-    fclose(f);
+void VanitySearch::waitMonitor(int millis) {
 
+  // Wait for millis or until a search thread ends
 #ifdef WIN64
-  ReleaseMutex(ghMutex);
+  WaitForSingleObject(monitorEvent, millis);
 #else
-  pthread_mutex_unlock(&ghMutex);
+  struct timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  ts.tv_sec += millis / 1000;
+  ts.tv_nsec += (long)(millis % 1000) * 1000000L;
+  if (ts.tv_nsec >= 1000000000L) {
+    ts.tv_sec++;
+    ts.tv_nsec -= 1000000000L;
+  }
+  pthread_mutex_lock(&monitorMutex);
+  while (!monitorSignaled) {
+    if (pthread_cond_timedwait(&monitorCond, &monitorMutex, &ts) != 0)
+      break;
+  }
+  monitorSignaled = false;
+  pthread_mutex_unlock(&monitorMutex);
 #endif
 
 }
 
-// ----------------------------------------------------------------------------
-
-void VanitySearch::updateFound() {
-
-  // Check if all prefixes has been found
-  // Needed only if stopWhenFound is asked
-  if (stopWhenFound) {
+void VanitySearch::SetOutputFormat(int format, int syncPolicy) {
 
-    if (hasPattern) {
+  // Called before the search, the writer is opened again with the CSV header
+  outputFormat = format;
+  outputSync = syncPolicy;
+  delete resultWriter;
+  openOutput();
 
-      bool allFound = true;
-      for (int i = 0; i < (int)inputPrefixes.size(); i++) {
-        allFound &= patternFound[i];
-      }
-      endOfSearch = allFound;
+}
 
-    } else {
+void VanitySearch::SetScheduler(bool enable) {
 
-      bool allFound = true;
-      for (int i = 0; i < (int)usedPrefix.size(); i++) {
-        bool iFound = true;
-        prefix_t p = usedPrefix[i];
-        if (!prefixes[p].found) {
-          if (prefixes[p].items) {
-            for (int j = 0; j < (int)prefixes[p].items->size(); j++) {
-              iFound &= *((*prefixes[p].items)[j].found);
-            }
-          }
-          prefixes[usedPrefix[i]].found = iFound;
-        }
-        allFound &= iFound;
-      }
-      endOfSearch = allFound;
+  useScheduler = enable;
 
-      // Update difficulty to the next most probable item
-      _difficulty = getDiffuclty();
+}
 
-    }
+void VanitySearch::SetNetwork(std::string bindAddr, std::string token) {
 
-  }
+  netBind = bindAddr;
+  netToken = token;
 
 }
 
-// ----------------------------------------------------------------------------
+void VanitySearch::KeepResults(bool enable) {
 
-bool VanitySearch::checkPrivKey(string addr, Int &key, int32_t incr, int endomorphism, bool mode) {
+  keepResults = enable;
 
-  Int k(&key);
-  Point sp = startPubKey;
+}
 
-  if (incr < 0) {
-    k.Add((uint64_t)(-incr));
-    k.Neg();
-    k.Add(&secp->order);
-    if (startPubKeySpecified) sp.y.ModNeg();
-  } else {
-    k.Add((uint64_t)incr);
-  }
+void VanitySearch::GetResults(std::vector<std::string> &r) {
 
-  // Endomorphisms
-  switch (endomorphism) {
-  case 1:
-    k.ModMulK1order(&lambda);
-    if(startPubKeySpecified) sp.x.ModMulK1(&beta);
-    break;
-  case 2:
-    k.ModMulK1order(&lambda2);
-    if (startPubKeySpecified) sp.x.ModMulK1(&beta2);
-    break;
-  }
+  lock();
+  r = results;
+  unlock();
 
-  // Check addresses
-  Point p = secp->ComputePublicKey(&k);
-  if (startPubKeySpecified) p = secp->AddDirect(p, sp);
+}
 
-  string chkAddr = secp->GetAddress(searchType, mode, p);
-  if (chkAddr != addr) {
+bool VanitySearch::IsInterrupted() {
 
-    //Key may be the opposite one (negative zero or compressed key)
-    k.Neg();
-    k.Add(&secp->order);
-    p = secp->ComputePublicKey(&k);
-    if (startPubKeySpecified) {
-      sp.y.ModNeg();
-      p = secp->AddDirect(p, sp);
-    }
-    string chkAddr = secp->GetAddress(searchType, mode, p);
-    if (chkAddr != addr) {
-      printf("\nWarning, wrong private key generated !\n");
-      printf("  Addr :%s\n", addr.c_str());
-      printf("  Check:%s\n", chkAddr.c_str());
-      printf("  Endo:%d incr:%d comp:%d\n", endomorphism, incr, mode);
-      return false;
-    }
+  return interrupted;
 
-  }
+}
 
-  output(addr, secp->GetPrivAddress(mode ,k), k.GetBase16());
+void VanitySearch::Stop() {
 
-  return true;
+  // Search threads and the monitor leave at their next check
+  stopRequest = true;
+  endOfSearch = true;
+  notifyMonitor();
 
 }
 
-void VanitySearch::checkAddrSSE(uint8_t *h1, uint8_t *h2, uint8_t *h3, uint8_t *h4,
-                                int32_t incr1, int32_t incr2, int32_t incr3, int32_t incr4,
-                                Int &key, int endomorphism, bool mode) {
+void VanitySearch::SetQuota(uint32_t quota) {
 
-  vector<string> addr = secp->GetAddress(searchType, mode, h1,h2,h3,h4);
+  // Bulk mode, each input stays active until quota keys have been found
+  this->quota = quota;
+  stopWhenFound = true;
 
-  for (int i = 0; i < (int)inputPrefixes.size(); i++) {
+}
 
-    if (Wildcard::match(addr[0].c_str(), inputPrefixes[i].c_str(), caseSensitive)) {
+void VanitySearch::output(string addr,string pAddr,string pAddrHex) {
 
-      // Found it !
-      //*((*pi)[i].found) = true;
-      if (checkPrivKey(addr[0], key, incr1, endomorphism, mode)) {
-        nbFoundKey++;
-        patternFound[i] = true;
-        updateFound();
-      }
+  PROF_START(PROF_OUTPUT);
+  static const char *typeName[] = { "p2pkh","p2wpkh-p2sh","p2wpkh" };
+  int type = addressType(addr);
+  string r;
+  char tmp[512];
 
-    }
+  // Progress line on stdout (text format, the others stay machine readable)
+  if (outputFile.length() == 0 && outputFormat == OUTPUT_TEXT)
+    r.append("\n");
 
-    if (Wildcard::match(addr[1].c_str(), inputPrefixes[i].c_str(), caseSensitive)) {
+  switch (outputFormat) {
 
-      // Found it !
-      //*((*pi)[i].found) = true;
-      if (checkPrivKey(addr[1], key, incr2, endomorphism, mode)) {
-        nbFoundKey++;
-        patternFound[i] = true;
-        updateFound();
-      }
+  case OUTPUT_JSONL:
+    if (startPubKeySpecified) {
+      sprintf(tmp, "{\"address\":\"%s\",\"partialPriv\":\"%s\"}\n", addr.c_str(), pAddr.c_str());
+    } else {
+      sprintf(tmp, "{\"address\":\"%s\",\"type\":\"%s\",\"wif\":\"%s\",\"hex\":\"0x%s\"}\n",
+        addr.c_str(), typeName[type], pAddr.c_str(), pAddrHex.c_str());
+    }
+    r.append(tmp);
+    break;
 
+  case OUTPUT_CSV:
+    if (startPubKeySpecified) {
+      sprintf(tmp, "%s,%s\n", addr.c_str(), pAddr.c_str());
+    } else {
+      sprintf(tmp, "%s,%s,%s,0x%s\n", addr.c_str(), typeName[type], pAddr.c_str(), pAddrHex.c_str());
     }
+    r.append(tmp);
+    break;
 
-    if (Wildcard::match(addr[2].c_str(), inputPrefixes[i].c_str(), caseSensitive)) {
+  default:
+    r.append("PubAddress: " + addr + "\n");
+    if (startPubKeySpecified) {
+      r.append("PartialPriv: " + pAddr + "\n");
+    } else {
+      r.append("Priv (WIF): " + string(typeName[type]) + ":" + pAddr + "\n");
+      r.append("Priv (HEX): 0x" + pAddrHex + "\n");
+    }
+    break;
 
-      // Found it !
-      //*((*pi)[i].found) = true;
-      if (checkPrivKey(addr[2], key, incr3, endomorphism, mode)) {
-        nbFoundKey++;
-        patternFound[i] = true;
-        updateFound();
-      }
+  }
+
+  // The writer has its own lock
+  resultWriter->Write(r);
+
+  if (keepResults) {
+    lock();
+    results.push_back(addr + " " + pAddr + " " + pAddrHex);
+    unlock();
+  }
+
+  // Report to the coordinator
+  if (server)
+    serverWrite("FOUND " + addr + " " + pAddr + " " + pAddrHex);
+
+  PROF_STOP(PROF_OUTPUT);
+
+}
+
+void VanitySearch::openOutput() {
+
+  string header;
+  if (outputFormat == OUTPUT_CSV)
+    header = startPubKeySpecified ? "address,partial_priv\n" : "address,type,wif,hex\n";
+  resultWriter = new ResultWriter(outputFile, header, outputSync);
+
+}
+
+// Wait until the pending results are written, the file is closed by the destructor
+void VanitySearch::closeOutput() {
+
+  resultWriter->Flush();
+
+}
+
+// Lines to the coordinator, sent outside of the global lock
+void VanitySearch::serverWrite(string line) {
+
+#ifdef WIN64
+  WaitForSingleObject(netMutex, INFINITE);
+  server->WriteLine(line);
+  ReleaseMutex(netMutex);
+#else
+  pthread_mutex_lock(&netMutex);
+  server->WriteLine(line);
+  pthread_mutex_unlock(&netMutex);
+#endif
+
+}
+
+// ----------------------------------------------------------------------------
+
+void VanitySearch::updateFound() {
+
+  // Check if all prefixes has been found
+  // Needed only if stopWhenFound is asked
+  if (stopWhenFound) {
+
+    // Remaining counts are updated by setFound()
+    endOfSearch = (nbLeft == 0) || stopRequest;
+
+    // Update difficulty to the next most probable item
+    if (!hasPattern)
+      _difficulty = getDiffuclty();
+
+  }
+
+}
+
+bool VanitySearch::hitFound(uint32_t id) {
+
+  // Count a hit, returns false if the quota of the input is already reached
+  uint32_t n = inputCount[id].fetch_add(1);
+  if (quota == 0) {
+    setFound(id);
+    return true;
+  }
+  if (n >= quota)
+    return false;
+  if (n + 1 == quota)
+    setFound(id);
+  return true;
+
+}
+
+void VanitySearch::setFound(uint32_t id) {
+
+  uint64_t mask = 1ULL << (id & 63);
+  if (foundBits[id >> 6].fetch_or(mask) & mask)
+    return;
 
+  // First time found, update the remaining counts
+  if (hasPattern) {
+    nbLeft--;
+    return;
+  }
+  for (uint32_t j = inputEntryStart[id]; j < inputEntryStart[id + 1]; j++) {
+    if (prefixLeft[inputEntryPrefix[j]].fetch_sub(1) == 1) {
+      nbLeft--;
+      prefixVersion++;
     }
+  }
 
-    if (Wildcard::match(addr[3].c_str(), inputPrefixes[i].c_str(), caseSensitive)) {
+}
 
-      // Found it !
-      //*((*pi)[i].found) = true;
-      if (checkPrivKey(addr[3], key, incr4, endomorphism, mode)) {
-        nbFoundKey++;
-        patternFound[i] = true;
-        updateFound();
-      }
+// ----------------------------------------------------------------------------
+
+void VanitySearch::getPrivKey(Int &key, int32_t incr, int endomorphism, Int &k, Point &sp) {
+
+  k.Set(&key);
+  sp = startPubKey;
+
+  if (incr < 0) {
+    k.Add((uint64_t)(-incr));
+    k.Neg();
+    k.Add(&secp->order);
+    if (startPubKeySpecified) sp.y.ModNeg();
+  } else {
+    k.Add((uint64_t)incr);
+  }
+
+  // Endomorphisms
+  switch (endomorphism) {
+  case 1:
+    k.ModMulK1order(&lambda);
+    if(startPubKeySpecified) sp.x.ModMulK1(&beta);
+    break;
+  case 2:
+    k.ModMulK1order(&lambda2);
+    if (startPubKeySpecified) sp.x.ModMulK1(&beta2);
+    break;
+  }
+
+}
+
+bool VanitySearch::checkPrivKey(string addr, Int &key, int32_t incr, int endomorphism, bool mode) {
+
+  Int k;
+  Point sp;
+  getPrivKey(key, incr, endomorphism, k, sp);
+
+  // Check addresses
+  Point p = secp->ComputePublicKey(&k);
+  if (startPubKeySpecified) p = secp->AddDirect(p, sp);
 
+  int type = addressType(addr);
+  string chkAddr = secp->GetAddress(type, mode, p);
+  if (chkAddr != addr) {
+
+    //Key may be the opposite one (negative zero or compressed key)
+    k.Neg();
+    k.Add(&secp->order);
+    p = secp->ComputePublicKey(&k);
+    if (startPubKeySpecified) {
+      sp.y.ModNeg();
+      p = secp->AddDirect(p, sp);
+    }
+    string chkAddr = secp->GetAddress(type, mode, p);
+    if (chkAddr != addr) {
+      printf("\nWarning, wrong private key generated !\n");
+      printf("  Addr :%s\n", addr.c_str());
+      printf("  Check:%s\n", chkAddr.c_str());
+      printf("  Endo:%d incr:%d comp:%d\n", endomorphism, incr, mode);
+      return false;
     }
 
   }
 
+  output(addr, secp->GetPrivAddress(mode ,k), k.GetBase16());
+
+  return true;
 
 }
 
-void VanitySearch::checkAddr(int prefIdx, uint8_t *hash160, Int &key, int32_t incr, int endomorphism, bool mode) {
+void VanitySearch::checkPrivKeys(int nbItem, FOUND_ITEM *items, string *addrs) {
 
-  if (hasPattern) {
+  Int k[VERIFY_BATCH_SIZE];
+  Point sp[VERIFY_BATCH_SIZE];
+  Point p[VERIFY_BATCH_SIZE];
+  uint8_t h[20];
+
+  for (int i = 0; i < nbItem; i++)
+    getPrivKey(items[i].key, items[i].incr, items[i].endo, k[i], sp[i]);
+
+  // One grouped inversion for the whole batch
+  secp->ComputePublicKeys(nbItem, k, p);
+
+  for (int i = 0; i < nbItem; i++) {
+
+    if (startPubKeySpecified) p[i] = secp->AddDirect(p[i], sp[i]);
+
+    int type = addressType(addrs[i]);
+    secp->GetHash160(type, items[i].mode, p[i], h);
+    if (!ripemd160_comp_hash(h, items[i].hash160)) {
+
+      // Key may be the opposite one (negative zero or compressed key)
+      // -k.G (+ -startPubKey) is the symmetric point, no need to recompute it
+      k[i].Neg();
+      k[i].Add(&secp->order);
+      p[i].y.ModNeg();
+      secp->GetHash160(type, items[i].mode, p[i], h);
+      if (!ripemd160_comp_hash(h, items[i].hash160)) {
+        printf("\nWarning, wrong private key generated !\n");
+        printf("  Addr :%s\n", addrs[i].c_str());
+        printf("  Check:%s\n", secp->GetAddress(type, items[i].mode, h).c_str());
+        printf("  Endo:%d incr:%d comp:%d\n", items[i].endo, items[i].incr, items[i].mode);
+        continue;
+      }
+
+    }
+
+    output(addrs[i], secp->GetPrivAddress(items[i].mode, k[i]), k[i].GetBase16());
+    nbFoundKey++;
+    updateFound();
+
+  }
+
+}
+
+void VanitySearch::checkPattern(string &addr, Int &key, int32_t incr, int endomorphism, bool mode) {
+
+  if (hasDFA) {
+
+    // All patterns in a single pass
+    const uint32_t *ids;
+    int nbMatch = patternDFA.Match(addr.c_str(), &ids);
+    bool hit = false;
+    for (int i = 0; i < nbMatch; i++)
+      hit |= hitFound(ids[i]);
+    if (hit) {
+      // Found it !
+      if (checkPrivKey(addr, key, incr, endomorphism, mode)) {
+        nbFoundKey++;
+        updateFound();
+      }
+    }
 
-    // Wildcard search
-    string addr = secp->GetAddress(searchType, mode, hash160);
+  } else {
 
     for (int i = 0; i < (int)inputPrefixes.size(); i++) {
 
-      if (Wildcard::match(addr.c_str(), inputPrefixes[i].c_str(), caseSensitive)) {
+      if (Wildcard::match(addr.c_str(), inputPrefixes[i].c_str(), caseSensitive) && hitFound(i)) {
 
         // Found it !
-        //*((*pi)[i].found) = true;
         if (checkPrivKey(addr, key, incr, endomorphism, mode)) {
           nbFoundKey++;
-          patternFound[i] = true;
           updateFound();
         }
 
@@ -911,26 +1912,104 @@ void VanitySearch::checkAddr(int prefIdx, uint8_t *hash160, Int &key, int32_t in
 
     }
 
-    return;
+  }
+
+}
+
+void VanitySearch::checkAddrSSE(uint8_t *h1, uint8_t *h2, uint8_t *h3, uint8_t *h4,
+                                int32_t incr1, int32_t incr2, int32_t incr3, int32_t incr4,
+                                Int &key, int endomorphism, bool mode, int type) {
+
+  int types[2];
+  int nbType = getPatternTypes(type, mode, types);
+  for (int t = 0; t < nbType; t++) {
+
+    vector<string> addr = secp->GetAddress(types[t], mode, h1,h2,h3,h4);
+
+    checkPattern(addr[0], key, incr1, endomorphism, mode);
+    checkPattern(addr[1], key, incr2, endomorphism, mode);
+    checkPattern(addr[2], key, incr3, endomorphism, mode);
+    checkPattern(addr[3], key, incr4, endomorphism, mode);
 
   }
 
-  vector<PREFIX_ITEM> *pi = prefixes[prefIdx].items;
+}
+
+void VanitySearch::checkAddr(int prefIdx, uint8_t *hash160, Int &key, int32_t incr, int endomorphism, bool mode, int type) {
+
+  if (hasPattern) {
+
+    // Wildcard search, Bech32 masks are checked before encoding the address
+    if (hasPatternMask) {
+      int i = 0;
+      while (i < (int)patternMask.size() && !bech32Match(hash160, patternMask[i]))
+        i++;
+      if (i == (int)patternMask.size())
+        return;
+    }
+    int types[2];
+    int nbType = getPatternTypes(type, mode, types);
+    for (int t = 0; t < nbType; t++) {
+      string addr = secp->GetAddress(types[t], mode, hash160);
+      checkPattern(addr, key, incr, endomorphism, mode);
+    }
+    return;
+
+  }
 
   if (onlyFull) {
 
     // Full addresses
-    for (int i = 0; i < (int)pi->size(); i++) {
+    uint32_t id;
+    if (fullTable.Find(hash160, &id) && hashType(fullType[id]) == type && (mode || fullType[id] != BECH32) &&
+        hitFound(fullFound[id])) {
+
+      // Found it !
+      // You believe it ?
+      if (checkPrivKey(secp->GetAddress(fullType[id], mode, hash160), key, incr, endomorphism, mode)) {
+        nbFoundKey++;
+        updateFound();
+      }
+
+    }
+
+  } else {
+
+    // The address is encoded only for hash160 within a prefix interval
+    string addr;
+    uint64_t hKey = getHash160Key(hash160);
+
+    for (uint32_t i = prefixStart[prefIdx]; i < prefixStart[prefIdx + 1]; i++) {
+
+      PREFIX_ENTRY &e = prefixEntry[i];
+      if (hKey < e.min || hKey > e.max || hashType(e.type) != type)
+        continue;
 
-      if (stopWhenFound && *((*pi)[i].found))
+      // BECH32 addresses use compressed keys only
+      if (!mode && e.type == BECH32)
         continue;
 
-      if (ripemd160_comp_hash((*pi)[i].hash160, hash160)) {
+      if (stopWhenFound && isFound(e.found))
+        continue;
+
+      // Bech32 prefixes are compared on the hash160 bits, P2PKH and
+      // BECH32 entries of the same prefix share the hash160
+      bool match;
+      if (e.type == BECH32) {
+        match = bech32Match(hash160, bech32Mask[e.mask]);
+      } else {
+        if (addr.length() == 0 || addressType(addr) != e.type)
+          addr = secp->GetAddress(e.type, mode, hash160);
+        match = caseSensitive ? strncmp(prefixArena.data() + e.prefix, addr.c_str(), e.prefixLength) == 0 :
+                                prefixMatch(prefixArena.data() + e.prefix, (char *)addr.c_str());
+      }
+
+      if (match && hitFound(e.found)) {
 
         // Found it !
-        *((*pi)[i].found) = true;
-        // You believe it ?
-        if (checkPrivKey(secp->GetAddress(searchType, mode, hash160), key, incr, endomorphism, mode)) {
+        if (addr.length() == 0 || addressType(addr) != e.type)
+          addr = secp->GetAddress(e.type, mode, hash160);
+        if (checkPrivKey(addr, key, incr, endomorphism, mode)) {
           nbFoundKey++;
           updateFound();
         }
@@ -939,36 +2018,136 @@ void VanitySearch::checkAddr(int prefIdx, uint8_t *hash160, Int &key, int32_t in
 
     }
 
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+
+void VanitySearch::pushFound(int prefIdx, uint8_t *hash160, Int &key, int32_t incr, int endomorphism, bool mode, int type) {
+
+  nbHit.fetch_add(1, std::memory_order_relaxed);
+
+  // Pattern search checks every address on the calling thread
+  if (!hasPattern && nbVerifyThread > 0) {
+
+    FOUND_ITEM it;
+    it.key.Set(&key);
+    it.incr = incr;
+    it.endo = (int16_t)endomorphism;
+    it.mode = mode;
+    it.type = (int8_t)type;
+    it.prefIdx = prefIdx;
+    memcpy(it.hash160, hash160, 20);
+    if (foundQueue->Push(it)) {
+      nbQueued++;
+      return;
+    }
+
+  }
+
+  // Queue full or no verification thread
+  checkAddr(prefIdx, hash160, key, incr, endomorphism, mode, type);
+
+}
+
+int VanitySearch::matchAddr(FOUND_ITEM &it, vector<string> &addrs) {
+
+  addrs.clear();
+
+  if (onlyFull) {
+
+    // Full addresses
+    uint32_t id;
+    if (fullTable.Find(it.hash160, &id) && hashType(fullType[id]) == it.type && (it.mode || fullType[id] != BECH32) &&
+        hitFound(fullFound[id])) {
+      addrs.push_back(secp->GetAddress(fullType[id], it.mode, it.hash160));
+    }
+
   } else {
 
+    // One address per matching entry (as checkAddr()), P2PKH and BECH32
+    // entries may both match the same hash160
+    string cAddr;
+    uint64_t hKey = getHash160Key(it.hash160);
 
-    char a[64];
+    for (uint32_t i = prefixStart[it.prefIdx]; i < prefixStart[it.prefIdx + 1]; i++) {
 
-    string addr = secp->GetAddress(searchType, mode, hash160);
+      PREFIX_ENTRY &e = prefixEntry[i];
+      if (hKey < e.min || hKey > e.max || hashType(e.type) != it.type)
+        continue;
 
-    for (int i = 0; i < (int)pi->size(); i++) {
+      // BECH32 addresses use compressed keys only
+      if (!it.mode && e.type == BECH32)
+        continue;
 
-      if (stopWhenFound && *((*pi)[i].found))
+      if (stopWhenFound && isFound(e.found))
         continue;
 
-      strncpy(a, addr.c_str(), (*pi)[i].prefixLength);
-      a[(*pi)[i].prefixLength] = 0;
+      bool eMatch;
+      if (e.type == BECH32) {
+        eMatch = bech32Match(it.hash160, bech32Mask[e.mask]);
+      } else {
+        if (cAddr.length() == 0 || addressType(cAddr) != e.type)
+          cAddr = secp->GetAddress(e.type, it.mode, it.hash160);
+        eMatch = caseSensitive ? strncmp(prefixArena.data() + e.prefix, cAddr.c_str(), e.prefixLength) == 0 :
+                                 prefixMatch(prefixArena.data() + e.prefix, (char *)cAddr.c_str());
+      }
 
-      if (strcmp((*pi)[i].prefix, a) == 0) {
+      if (eMatch && hitFound(e.found))
+        addrs.push_back((e.type == BECH32) ? secp->GetAddress(BECH32, it.mode, it.hash160) : cAddr);
 
-        // Found it !
-        *((*pi)[i].found) = true;
-        if (checkPrivKey(addr, key, incr, endomorphism, mode)) {
-          nbFoundKey++;
-          updateFound();
-        }
+    }
+
+  }
+
+  return (int)addrs.size();
 
+}
+
+void VanitySearch::VerifyKeys(TH_PARAM *ph) {
+
+  FOUND_ITEM it;
+  FOUND_ITEM items[VERIFY_BATCH_SIZE];
+  string addrs[VERIFY_BATCH_SIZE];
+  vector<string> matched;
+  PROF_THREAD(PROF_VERIFY_SLOT + ph->threadId);
+  ph->hasStarted = true;
+
+  while (!endOfVerify || !foundQueue->IsEmpty()) {
+
+    // Collect the real hits, the private keys are then checked together
+    int nbPop = 0;
+    int nbItem = 0;
+    double t0 = Timer::get_tick();
+    PROF_START(PROF_VERIFY);
+    while (nbItem < VERIFY_BATCH_SIZE && foundQueue->Pop(it)) {
+      nbPop++;
+      int nbMatch = matchAddr(it, matched);
+      for (int m = 0; m < nbMatch; m++) {
+        if (nbItem == VERIFY_BATCH_SIZE) {
+          checkPrivKeys(nbItem, items, addrs);
+          nbItem = 0;
+        }
+        items[nbItem] = it;
+        addrs[nbItem++] = matched[m];
       }
+    }
 
+    if (nbItem > 0)
+      checkPrivKeys(nbItem, items, addrs);
+    nbVerified += nbPop;
+    if (nbPop == 0) {
+      Timer::SleepMillis(1);
+    } else {
+      verifyTime[ph->threadId] += Timer::get_tick() - t0;
+      PROF_STOP(PROF_VERIFY);
     }
 
   }
 
+  ph->isRunning = false;
+
 }
 
 // ----------------------------------------------------------------------------
@@ -993,667 +2172,1354 @@ void *_FindKeyGPU(void *lpParam) {
   return 0;
 }
 
+#ifdef WIN64
+DWORD WINAPI _VerifyKeys(LPVOID lpParam) {
+#else
+void *_VerifyKeys(void *lpParam) {
+#endif
+  TH_PARAM *p = (TH_PARAM *)lpParam;
+  p->obj->VerifyKeys(p);
+  return 0;
+}
+
 // ----------------------------------------------------------------------------
 
-void VanitySearch::checkAddresses(bool compressed, Int key, int i, Point p1) {
+void VanitySearch::checkHashes(int nbLane, uint8_t h[][20], int type, bool compressed, Int &key, int i, bool sym, int endo) {
+
+  if (hasPattern && !hasPatternMask && nbLane == 4) {
+    if (sym)
+      checkAddrSSE(h[0], h[1], h[2], h[3], -i, -(i + 1), -(i + 2), -(i + 3), key, endo, compressed, type);
+    else
+      checkAddrSSE(h[0], h[1], h[2], h[3], i, i + 1, i + 2, i + 3, key, endo, compressed, type);
+    return;
+  }
+
+  for (int l = 0; l < nbLane; l++) {
+    int32_t incr = sym ? -(i + l) : (i + l);
+    if (hasPattern) {
+      checkAddr(0, h[l], key, incr, endo, compressed, type);
+    } else {
+      prefix_t pr = *(prefix_t *)h[l];
+      if (hasPrefix(pr))
+        pushFound(pr, h[l], key, incr, endo, compressed, type);
+    }
+  }
+
+}
+
+// Check nbLane consecutive points (1, 4 (SSE), 8 (AVX2) or 16 (AVX-512) lanes)
+// for all the searched compression modes and address types: the endomorphisms
+// and symmetric points are computed once, the public key hash160 is computed
+// once per mode and the script hash160 (P2SH) is derived from it.
+void VanitySearch::checkAddresses(int nbLane, Int key, int i, Int *x, Int *y) {
+
+  uint8_t h[16][20];
+  uint8_t sh[16][20];
+  Int e1x[16];
+  Int e2x[16];
+  Int ny[16];
+  Int *xv[3] = { x,e1x,e2x };
+  Int *yv[2] = { y,ny };
+  bool keyHash = (searchTypes & KEY_HASH_TYPES) != 0;
+  bool scriptHash = (searchTypes & TYPE_MASK(P2SH)) != 0;
+
+  // if (x, y) = k * G, then (beta*x, y) = lambda*k*G and (beta2*x, y) = lambda2*k*G
+  // if (x,y) = k*G, then (x, -y) is -k*G
+  PROF_START(PROF_POINTS);
+  for (int l = 0; l < nbLane; l++) {
+    e1x[l].ModMulK1(&x[l], &beta);
+    e2x[l].ModMulK1(&x[l], &beta2);
+    ny[l].Set(&y[l]);
+    ny[l].ModNeg();
+  }
+  PROF_STOP(PROF_POINTS);
+
+  // Point + endo #1 + endo #2 then Symetric point + endo #1 + endo #2
+  for (int sym = 0; sym < 2; sym++) {
+
+    for (int endo = 0; endo < 3; endo++) {
+
+      for (int m = 0; m < 2; m++) {
+
+        bool compressed = (m == 0);
+        if (compressed && searchMode == SEARCH_UNCOMPRESSED) continue;
+        if (!compressed && searchMode == SEARCH_COMPRESSED) continue;
+
+        PROF_START(PROF_HASH);
+        secp->GetHash160(P2PKH, compressed, nbLane, xv[endo], yv[sym], h);
+        PROF_STOP(PROF_HASH);
+        if (keyHash) {
+          PROF_START(PROF_CHECK);
+          checkHashes(nbLane, h, P2PKH, compressed, key, i, sym != 0, endo);
+          PROF_STOP(PROF_CHECK);
+        }
+        if (scriptHash) {
+          PROF_START(PROF_HASH);
+          secp->GetScriptHash160(nbLane, h, sh);
+          PROF_STOP(PROF_HASH);
+          PROF_START(PROF_CHECK);
+          checkHashes(nbLane, sh, P2SH, compressed, key, i, sym != 0, endo);
+          PROF_STOP(PROF_CHECK);
+        }
+
+      }
+
+    }
+
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+void VanitySearch::getShardKey(int device, int thread, Int &key) {
+
+  key.Set(&startKey);
+  Int offD((uint64_t)device);
+  offD.ShiftL(SHARD_DEVICE_SHIFT);
+  Int offT((uint64_t)thread);
+  offT.ShiftL(SHARD_THREAD_SHIFT);
+  key.Add(&offD);
+  key.Add(&offT);
+  key.Add(stats[device].offset);
+
+}
+
+// Center points of the CPU_GRP_BATCH consecutive groups starting at key
+void VanitySearch::getCPUStartingKey(int thId,Int& key,Point *startP) {
+
+  if (rekey > 0) {
+    key.Rand(256);
+  } else {
+    getShardKey(thId, 0, key);
+  }
+  Int km(&key);
+  km.Add((uint64_t)cpuGrpSize / 2);
+  startP[0] = secp->ComputePublicKey(&km);
+  if(startPubKeySpecified)
+   startP[0] = secp->AddDirect(startP[0],startPubKey);
+  for (int b = 1; b < CPU_GRP_BATCH; b++)
+    startP[b] = secp->AddDirect(startP[b - 1], _2Gn);
+
+}
+
+void VanitySearch::FindKeyCPU(TH_PARAM *ph) {
+
+  // Global init
+  int thId = ph->threadId;
+  stats[thId].counter = 0;
+
+  // CPU Thread, CPU_GRP_BATCH groups per batch inversion
+  int dxSize = cpuGrpSize / 2 + 1;
+  IntGroup *grp = new IntGroup(dxSize, CPU_GRP_BATCH);
+
+  // Group Init
+  Int  key;
+  Point startPts[CPU_GRP_BATCH];
+  getCPUStartingKey(thId,key,startPts);
+
+  // Group points are stored as separate x and y arrays (z is not needed) so that
+  // the hash functions read consecutive lanes without copying points
+  Int *dxs = new Int[dxSize * CPU_GRP_BATCH];
+  Int *px = new Int[cpuGrpSize];
+  Int *py = new Int[cpuGrpSize];
+
+  Int dy;
+  Int dyn;
+  Int _s;
+  Int _p;
+  Point pp;
+  Point pn;
+  for (int b = 0; b < CPU_GRP_BATCH; b++)
+    grp->Set(b, dxs + b * dxSize);
+
+  // GPU feeder threads use the first cores
+  if (useScheduler && !Timer::SetAffinity(nbGPUThread + thId))
+    printf("Warning, cannot pin CPU thread %d to core %d\n", thId, (nbGPUThread + thId) % Timer::getCoreNumber());
+
+  PROF_THREAD(thId);
+  ph->hasStarted = true;
+  ph->rekeyRequest = false;
+
+  while (!endOfSearch) {
+
+    // Parked by the scheduler
+    while (ph->isParked && !endOfSearch)
+      Timer::SleepMillis(50);
+
+    if (ph->rekeyRequest) {
+      getCPUStartingKey(thId, key, startPts);
+      ph->rekeyRequest = false;
+    }
+
+    // Fill groups
+    int i;
+    int hLength = (cpuGrpSize / 2 - 1);
+
+    PROF_START(PROF_MODINV);
+    for (int b = 0; b < CPU_GRP_BATCH; b++) {
+      Int *dx = dxs + b * dxSize;
+      Point &startP = startPts[b];
+      for (i = 0; i < hLength; i++) {
+        dx[i].ModSub(&Gn[i].x, &startP.x);
+      }
+      dx[i].ModSub(&Gn[i].x, &startP.x);  // For the first point
+      dx[i+1].ModSub(&_bGn.x, &startP.x); // For the center point of the next batch
+    }
+
+    // Grouped ModInv
+    grp->ModInv();
+    PROF_STOP(PROF_MODINV);
+
+    for (int b = 0; b < CPU_GRP_BATCH && !endOfSearch; b++) {
+
+      Int *dx = dxs + b * dxSize;
+      Point &startP = startPts[b];
+
+      // We use the fact that P + i*G and P - i*G has the same deltax, so the same inverse
+      // We compute key in the positive and negative way from the center of the group
+
+      // center point
+      PROF_START(PROF_POINTS);
+      px[cpuGrpSize/2].Set(&startP.x);
+      py[cpuGrpSize/2].Set(&startP.y);
+
+      i = 0;
+      if (groupIFMA) {
+        for (; i + IFMA_LANES <= hLength && !endOfSearch; i += IFMA_LANES)
+          groupIFMA->ComputePoints(startP, i, dx, px, py, cpuGrpSize / 2);
+      }
+
+      for (; i<hLength && !endOfSearch; i++) {
+
+        pp = startP;
+        pn = startP;
+
+        // P = startP + i*G
+        dy.ModSub(&Gn[i].y,&pp.y);
+
+        _s.ModMulK1(&dy, &dx[i]);       // s = (p2.y-p1.y)*inverse(p2.x-p1.x);
+        _p.ModSquareK1(&_s);            // _p = pow2(s)
+
+        pp.x.ModNeg();
+        pp.x.ModAdd(&_p);
+        pp.x.ModSub(&Gn[i].x);           // rx = pow2(s) - p1.x - p2.x;
+
+        pp.y.ModSub(&Gn[i].x, &pp.x);
+        pp.y.ModMulK1(&_s);
+        pp.y.ModSub(&Gn[i].y);           // ry = - p2.y - s*(ret.x-p2.x);
+
+        // P = startP - i*G  , if (x,y) = i*G then (x,-y) = -i*G
+        dyn.Set(&Gn[i].y);
+        dyn.ModNeg();
+        dyn.ModSub(&pn.y);
+
+        _s.ModMulK1(&dyn, &dx[i]);      // s = (p2.y-p1.y)*inverse(p2.x-p1.x);
+        _p.ModSquareK1(&_s);            // _p = pow2(s)
+
+        pn.x.ModNeg();
+        pn.x.ModAdd(&_p);
+        pn.x.ModSub(&Gn[i].x);          // rx = pow2(s) - p1.x - p2.x;
+
+        pn.y.ModSub(&Gn[i].x, &pn.x);
+        pn.y.ModMulK1(&_s);
+        pn.y.ModAdd(&Gn[i].y);          // ry = - p2.y - s*(ret.x-p2.x);
+
+        px[cpuGrpSize/2 + (i+1)].Set(&pp.x);
+        py[cpuGrpSize/2 + (i+1)].Set(&pp.y);
+        px[cpuGrpSize/2 - (i+1)].Set(&pn.x);
+        py[cpuGrpSize/2 - (i+1)].Set(&pn.y);
+
+      }
+
+      // First point (startP - (GRP_SZIE/2)*G)
+      pn = startP;
+      dyn.Set(&Gn[i].y);
+      dyn.ModNeg();
+      dyn.ModSub(&pn.y);
 
-  unsigned char h0[20];
-  Point pte1[1];
-  Point pte2[1];
+      _s.ModMulK1(&dyn, &dx[i]);
+      _p.ModSquareK1(&_s);
 
-  // Point
-  secp->GetHash160(searchType,compressed, p1, h0);
-  prefix_t pr0 = *(prefix_t *)h0;
-  if (hasPattern || prefixes[pr0].items)
-    checkAddr(pr0, h0, key, i, 0, compressed);
+      pn.x.ModNeg();
+      pn.x.ModAdd(&_p);
+      pn.x.ModSub(&Gn[i].x);
+
+      pn.y.ModSub(&Gn[i].x, &pn.x);
+      pn.y.ModMulK1(&_s);
+      pn.y.ModAdd(&Gn[i].y);
+
+      px[0].Set(&pn.x);
+      py[0].Set(&pn.y);
+
+      // Next start point of the group (startP + CPU_GRP_BATCH*GRP_SIZE*G)
+      pp = startP;
+      dy.ModSub(&_bGn.y, &pp.y);
+
+      _s.ModMulK1(&dy, &dx[i+1]);
+      _p.ModSquareK1(&_s);
+
+      pp.x.ModNeg();
+      pp.x.ModAdd(&_p);
+      pp.x.ModSub(&_bGn.x);
+
+      pp.y.ModSub(&_bGn.x, &pp.x);
+      pp.y.ModMulK1(&_s);
+      pp.y.ModSub(&_bGn.y);
+      startP = pp;
+      PROF_STOP(PROF_POINTS);
+
+#if 0
+      // Check
+      {
+        bool wrong = false;
+        Point p0 = secp.ComputePublicKey(&key);
+        for (int i = 0; i < cpuGrpSize; i++) {
+          if (!p0.x.IsEqual(&px[i]) || !p0.y.IsEqual(&py[i])) {
+            wrong = true;
+            printf("[%d] wrong point\n",i);
+          }
+          p0 = secp.NextKey(p0);
+        }
+        if(wrong) exit(0);
+      }
+#endif
+
+      // Check addresses
+      for (int i = 0; i < cpuGrpSize && !endOfSearch; i += cpuLanes)
+        checkAddresses(cpuLanes, key, i, px + i, py + i);
+
+      // An interrupted group is not counted, the checkpoint offset covers checked keys only
+      if (endOfSearch)
+        break;
+
+      // Groups of a batch are consecutive
+      key.Add((uint64_t)cpuGrpSize);
+      stats[thId].offset += cpuGrpSize;
+      stats[thId].counter+= 6*cpuGrpSize; // Point + endo #1 + endo #2 + Symetric point + endo #1 + endo #2
+
+    }
+
+  }
+
+  delete grp;
+  delete[] dxs;
+  delete[] px;
+  delete[] py;
+
+  notifyMonitor(ph);
+
+}
+
+// ----------------------------------------------------------------------------
+
+void VanitySearch::getGPUStartingKeys(int thId, int groupSize, int nbThread, Int *keys, Point *p) {
+
+  for (int i = 0; i < nbThread; i++) {
+    if (rekey > 0) {
+      keys[i].Rand(256);
+    } else {
+      getShardKey(thId, i, keys[i]);
+    }
+    Int k(keys + i);
+    // Starting key is at the middle of the group
+    k.Add((uint64_t)(groupSize / 2));
+    p[i] = secp->ComputePublicKey(&k);
+    if (startPubKeySpecified)
+      p[i] = secp->AddDirect(p[i], startPubKey);
+  }
+
+}
+
+void VanitySearch::getGPUStartingTable(int groupSize, int nbThread, Int *keys, vector<Point> &table) {
+
+  // Rekey: thread i starts at base + (i << SHARD_THREAD_SHIFT) from a random base,
+  // the GPU computes the starting points from table[0] = base*G and
+  // table[k+1] = 2^k*(stride*G), only a few scalar multiplications on the host
+  Int base;
+  Int stride;
+  base.Rand(&secp->order);
+  stride.SetInt32(1);
+  stride.ShiftL(SHARD_THREAD_SHIFT);
+
+  Int k(&base);
+  for (int i = 0; i < nbThread; i++) {
+    keys[i].Set(&k);
+    k.Add(&stride);
+  }
+
+  // Starting key is at the middle of the group
+  k.Set(&base);
+  k.Add((uint64_t)(groupSize / 2));
+  table.clear();
+  table.push_back(secp->ComputePublicKey(&k));
+  if (startPubKeySpecified)
+    table[0] = secp->AddDirect(table[0], startPubKey);
+
+  Point s = secp->ComputePublicKey(&stride);
+  for (int b = 0; (1ULL << b) < (uint64_t)nbThread; b++) {
+    table.push_back(s);
+    s = secp->DoubleDirect(s);
+  }
+
+}
+
+#ifdef WITHGPU
+void VanitySearch::setGPUPrefix(GPUDevice *g) {
+
+  if (hasPatternMask) {
+    // Number of masks followed by (mask, value) items
+    vector<uint32_t> table(1, (uint32_t)patternMask.size());
+    for (int i = 0; i < (int)patternMask.size(); i++) {
+      table.insert(table.end(), patternMask[i].mask, patternMask[i].mask + 5);
+      table.insert(table.end(), patternMask[i].value, patternMask[i].value + 5);
+    }
+    g->SetBech32Mask(table);
+    return;
+  }
+
+  if (hasPattern && !onlyFull) {
+    g->SetPattern(patternTable);
+    return;
+  }
+
+  if (!onlyFull && nbPrefixRange == 0) {
+    g->SetPrefix(usedPrefix);
+    if (hasDFA)
+      g->SetFoldPattern(patternTable);
+    return;
+  }
+
+  // The lookup tables are built once by the first GPU thread,
+  // all the devices upload the same pinned host copy
+  lock();
+  if (gpuPrefixTable == NULL) {
+    gpuPrefixTable = new GPUPrefixTable(gpuBackend);
+    bool ok;
+    if (onlyFull)
+      ok = gpuPrefixTable->Build(usedPrefixL, nbPrefix, usedBloomKey);
+    else
+      ok = gpuPrefixTable->Build(usedPrefixR, nbPrefixRange);
+    if (!ok) {
+      printf("Failed to build the GPU prefix table\n");
+      exit(-1);
+    }
+    // Not needed on the host anymore
+    vector<LPREFIX>().swap(usedPrefixL);
+    vector<RPREFIX>().swap(usedPrefixR);
+    vector<uint64_t>().swap(usedBloomKey);
+  }
+  unlock();
+
+  g->SetPrefix(gpuPrefixTable);
+
+  // Case unsensitive prefixes, the device compares the addresses case folded
+  if (hasDFA)
+    g->SetFoldPattern(patternTable);
+
+}
+
+void VanitySearch::updateGPUPrefix(GPUDevice *g) {
+
+  // Remove prefixes whose items are all found from the GPU lookup table
+  vector<prefix_t> done;
+  for (int i = 0; i < (int)usedPrefix.size(); i++)
+    if (isPrefixDone(usedPrefix[i]))
+      done.push_back(usedPrefix[i]);
+  g->DisablePrefix(done);
+
+}
+#endif
+
+void VanitySearch::FindKeyGPU(TH_PARAM *ph) {
+
+#ifdef WITHGPU
+
+  bool ok = true;
+
+  // Global init
+  int thId = ph->threadId;
+  if (useScheduler && !Timer::SetAffinity(thId - 0x80))
+    printf("Warning, cannot pin GPU thread %d to core %d\n", thId - 0x80, (thId - 0x80) % Timer::getCoreNumber());
+  GPUDevice *g = GPUDevice::Acquire(gpuBackend, ph->gridSizeX, ph->gridSizeY, ph->gpuId, maxFound, (rekey!=0));
+  if (g == NULL) {
+    ph->hasStarted = true;
+    notifyMonitor(ph);
+    return;
+  }
+  int nbThread = g->GetNbThread();
+  Point *p = new Point[nbThread];
+  Int *keys = new Int[nbThread];
+  vector<ITEM> found;
+
+  printf("GPU: %s\n",g->deviceName.c_str());
+
+  stats[thId].counter = 0;
+  devMetrics[thId].gpuId = ph->gpuId;
+
+  g->SetSearchMode(searchMode);
+  g->SetSearchType(getGPUSearchType());
+  g->SetUncompressedKeyHash((searchTypes & TYPE_MASK(P2PKH)) != 0);
+  setGPUPrefix(g);
+
+  vector<Point> keyTable;
+  if (rekey > 0) {
+    getGPUStartingTable(g->GetGroupSize(), nbThread, keys, keyTable);
+    ok = g->SetKeys(keyTable);
+  } else {
+    getGPUStartingKeys(thId, g->GetGroupSize(), nbThread, keys, p);
+    ok = g->SetKeys(p);
+  }
+  ph->rekeyRequest = false;
+  uint32_t gpuPrefixVersion = 0;
+
+  PROF_THREAD(thId);
+  ph->hasStarted = true;
+
+  // GPU Thread
+  while (ok && !endOfSearch) {
+
+    // New keys once the kernels queued with the previous ones are drained
+    bool drain = ph->rekeyRequest;
+    if (drain && g->GetNbPending() == 0) {
+      getGPUStartingTable(g->GetGroupSize(), nbThread, keys, keyTable);
+      ok = g->SetKeys(keyTable);
+      ph->rekeyRequest = false;
+      drain = false;
+    }
 
-  // Endomorphism #1
-  pte1[0].x.ModMulK1(&p1.x, &beta);
-  pte1[0].y.Set(&p1.y);
+    // Call kernel
+    double t0 = Timer::get_tick();
+    PROF_START(PROF_GPU_LAUNCH);
+    if (drain)
+      ok = g->Drain(found);
+    else
+      ok = g->Launch(found);
+    PROF_STOP(PROF_GPU_LAUNCH);
+    devMetrics[thId].waitTime += Timer::get_tick() - t0;
+    devMetrics[thId].nbLaunch++;
+    devMetrics[thId].nbLost = g->GetLostCount();
+
+    t0 = Timer::get_tick();
+    PROF_START(PROF_GPU_HOST);
+    PROF_RANGE_PUSH("Host");
+    for(int i=0;i<(int)found.size() && !endOfSearch;i++) {
 
-  secp->GetHash160(searchType, compressed, pte1[0], h0);
+      ITEM it = found[i];
+      pushFound(*(prefix_t *)(it.hash), it.hash, keys[it.thId], it.incr, it.endo, it.mode, it.type);
 
-  pr0 = *(prefix_t *)h0;
-  if (hasPattern || prefixes[pr0].items)
-    checkAddr(pr0, h0, key, i, 1, compressed);
+    }
 
-  // Endomorphism #2
-  pte2[0].x.ModMulK1(&p1.x, &beta2);
-  pte2[0].y.Set(&p1.y);
+    // Prefixes have reached their quota (-stop, -quota)
+    if (stopWhenFound && !hasPattern && gpuPrefixVersion != prefixVersion) {
+      gpuPrefixVersion = prefixVersion;
+      updateGPUPrefix(g);
+    }
 
-  secp->GetHash160(searchType, compressed, pte2[0], h0);
+    // Items skipped at the end of the search, the step is not counted
+    if (ok && !endOfSearch) {
+      for (int i = 0; i < nbThread; i++) {
+        keys[i].Add((uint64_t)STEP_SIZE);
+      }
+      stats[thId].offset += STEP_SIZE;
+      stats[thId].counter += 6ULL * STEP_SIZE * nbThread; // Point +  endo1 + endo2 + symetrics
+    }
+    PROF_RANGE_POP();
+    PROF_STOP(PROF_GPU_HOST);
+    devMetrics[thId].hostTime += Timer::get_tick() - t0;
 
-  pr0 = *(prefix_t *)h0;
-  if (hasPattern || prefixes[pr0].items)
-    checkAddr(pr0, h0, key, i, 2, compressed);
+  }
 
-  // Curve symetrie
-  // if (x,y) = k*G, then (x, -y) is -k*G
-  p1.y.ModNeg();
-  secp->GetHash160(searchType, compressed, p1, h0);
-  pr0 = *(prefix_t *)h0;
-  if (hasPattern || prefixes[pr0].items)
-    checkAddr(pr0, h0, key, -i, 0, compressed);
+  delete[] keys;
+  delete[] p;
+  GPUDevice::Release(g);
 
-  // Endomorphism #1
-  pte1[0].y.ModNeg();
+#else
+  ph->hasStarted = true;
+  printf("GPU code not compiled, use -DWITHGPU when compiling.\n");
+#endif
 
-  secp->GetHash160(searchType, compressed, pte1[0], h0);
+  notifyMonitor(ph);
 
-  pr0 = *(prefix_t *)h0;
-  if (hasPattern || prefixes[pr0].items)
-    checkAddr(pr0, h0, key, -i, 1, compressed);
+}
 
-  // Endomorphism #2
-  pte2[0].y.ModNeg();
+// ----------------------------------------------------------------------------
 
-  secp->GetHash160(searchType, compressed, pte2[0], h0);
+static void joinThread(TH_PARAM *p) {
 
-  pr0 = *(prefix_t *)h0;
-  if (hasPattern || prefixes[pr0].items)
-    checkAddr(pr0, h0, key, -i, 2, compressed);
+#ifdef WIN64
+  WaitForSingleObject(p->thread, INFINITE);
+  CloseHandle(p->thread);
+#else
+  pthread_join(p->thread, NULL);
+#endif
 
 }
 
 // ----------------------------------------------------------------------------
 
-void VanitySearch::checkAddressesSSE(bool compressed,Int key, int i, Point p1, Point p2, Point p3, Point p4) {
+bool VanitySearch::isAlive(TH_PARAM *p) {
 
-  unsigned char h0[20];
-  unsigned char h1[20];
-  unsigned char h2[20];
-  unsigned char h3[20];
-  Point pte1[4];
-  Point pte2[4];
-  prefix_t pr0;
-  prefix_t pr1;
-  prefix_t pr2;
-  prefix_t pr3;
+  bool isAlive = true;
+  int total = nbCPUThread + nbGPUThread;
+  for(int i=0;i<total;i++)
+    isAlive = isAlive && p[i].isRunning;
 
-  // Point -------------------------------------------------------------------------
-  secp->GetHash160(searchType, compressed, p1, p2, p3, p4, h0, h1, h2, h3);
+  return isAlive;
 
-  if (!hasPattern) {
+}
 
-    pr0 = *(prefix_t *)h0;
-    pr1 = *(prefix_t *)h1;
-    pr2 = *(prefix_t *)h2;
-    pr3 = *(prefix_t *)h3;
+// ----------------------------------------------------------------------------
 
-    if (prefixes[pr0].items)
-      checkAddr(pr0, h0, key, i, 0, compressed);
-    if (prefixes[pr1].items)
-      checkAddr(pr1, h1, key, i + 1, 0, compressed);
-    if (prefixes[pr2].items)
-      checkAddr(pr2, h2, key, i + 2, 0, compressed);
-    if (prefixes[pr3].items)
-      checkAddr(pr3, h3, key, i + 3, 0, compressed);
+bool VanitySearch::hasStarted(TH_PARAM *p) {
 
-  } else {
+  bool hasStarted = true;
+  int total = nbCPUThread + nbGPUThread;
+  for (int i = 0; i < total; i++)
+    hasStarted = hasStarted && p[i].hasStarted;
 
-    checkAddrSSE(h0,h1,h2,h3,i,i+1,i+2,i+3,key,0,compressed);
+  return hasStarted;
 
-  }
+}
 
-  // Endomorphism #1
-  // if (x, y) = k * G, then (beta*x, y) = lambda*k*G
-  pte1[0].x.ModMulK1(&p1.x, &beta);
-  pte1[0].y.Set(&p1.y);
-  pte1[1].x.ModMulK1(&p2.x, &beta);
-  pte1[1].y.Set(&p2.y);
-  pte1[2].x.ModMulK1(&p3.x, &beta);
-  pte1[2].y.Set(&p3.y);
-  pte1[3].x.ModMulK1(&p4.x, &beta);
-  pte1[3].y.Set(&p4.y);
+// ----------------------------------------------------------------------------
 
-  secp->GetHash160(searchType, compressed, pte1[0], pte1[1], pte1[2], pte1[3], h0, h1, h2, h3);
+void VanitySearch::rekeyRequest(TH_PARAM *p) {
 
-  if (!hasPattern) {
+  int total = nbCPUThread + nbGPUThread;
+  for (int i = 0; i < total; i++)
+  p[i].rekeyRequest = true;
 
-    pr0 = *(prefix_t *)h0;
-    pr1 = *(prefix_t *)h1;
-    pr2 = *(prefix_t *)h2;
-    pr3 = *(prefix_t *)h3;
+}
 
-    if (prefixes[pr0].items)
-      checkAddr(pr0, h0, key, i, 1, compressed);
-    if (prefixes[pr1].items)
-      checkAddr(pr1, h1, key, (i + 1), 1, compressed);
-    if (prefixes[pr2].items)
-      checkAddr(pr2, h2, key, (i + 2), 1, compressed);
-    if (prefixes[pr3].items)
-      checkAddr(pr3, h3, key, (i + 3), 1, compressed);
+// ----------------------------------------------------------------------------
 
-  } else {
+void VanitySearch::scheduleCPU(TH_PARAM *p, double keyRate) {
 
-    checkAddrSSE(h0, h1, h2, h3, i, i + 1, i + 2, i + 3, key, 1, compressed);
+  // Hill climbing on the total (CPU+GPU) key rate, park or unpark one CPU thread
+  // at a time, at most one per GPU (host cores left to the GPU feeders)
+  int maxParked = (nbGPUThread < nbCPUThread) ? nbGPUThread : nbCPUThread;
 
+  // Host share of the GPU feeder loops (result handling vs launch wait) since the last call
+  double hostTime = 0.0;
+  double loopTime = 0.0;
+  for (int i = 0; i < nbGPUThread; i++) {
+    hostTime += devMetrics[0x80 + i].hostTime;
+    loopTime += devMetrics[0x80 + i].hostTime + devMetrics[0x80 + i].waitTime;
   }
+  double hostShare = (loopTime > schedLoopTime) ? (hostTime - schedHostTime) / (loopTime - schedLoopTime) : 0.0;
+  schedHostTime = hostTime;
+  schedLoopTime = loopTime;
 
-  // Endomorphism #2
-  // if (x, y) = k * G, then (beta2*x, y) = lambda2*k*G
-  pte2[0].x.ModMulK1(&p1.x, &beta2);
-  pte2[0].y.Set(&p1.y);
-  pte2[1].x.ModMulK1(&p2.x, &beta2);
-  pte2[1].y.Set(&p2.y);
-  pte2[2].x.ModMulK1(&p3.x, &beta2);
-  pte2[2].y.Set(&p3.y);
-  pte2[3].x.ModMulK1(&p4.x, &beta2);
-  pte2[3].y.Set(&p4.y);
-
-  secp->GetHash160(searchType, compressed, pte2[0], pte2[1], pte2[2], pte2[3], h0, h1, h2, h3);
-
-  if (!hasPattern) {
+  if (schedWait > 0) {
+    schedWait--;
+    return;
+  }
 
-    pr0 = *(prefix_t *)h0;
-    pr1 = *(prefix_t *)h1;
-    pr2 = *(prefix_t *)h2;
-    pr3 = *(prefix_t *)h3;
+  if (schedLastRate > 0.0 && keyRate < schedLastRate * 0.995) {
 
-    if (prefixes[pr0].items)
-      checkAddr(pr0, h0, key, i, 2, compressed);
-    if (prefixes[pr1].items)
-      checkAddr(pr1, h1, key, (i + 1), 2, compressed);
-    if (prefixes[pr2].items)
-      checkAddr(pr2, h2, key, (i + 2), 2, compressed);
-    if (prefixes[pr3].items)
-      checkAddr(pr3, h3, key, (i + 3), 2, compressed);
+    // The last change lowered the key rate, revert it
+    nbParked -= schedDir;
+    schedDir = -schedDir;
+    schedLastRate = 0.0;
+    schedWait = SCHED_HOLD;
 
   } else {
 
-    checkAddrSSE(h0, h1, h2, h3, i, i + 1, i + 2, i + 3, key, 2, compressed);
-
-  }
+    // Feeders waiting for the device, no more parking
+    if (schedDir > 0 && hostShare < SCHED_HOST_SHARE) {
+      if (nbParked == 0)
+        return;
+      schedDir = -1;
+    }
 
-  // Curve symetrie -------------------------------------------------------------------------
-  // if (x,y) = k*G, then (x, -y) is -k*G
+    int n = nbParked + schedDir;
+    if (n < 0 || n > maxParked) {
+      schedDir = -schedDir;
+      n = nbParked + schedDir;
+    }
+    if (n < 0 || n > maxParked)
+      return;
+    nbParked = n;
+    schedLastRate = keyRate;
+    schedWait = SCHED_SETTLE;
 
-  p1.y.ModNeg();
-  p2.y.ModNeg();
-  p3.y.ModNeg();
-  p4.y.ModNeg();
+  }
 
-  secp->GetHash160(searchType, compressed, p1, p2, p3, p4, h0, h1, h2, h3);
+  // Park the last CPU threads
+  for (int i = 0; i < nbCPUThread; i++)
+    p[i].isParked = (i >= nbCPUThread - nbParked);
 
-  if (!hasPattern) {
+}
 
-    pr0 = *(prefix_t *)h0;
-    pr1 = *(prefix_t *)h1;
-    pr2 = *(prefix_t *)h2;
-    pr3 = *(prefix_t *)h3;
+// ----------------------------------------------------------------------------
 
-    if (prefixes[pr0].items)
-      checkAddr(pr0, h0, key, -i, 0, compressed);
-    if (prefixes[pr1].items)
-      checkAddr(pr1, h1, key, -(i + 1), 0, compressed);
-    if (prefixes[pr2].items)
-      checkAddr(pr2, h2, key, -(i + 2), 0, compressed);
-    if (prefixes[pr3].items)
-      checkAddr(pr3, h3, key, -(i + 3), 0, compressed);
+uint64_t VanitySearch::getGPUCount() {
 
-  } else {
+  uint64_t count = 0;
+  for(int i=0;i<nbGPUThread;i++)
+    count += stats[0x80L+i].counter;
+  return count;
 
-    checkAddrSSE(h0, h1, h2, h3, -i, -(i + 1), -(i + 2), -(i + 3), key, 0, compressed);
+}
 
-  }
+uint64_t VanitySearch::getCPUCount() {
 
-  // Endomorphism #1
-  // if (x, y) = k * G, then (beta*x, y) = lambda*k*G
-  pte1[0].y.ModNeg();
-  pte1[1].y.ModNeg();
-  pte1[2].y.ModNeg();
-  pte1[3].y.ModNeg();
+  uint64_t count = 0;
+  for(int i=0;i<nbCPUThread;i++)
+    count += stats[i].counter;
+  return count;
 
+}
 
-  secp->GetHash160(searchType, compressed, pte1[0], pte1[1], pte1[2], pte1[3], h0, h1, h2, h3);
+// ----------------------------------------------------------------------------
 
-  if (!hasPattern) {
+bool VanitySearch::isInputFound(int i) {
+  return isFound((uint32_t)i);
+}
 
-    pr0 = *(prefix_t *)h0;
-    pr1 = *(prefix_t *)h1;
-    pr2 = *(prefix_t *)h2;
-    pr3 = *(prefix_t *)h3;
+void VanitySearch::setInputFound(int i) {
 
-    if (prefixes[pr0].items)
-      checkAddr(pr0, h0, key, -i, 1, compressed);
-    if (prefixes[pr1].items)
-      checkAddr(pr1, h1, key, -(i + 1), 1, compressed);
-    if (prefixes[pr2].items)
-      checkAddr(pr2, h2, key, -(i + 2), 1, compressed);
-    if (prefixes[pr3].items)
-      checkAddr(pr3, h3, key, -(i + 3), 1, compressed);
+  uint32_t n = (quota == 0) ? 1 : quota;
+  if (inputCount[i] < n) inputCount[i] = n;
+  setFound((uint32_t)i);
 
-  } else {
+}
 
-    checkAddrSSE(h0, h1, h2, h3, -i, -(i + 1), -(i + 2), -(i + 3), key, 1, compressed);
+uint64_t VanitySearch::getPrefixHash() {
 
+  // FNV-1a
+  uint64_t h = 0xCBF29CE484222325ULL;
+  for (int i = 0; i < (int)inputPrefixes.size(); i++) {
+    const char *p = inputPrefixes[i].c_str();
+    for (int j = 0; j <= (int)inputPrefixes[i].length(); j++) {
+      h ^= (uint8_t)p[j];
+      h *= 0x100000001B3ULL;
+    }
   }
+  return h;
 
-  // Endomorphism #2
-  // if (x, y) = k * G, then (beta2*x, y) = lambda2*k*G
-  pte2[0].y.ModNeg();
-  pte2[1].y.ModNeg();
-  pte2[2].y.ModNeg();
-  pte2[3].y.ModNeg();
-
-  secp->GetHash160(searchType, compressed, pte2[0], pte2[1], pte2[2], pte2[3], h0, h1, h2, h3);
-
-  if (!hasPattern) {
-
-    pr0 = *(prefix_t *)h0;
-    pr1 = *(prefix_t *)h1;
-    pr2 = *(prefix_t *)h2;
-    pr3 = *(prefix_t *)h3;
-
-    if (prefixes[pr0].items)
-      checkAddr(pr0, h0, key, -i, 2, compressed);
-    if (prefixes[pr1].items)
-      checkAddr(pr1, h1, key, -(i + 1), 2, compressed);
-    if (prefixes[pr2].items)
-      checkAddr(pr2, h2, key, -(i + 2), 2, compressed);
-    if (prefixes[pr3].items)
-      checkAddr(pr3, h3, key, -(i + 3), 2, compressed);
+}
 
-  } else {
+void VanitySearch::SetCheckpoint(std::string fileName, int delay) {
 
-    checkAddrSSE(h0, h1, h2, h3, -i, -(i + 1), -(i + 2), -(i + 3), key, 2, compressed);
+  checkpointFile = fileName;
+  checkpointDelay = delay;
 
+  if (loadCheckpoint()) {
+    printf("Resuming from %s: Total 2^%.2f, Found %d\n", checkpointFile.c_str(), log2((double)resumeCount), nbFoundKey.load());
+    printf("Base Key: %s\n", startKey.GetBase16().c_str());
   }
 
 }
 
-// ----------------------------------------------------------------------------
-void VanitySearch::getCPUStartingKey(int thId,Int& key,Point& startP) {
+// The start public key (-sp) of a checkpoint, zero when not specified
+static void getStartPubKey(Point &p, bool specified, uint8_t *buff) {
 
-  if (rekey > 0) {
-    key.Rand(256);
-  } else {
-    key.Set(&startKey);
-    Int off((int64_t)thId);
-    off.ShiftL(64);
-    key.Add(&off);
+  memset(buff, 0, 64);
+  if (specified) {
+    p.x.Get32Bytes(buff);
+    p.y.Get32Bytes(buff + 32);
   }
-  Int km(&key);
-  km.Add((uint64_t)CPU_GRP_SIZE / 2);
-  startP = secp->ComputePublicKey(&km);
-  if(startPubKeySpecified)
-   startP = secp->AddDirect(startP,startPubKey);
 
 }
 
-void VanitySearch::FindKeyCPU(TH_PARAM *ph) {
-
-  // Global init
-  int thId = ph->threadId;
-  counters[thId] = 0;
-
-  // CPU Thread
-  IntGroup *grp = new IntGroup(CPU_GRP_SIZE/2+1);
-
-  // Group Init
-  Int  key;
-  Point startP;
-  getCPUStartingKey(thId,key,startP);
-
-  Int dx[CPU_GRP_SIZE/2+1];
-  Point pts[CPU_GRP_SIZE];
-
-  Int dy;
-  Int dyn;
-  Int _s;
-  Int _p;
-  Point pp;
-  Point pn;
-  grp->Set(dx);
-
-  ph->hasStarted = true;
-  ph->rekeyRequest = false;
-
-  while (!endOfSearch) {
+bool VanitySearch::loadCheckpoint() {
 
-    if (ph->rekeyRequest) {
-      getCPUStartingKey(thId, key, startP);
-      ph->rekeyRequest = false;
-    }
+  FILE *f = fopen(checkpointFile.c_str(), "rb");
+  if (f == NULL)
+    return false;
 
-    // Fill group
-    int i;
-    int hLength = (CPU_GRP_SIZE / 2 - 1);
+  // A file which cannot be resumed is kept as is, the search starts from
+  // scratch without checkpoint
+  CHECKPOINT_HEADER h;
+  uint8_t pubKey[64];
+  getStartPubKey(startPubKey, startPubKeySpecified, pubKey);
+  const char *error = NULL;
+  if (fread(&h, sizeof(h), 1, f) != 1 || h.magic != CHECKPOINT_MAGIC || h.version != CHECKPOINT_VERSION) {
+    error = "invalid file";
+  } else if (h.nbInput != (uint32_t)inputPrefixes.size() || h.prefixHash != getPrefixHash() ||
+             h.searchMode != searchMode || h.searchTypes != (int32_t)searchTypes) {
+    error = "prefixes or mode differ";
+  } else if (memcmp(h.startPubKey, pubKey, 64) != 0) {
+    error = "start public key (-sp) differs";
+  }
 
-    for (i = 0; i < hLength; i++) {
-      dx[i].ModSub(&Gn[i].x, &startP.x);
+  std::vector<uint32_t> thIds;
+  std::vector<uint64_t> offsets;
+  for (uint32_t i = 0; error == NULL && i < h.nbOffset; i++) {
+    uint32_t thId;
+    uint64_t offset;
+    if (fread(&thId, 4, 1, f) != 1 || fread(&offset, 8, 1, f) != 1 || thId > 255) {
+      error = "truncated file";
+    } else {
+      thIds.push_back(thId);
+      offsets.push_back(offset);
     }
-    dx[i].ModSub(&Gn[i].x, &startP.x);  // For the first point
-    dx[i+1].ModSub(&_2Gn.x, &startP.x); // For the next center point
-
-    // Grouped ModInv
-    grp->ModInv();
-
-    // We use the fact that P + i*G and P - i*G has the same deltax, so the same inverse
-    // We compute key in the positive and negative way from the center of the group
+  }
 
-    // center point
-    pts[CPU_GRP_SIZE/2] = startP;
+  std::vector<uint32_t> hits;
+  if (error == NULL) {
+    hits.resize(h.nbInput);
+    if (h.nbInput > 0 && fread(hits.data(), 4, h.nbInput, f) != h.nbInput)
+      error = "truncated file";
+  }
+  fclose(f);
 
-    for (i = 0; i<hLength && !endOfSearch; i++) {
+  if (error) {
+    printf("Warning, cannot resume from %s (%s), it is left untouched and no checkpoint is saved\n",
+      checkpointFile.c_str(), error);
+    checkpointFile = "";
+    checkpointDelay = 0;
+    return false;
+  }
 
-      pp = startP;
-      pn = startP;
+  for (size_t i = 0; i < thIds.size(); i++)
+    stats[thIds[i]].offset = offsets[i];
 
-      // P = startP + i*G
-      dy.ModSub(&Gn[i].y,&pp.y);
+  for (uint32_t i = 0; i < h.nbInput; i++) {
+    if (hits[i]) {
+      inputCount[i] = hits[i];
+      if ((quota == 0) || (hits[i] >= quota))
+        setFound(i);
+    }
+  }
+  updateFound();
 
-      _s.ModMulK1(&dy, &dx[i]);       // s = (p2.y-p1.y)*inverse(p2.x-p1.x);
-      _p.ModSquareK1(&_s);            // _p = pow2(s)
+  // With rekey, the base key is random and offsets are not used
+  if (rekey == 0)
+    startKey.Set32Bytes(h.baseKey);
+  resumeCount = h.count;
+  nbFoundKey = h.nbFound;
+  return true;
 
-      pp.x.ModNeg();
-      pp.x.ModAdd(&_p);
-      pp.x.ModSub(&Gn[i].x);           // rx = pow2(s) - p1.x - p2.x;
+}
 
-      pp.y.ModSub(&Gn[i].x, &pp.x);
-      pp.y.ModMulK1(&_s);
-      pp.y.ModSub(&Gn[i].y);           // ry = - p2.y - s*(ret.x-p2.x);
+void VanitySearch::saveCheckpoint(uint64_t count) {
+
+  // Offsets first, then wait until the candidates they cover, still in the
+  // verify queue, are verified and their keys written
+  uint64_t offsets[256];
+  for (int i = 0; i < 256; i++)
+    offsets[i] = stats[i].offset;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  uint64_t queued = nbQueued.load();
+  while (nbVerifyThread > 0 && nbVerified.load() < queued)
+    Timer::SleepMillis(1);
+  resultWriter->Flush();
+
+  CHECKPOINT_HEADER h;
+  memset(&h, 0, sizeof(h));
+  h.magic = CHECKPOINT_MAGIC;
+  h.version = CHECKPOINT_VERSION;
+  startKey.Get32Bytes(h.baseKey);
+  h.count = count;
+  h.prefixHash = getPrefixHash();
+  h.nbInput = (uint32_t)inputPrefixes.size();
+  h.nbFound = nbFoundKey;
+  h.searchMode = searchMode;
+  h.searchTypes = (int32_t)searchTypes;
+  getStartPubKey(startPubKey, startPubKeySpecified, h.startPubKey);
+  for (int i = 0; i < 256; i++)
+    if (offsets[i]) h.nbOffset++;
+
+  // Write a temporary file first, a crash while writing keeps the previous checkpoint
+  string tmpFile = checkpointFile + ".tmp";
+  FILE *f = fopen(tmpFile.c_str(), "wb");
+  if (f == NULL) {
+    printf("\nCannot open %s for writing\n", tmpFile.c_str());
+    return;
+  }
 
-      // P = startP - i*G  , if (x,y) = i*G then (x,-y) = -i*G
-      dyn.Set(&Gn[i].y);
-      dyn.ModNeg();
-      dyn.ModSub(&pn.y);
+  bool ok = fwrite(&h, sizeof(h), 1, f) == 1;
+  for (uint32_t i = 0; i < 256; i++) {
+    if (offsets[i]) {
+      ok &= fwrite(&i, 4, 1, f) == 1;
+      ok &= fwrite(&offsets[i], 8, 1, f) == 1;
+    }
+  }
+  for (uint32_t i = 0; i < h.nbInput; i++) {
+    uint32_t hits = inputCount[i].load();
+    ok &= fwrite(&hits, 4, 1, f) == 1;
+  }
+  ok &= fclose(f) == 0;
 
-      _s.ModMulK1(&dyn, &dx[i]);      // s = (p2.y-p1.y)*inverse(p2.x-p1.x);
-      _p.ModSquareK1(&_s);            // _p = pow2(s)
+  if (!ok) {
+    printf("\nError while writing %s\n", tmpFile.c_str());
+    return;
+  }
 
-      pn.x.ModNeg();
-      pn.x.ModAdd(&_p);
-      pn.x.ModSub(&Gn[i].x);          // rx = pow2(s) - p1.x - p2.x;
+#ifdef WIN64
+  remove(checkpointFile.c_str());
+#endif
+  if (rename(tmpFile.c_str(), checkpointFile.c_str()) != 0)
+    printf("\nCannot rename %s to %s\n", tmpFile.c_str(), checkpointFile.c_str());
 
-      pn.y.ModSub(&Gn[i].x, &pn.x);
-      pn.y.ModMulK1(&_s);
-      pn.y.ModAdd(&Gn[i].y);          // ry = - p2.y - s*(ret.x-p2.x);
+}
 
-      pts[CPU_GRP_SIZE/2 + (i+1)] = pp;
-      pts[CPU_GRP_SIZE/2 - (i+1)] = pn;
+// ----------------------------------------------------------------------------
+// Metrics export
+//
+// A file ending with .prom is rewritten in the Prometheus text format (to be
+// collected by the node_exporter textfile collector), otherwise one JSON
+// object is appended per report.
+// ----------------------------------------------------------------------------
 
-    }
+void VanitySearch::SetMetrics(std::string fileName) {
 
-    // First point (startP - (GRP_SZIE/2)*G)
-    pn = startP;
-    dyn.Set(&Gn[i].y);
-    dyn.ModNeg();
-    dyn.ModSub(&pn.y);
+  metricsFile = fileName;
 
-    _s.ModMulK1(&dyn, &dx[i]);
-    _p.ModSquareK1(&_s);
+}
 
-    pn.x.ModNeg();
-    pn.x.ModAdd(&_p);
-    pn.x.ModSub(&Gn[i].x);
+void VanitySearch::saveMetrics(uint64_t count, double t) {
 
-    pn.y.ModSub(&Gn[i].x, &pn.x);
-    pn.y.ModMulK1(&_s);
-    pn.y.ModAdd(&Gn[i].y);
+  char tmp[256];
+  string out;
+  double dt = t - lastMetricsTime;
+  bool prom = metricsFile.length() > 5 && metricsFile.substr(metricsFile.length() - 5) == ".prom";
 
-    pts[0] = pn;
+  // Hits which do not lead to a key are prefix table (or bloom filter) false positives
+  // (not reported with patterns, their hits are not prefix table lookups)
+  uint64_t hit = nbHit.load(std::memory_order_relaxed);
+  uint64_t confirmed = (uint64_t)(nbFoundKey - startFoundKey);
+  if (confirmed > hit) confirmed = hit;
+  double fpRate = (hit > 0) ? (double)(hit - confirmed) / (double)hit : 0.0;
 
-    // Next start point (startP + GRP_SIZE*G)
-    pp = startP;
-    dy.ModSub(&_2Gn.y, &pp.y);
+  double vTime = 0.0;
+  for (int i = 0; i < NB_VERIFY_THREAD; i++)
+    vTime += verifyTime[i];
 
-    _s.ModMulK1(&dy, &dx[i+1]);
-    _p.ModSquareK1(&_s);
+  uint64_t lost = 0;
+  for (int i = 0; i < nbGPUThread; i++)
+    lost += devMetrics[0x80L + i].nbLost;
 
-    pp.x.ModNeg();
-    pp.x.ModAdd(&_p);
-    pp.x.ModSub(&_2Gn.x);
+  if (prom) {
 
-    pp.y.ModSub(&_2Gn.x, &pp.x);
-    pp.y.ModMulK1(&_s);
-    pp.y.ModSub(&_2Gn.y);
-    startP = pp;
+    sprintf(tmp, "# TYPE vanitysearch_keys_total counter\nvanitysearch_keys_total %llu\n", (unsigned long long)count);
+    out.append(tmp);
+    out.append("# TYPE vanitysearch_key_rate gauge\n");
+    for (int i = 0; i < nbCPUThread; i++) {
+      sprintf(tmp, "vanitysearch_key_rate{device=\"cpu\",thread=\"%d\"} %.0f\n", i, (double)(stats[i].counter - lastCounters[i]) / dt);
+      out.append(tmp);
+    }
+    for (int i = 0; i < nbGPUThread; i++) {
+      int thId = 0x80 + i;
+      sprintf(tmp, "vanitysearch_key_rate{device=\"gpu\",gpu=\"%d\"} %.0f\n", devMetrics[thId].gpuId, (double)(stats[thId].counter - lastCounters[thId]) / dt);
+      out.append(tmp);
+    }
+    out.append("# TYPE vanitysearch_gpu_launches_total counter\n");
+    for (int i = 0; i < nbGPUThread; i++) {
+      DEVICE_METRICS *m = devMetrics + (0x80 + i);
+      sprintf(tmp, "vanitysearch_gpu_launches_total{gpu=\"%d\"} %llu\n", m->gpuId, (unsigned long long)m->nbLaunch);
+      out.append(tmp);
+    }
+    out.append("# TYPE vanitysearch_gpu_launch_wait_seconds_total counter\n");
+    for (int i = 0; i < nbGPUThread; i++) {
+      DEVICE_METRICS *m = devMetrics + (0x80 + i);
+      sprintf(tmp, "vanitysearch_gpu_launch_wait_seconds_total{gpu=\"%d\"} %.6f\n", m->gpuId, m->waitTime);
+      out.append(tmp);
+    }
+    out.append("# TYPE vanitysearch_gpu_host_seconds_total counter\n");
+    for (int i = 0; i < nbGPUThread; i++) {
+      DEVICE_METRICS *m = devMetrics + (0x80 + i);
+      sprintf(tmp, "vanitysearch_gpu_host_seconds_total{gpu=\"%d\"} %.6f\n", m->gpuId, m->hostTime);
+      out.append(tmp);
+    }
+    sprintf(tmp, "# TYPE vanitysearch_cpu_parked_threads gauge\nvanitysearch_cpu_parked_threads %d\n", nbParked);
+    out.append(tmp);
+    out.append("# TYPE vanitysearch_gpu_lost_items_total counter\n");
+    for (int i = 0; i < nbGPUThread; i++) {
+      DEVICE_METRICS *m = devMetrics + (0x80 + i);
+      sprintf(tmp, "vanitysearch_gpu_lost_items_total{gpu=\"%d\"} %llu\n", m->gpuId, (unsigned long long)m->nbLost);
+      out.append(tmp);
+    }
+    sprintf(tmp, "# TYPE vanitysearch_prefix_hits_total counter\nvanitysearch_prefix_hits_total %llu\n", (unsigned long long)hit);
+    out.append(tmp);
+    sprintf(tmp, "# TYPE vanitysearch_found_total counter\nvanitysearch_found_total %d\n", nbFoundKey.load());
+    out.append(tmp);
+    if (!hasPattern) {
+      sprintf(tmp, "# TYPE vanitysearch_false_positive_ratio gauge\nvanitysearch_false_positive_ratio %.6f\n", fpRate);
+      out.append(tmp);
+    }
+    sprintf(tmp, "# TYPE vanitysearch_verify_seconds_total counter\nvanitysearch_verify_seconds_total %.6f\n", vTime);
+    out.append(tmp);
 
-#if 0
-    // Check
-    {
-      bool wrong = false;
-      Point p0 = secp.ComputePublicKey(&key);
-      for (int i = 0; i < CPU_GRP_SIZE; i++) {
-        if (!p0.equals(pts[i])) {
-          wrong = true;
-          printf("[%d] wrong point\n",i);
-        }
-        p0 = secp.NextKey(p0);
-      }
-      if(wrong) exit(0);
+    string tmpFile = metricsFile + ".tmp";
+    FILE *f = fopen(tmpFile.c_str(), "w");
+    if (f == NULL) {
+      printf("\nCannot open %s for writing\n", tmpFile.c_str());
+      metricsFile = "";
+      return;
     }
+    fputs(out.c_str(), f);
+    fclose(f);
+#ifdef WIN64
+    remove(metricsFile.c_str());
 #endif
+    if (rename(tmpFile.c_str(), metricsFile.c_str()) != 0)
+      printf("\nCannot rename %s to %s\n", tmpFile.c_str(), metricsFile.c_str());
 
-    // Check addresses
-    if (useSSE) {
-
-      for (int i = 0; i < CPU_GRP_SIZE && !endOfSearch; i += 4) {
-
-        switch (searchMode) {
-          case SEARCH_COMPRESSED:
-            checkAddressesSSE(true, key, i, pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
-            break;
-          case SEARCH_UNCOMPRESSED:
-            checkAddressesSSE(false, key, i, pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
-            break;
-          case SEARCH_BOTH:
-            checkAddressesSSE(true, key, i, pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
-            checkAddressesSSE(false, key, i, pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
-            break;
-        }
-
-      }
-
-    } else {
-
-      for (int i = 0; i < CPU_GRP_SIZE && !endOfSearch; i ++) {
-
-        switch (searchMode) {
-        case SEARCH_COMPRESSED:
-          checkAddresses(true, key, i, pts[i]);
-          break;
-        case SEARCH_UNCOMPRESSED:
-          checkAddresses(false, key, i, pts[i]);
-          break;
-        case SEARCH_BOTH:
-          checkAddresses(true, key, i, pts[i]);
-          checkAddresses(false, key, i, pts[i]);
-          break;
-        }
-
-      }
+  } else {
 
+    sprintf(tmp, "{\"time\":%.3f,\"total\":%llu,\"found\":%d,\"hits\":%llu",
+      t - startTime, (unsigned long long)count, nbFoundKey.load(), (unsigned long long)hit);
+    out.append(tmp);
+    if (!hasPattern) {
+      sprintf(tmp, ",\"falsePositiveRate\":%.6f", fpRate);
+      out.append(tmp);
     }
+    sprintf(tmp, ",\"verifyTime\":%.6f,\"lost\":%llu,\"parked\":%d", vTime, (unsigned long long)lost, nbParked);
+    out.append(tmp);
+    out.append(",\"cpu\":[");
+    for (int i = 0; i < nbCPUThread; i++) {
+      sprintf(tmp, "%s{\"thread\":%d,\"keyRate\":%.0f}", (i > 0) ? "," : "", i, (double)(stats[i].counter - lastCounters[i]) / dt);
+      out.append(tmp);
+    }
+    out.append("],\"gpu\":[");
+    for (int i = 0; i < nbGPUThread; i++) {
+      int thId = 0x80 + i;
+      DEVICE_METRICS *m = devMetrics + thId;
+      DEVICE_METRICS *l = lastDevMetrics + thId;
+      uint64_t nbLaunch = m->nbLaunch - l->nbLaunch;
+      double launchWait = (nbLaunch > 0) ? (m->waitTime - l->waitTime) / (double)nbLaunch : 0.0;
+      double hostLatency = (nbLaunch > 0) ? (m->hostTime - l->hostTime) / (double)nbLaunch : 0.0;
+      sprintf(tmp, "%s{\"gpu\":%d,\"keyRate\":%.0f,\"launches\":%llu,\"launchWait\":%.6f,\"hostLatency\":%.6f,\"lost\":%llu}",
+        (i > 0) ? "," : "", m->gpuId, (double)(stats[thId].counter - lastCounters[thId]) / dt,
+        (unsigned long long)m->nbLaunch, launchWait, hostLatency, (unsigned long long)m->nbLost);
+      out.append(tmp);
+    }
+    out.append("]}\n");
 
-    key.Add((uint64_t)CPU_GRP_SIZE);
-    counters[thId]+= 6*CPU_GRP_SIZE; // Point + endo #1 + endo #2 + Symetric point + endo #1 + endo #2
+    FILE *f = fopen(metricsFile.c_str(), "a");
+    if (f == NULL) {
+      printf("\nCannot open %s for writing\n", metricsFile.c_str());
+      metricsFile = "";
+      return;
+    }
+    fputs(out.c_str(), f);
+    fclose(f);
 
   }
 
-  ph->isRunning = false;
+  for (int i = 0; i < 256; i++)
+    lastCounters[i] = stats[i].counter;
+  memcpy(lastDevMetrics, devMetrics, sizeof(devMetrics));
+  lastMetricsTime = t;
 
 }
 
 // ----------------------------------------------------------------------------
+// Benchmark of a full FindKeyCPU group iteration and of the GPU kernels
 
-void VanitySearch::getGPUStartingKeys(int thId, int groupSize, int nbThread, Int *keys, Point *p) {
-
-  for (int i = 0; i < nbThread; i++) {
-    if (rekey > 0) {
-      keys[i].Rand(256);
-    } else {
-      keys[i].Set(&startKey);
-      Int offT((uint64_t)i);
-      offT.ShiftL(80);
-      Int offG((uint64_t)thId);
-      offG.ShiftL(112);
-      keys[i].Add(&offT);
-      keys[i].Add(&offG);
-    }
-    Int k(keys + i);
-    // Starting key is at the middle of the group
-    k.Add((uint64_t)(groupSize / 2));
-    p[i] = secp->ComputePublicKey(&k);
-    if (startPubKeySpecified)
-      p[i] = secp->AddDirect(p[i], startPubKey);
-  }
-
-}
-
-void VanitySearch::FindKeyGPU(TH_PARAM *ph) {
-
-  bool ok = true;
-
-#ifdef WITHGPU
-
-  // Global init
-  int thId = ph->threadId;
-  GPUEngine g(ph->gridSizeX,ph->gridSizeY, ph->gpuId, maxFound, (rekey!=0));
-  int nbThread = g.GetNbThread();
-  Point *p = new Point[nbThread];
-  Int *keys = new Int[nbThread];
-  vector<ITEM> found;
-
-  printf("GPU: %s\n",g.deviceName.c_str());
+void VanitySearch::Bench(std::vector<int> gpuId, std::vector<int> gridSize) {
 
-  counters[thId] = 0;
+  const char *modeName[] = { "Compressed", "Uncompressed", "Both" };
+  char name[64];
 
-  getGPUStartingKeys(thId, g.GetGroupSize(), nbThread, keys, p);
+  // One CPU search thread, hits are checked on the calling thread
+  endOfSearch = false;
+  nbCPUThread = 1;
+  nbGPUThread = 0;
+  nbVerifyThread = 0;
+  for (int i = 0; i < 256; i++)
+    stats[i].counter = 0;
+
+  TH_PARAM param;
+  memset(&param, 0, sizeof(TH_PARAM));
+  param.obj = this;
+  param.threadId = 0;
+  param.isRunning = true;
+#ifdef WIN64
+  DWORD thread_id;
+  param.thread = CreateThread(NULL, 0, _FindKey, (void*)&param, 0, &thread_id);
+#else
+  pthread_create(&param.thread, NULL, &_FindKey, (void*)&param);
+#endif
 
-  g.SetSearchMode(searchMode);
-  g.SetSearchType(searchType);
-  if (onlyFull) {
-    g.SetPrefix(usedPrefixL,nbPrefix);
-  } else {
-    if(hasPattern)
-      g.SetPattern(inputPrefixes[0].c_str());
-    else
-      g.SetPrefix(usedPrefix);
+  while (!param.hasStarted)
+    Timer::SleepMillis(10);
+  Timer::SleepMillis(500);
+
+  // Keep the best of BENCH_RUN periods of 1 second
+  double best = 0.0;
+  for (int r = 0; r < BENCH_RUN; r++) {
+    uint64_t c0 = stats[0].counter;
+    double t0 = Timer::get_tick();
+    Timer::SleepMillis(1000);
+    double keyRate = (double)(stats[0].counter - c0) / (Timer::get_tick() - t0);
+    if (keyRate > best) best = keyRate;
   }
+  endOfSearch = true;
+  joinThread(&param);
 
-  getGPUStartingKeys(thId, g.GetGroupSize(), nbThread, keys, p);
-  ok = g.SetKeys(p);
-  ph->rekeyRequest = false;
-
-  ph->hasStarted = true;
-
-  // GPU Thread
-  while (ok && !endOfSearch) {
+  sprintf(name, "FindKeyCPU (%s)", modeName[searchMode]);
+  printf("%-24s: %s, %s\n", name,
+    Timer::getResult("group", 1, 0.0, (6.0 * cpuGrpSize) / best).c_str(),
+    Timer::getResult("key", 1, 0.0, 1.0 / best).c_str());
 
-    if (ph->rekeyRequest) {
-      getGPUStartingKeys(thId, g.GetGroupSize(), nbThread, keys, p);
-      ok = g.SetKeys(p);
-      ph->rekeyRequest = false;
-    }
+  if (!useGpu)
+    return;
 
-    // Call kernel
-    ok = g.Launch(found);
+#ifdef WITHGPU
 
-    for(int i=0;i<(int)found.size() && !endOfSearch;i++) {
+  // Single kernel launches for each search mode and address type
+  const char *typeName[] = { "P2PKH", "P2SH", "BECH32" };
+  int thId = 0x80;
+  vector<ITEM> found;
+  for (int mode = SEARCH_COMPRESSED; mode <= SEARCH_BOTH; mode++) {
+    for (int type = P2PKH; type <= BECH32; type++) {
+
+      GPUDevice *g = GPUDevice::Create(gpuBackend, gridSize[0], gridSize[1], gpuId[0], maxFound, false);
+      if (g == NULL)
+        return;
+      if (mode == SEARCH_COMPRESSED && type == P2PKH)
+        printf("GPU: %s\n", g->deviceName.c_str());
+
+      int nbThread = g->GetNbThread();
+      Point *p = new Point[nbThread];
+      Int *keys = new Int[nbThread];
+
+      g->SetSearchMode(mode);
+      g->SetSearchType(type);
+      setGPUPrefix(g);
+      getGPUStartingKeys(thId, g->GetGroupSize(), nbThread, keys, p);
+      bool ok = g->SetKeys(p);
+
+      // Fill the pipeline, then measure BENCH_LAUNCH consecutive launches
+      for (int i = 0; i < NB_OUTPUT_BUFFER && ok; i++)
+        ok = g->Launch(found);
+
+      best = 0.0;
+      for (int r = 0; r < BENCH_RUN && ok; r++) {
+        double t0 = Timer::get_tick();
+        for (int i = 0; i < BENCH_LAUNCH && ok; i++)
+          ok = g->Launch(found);
+        double t = (Timer::get_tick() - t0) / (double)BENCH_LAUNCH;
+        if (r == 0 || t < best) best = t;
+      }
 
-      ITEM it = found[i];
-      checkAddr(*(prefix_t *)(it.hash), it.hash, keys[it.thId], it.incr, it.endo, it.mode);
+      sprintf(name, "GPU %s %s", modeName[mode], typeName[type]);
+      if (ok) {
+        printf("%-24s: %.3f ms/launch, %s\n", name, best * 1000.0,
+          Timer::getResult("key", 1, 0.0, best / (6.0 * STEP_SIZE * nbThread)).c_str());
+      } else {
+        printf("%-24s: failed\n", name);
+      }
 
-    }
+      delete[] keys;
+      delete[] p;
+      delete g;
 
-    if (ok) {
-      for (int i = 0; i < nbThread; i++) {
-        keys[i].Add((uint64_t)STEP_SIZE);
-      }
-      counters[thId] += 6ULL * STEP_SIZE * nbThread; // Point +  endo1 + endo2 + symetrics
     }
-
   }
 
-  delete[] keys;
-  delete[] p;
-
 #else
-  ph->hasStarted = true;
   printf("GPU code not compiled, use -DWITHGPU when compiling.\n");
 #endif
 
-  ph->isRunning = false;
-
 }
 
 // ----------------------------------------------------------------------------
+// GPU grid autotuning
 
-bool VanitySearch::isAlive(TH_PARAM *p) {
+#ifdef WITHGPU
+double VanitySearch::getGridKeyRate(int gpuId, int nbThreadGroup, int nbThreadPerGroup) {
 
-  bool isAlive = true;
-  int total = nbCPUThread + nbGPUThread;
-  for(int i=0;i<total;i++)
-    isAlive = isAlive && p[i].isRunning;
+  GPUDevice *g = GPUDevice::Create(gpuBackend, nbThreadGroup, nbThreadPerGroup, gpuId, maxFound, false);
+  if (g == NULL)
+    return 0.0;
+  int nbThread = g->GetNbThread();
+  Point *p = new Point[nbThread];
 
-  return isAlive;
+  // Starting keys do not matter for timing, a small set is used cyclically
+  Int keys[AUTOTUNE_NB_KEY];
+  Point base[AUTOTUNE_NB_KEY];
+  getGPUStartingKeys(0x80, g->GetGroupSize(), AUTOTUNE_NB_KEY, keys, base);
+  for (int i = 0; i < nbThread; i++)
+    p[i] = base[i % AUTOTUNE_NB_KEY];
+
+  g->SetSearchMode(searchMode);
+  g->SetSearchType(getGPUSearchType());
+  g->SetUncompressedKeyHash((searchTypes & TYPE_MASK(P2PKH)) != 0);
+  setGPUPrefix(g);
+  bool ok = g->SetKeys(p);
+  delete[] p;
+
+  vector<ITEM> found;
+  for (int i = 0; i < NB_OUTPUT_BUFFER && ok; i++)
+    ok = g->Launch(found);
+
+  double t0 = Timer::get_tick();
+  for (int i = 0; i < AUTOTUNE_LAUNCH && ok; i++)
+    ok = g->Launch(found);
+  double t1 = Timer::get_tick();
+  delete g;
+
+  if (!ok)
+    return 0.0;
+  return (6.0 * STEP_SIZE * nbThread * AUTOTUNE_LAUNCH) / (t1 - t0);
 
 }
+#endif
 
-// ----------------------------------------------------------------------------
+bool VanitySearch::AutoTune(std::vector<int> gpuId, std::vector<int> &gridSize) {
 
-bool VanitySearch::hasStarted(TH_PARAM *p) {
+#ifdef WITHGPU
 
-  bool hasStarted = true;
-  int total = nbCPUThread + nbGPUThread;
-  for (int i = 0; i < total; i++)
-    hasStarted = hasStarted && p[i].hasStarted;
+  int groupMult[] = { 2, 4, 8, 16, 32 };
+  int threadPerGroup[] = { 64, 128, 256, 512 };
 
-  return hasStarted;
+  for (int i = 0; i < (int)gpuId.size(); i++) {
 
-}
+    string key;
+    int nbMP;
+    int maxThreadPerGroup;
+    if (!GPUDevice::GetDeviceInfo(gpuBackend, gpuId[i], key, &nbMP, &maxThreadPerGroup))
+      return false;
 
-// ----------------------------------------------------------------------------
+    printf("Autotune GPU #%d %s\n", gpuId[i], key.c_str());
 
-void VanitySearch::rekeyRequest(TH_PARAM *p) {
+    double bestRate = 0.0;
+    for (int y = 0; y < 4; y++) {
+      if (threadPerGroup[y] > maxThreadPerGroup)
+        continue;
+      for (int x = 0; x < 5; x++) {
+        int gx = nbMP * groupMult[x];
+        int gy = threadPerGroup[y];
+        double keyRate = getGridKeyRate(gpuId[i], gx, gy);
+        printf("  Grid(%dx%d): %.2f Mkey/s\n", gx, gy, keyRate / 1000000.0);
+        if (keyRate > bestRate) {
+          bestRate = keyRate;
+          gridSize[2 * i] = gx;
+          gridSize[2 * i + 1] = gy;
+        }
+      }
+    }
 
-  bool hasStarted = true;
-  int total = nbCPUThread + nbGPUThread;
-  for (int i = 0; i < total; i++)
-  p[i].rekeyRequest = true;
+    if (bestRate == 0.0) {
+      printf("Autotune GPU #%d failed\n", gpuId[i]);
+      return false;
+    }
+    printf("Best grid for GPU #%d: %dx%d (%.2f Mkey/s)\n", gpuId[i], gridSize[2 * i], gridSize[2 * i + 1], bestRate / 1000000.0);
+
+  }
+
+  return true;
+
+#else
+  printf("GPU code not compiled, use -DWITHGPU when compiling.\n");
+  return false;
+#endif
 
 }
 
 // ----------------------------------------------------------------------------
 
-uint64_t VanitySearch::getGPUCount() {
+// SIGINT/SIGTERM stop the search cleanly so that the found keys still queued
+// (verify queue, result ring) are written, a second signal kills the process.
+// The previous handlers (daemon) are restored when the search returns.
+static volatile sig_atomic_t stopSignal = 0;
+static void (*prevSigInt)(int) = SIG_DFL;
+static void (*prevSigTerm)(int) = SIG_DFL;
 
-  uint64_t count = 0;
-  for(int i=0;i<nbGPUThread;i++)
-    count += counters[0x80L+i];
-  return count;
+static void sigStop(int sig) {
+
+  stopSignal = 1;
+  signal(sig, SIG_DFL);
 
 }
 
-uint64_t VanitySearch::getCPUCount() {
+static void installStopHandler() {
 
-  uint64_t count = 0;
-  for(int i=0;i<nbCPUThread;i++)
-    count += counters[i];
-  return count;
+  stopSignal = 0;
+  prevSigInt = signal(SIGINT, sigStop);
+  prevSigTerm = signal(SIGTERM, sigStop);
 
 }
 
-// ----------------------------------------------------------------------------
+static void restoreStopHandler() {
+
+  signal(SIGINT, prevSigInt);
+  signal(SIGTERM, prevSigTerm);
+
+}
 
 void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> gridSize) {
 
   double t0;
   double t1;
-  endOfSearch = false;
+  installStopHandler();
+  endOfSearch = stopRequest.load();
+  updateFound();
   nbCPUThread = nbThread;
   nbGPUThread = (useGpu?(int)gpuId.size():0);
-  nbFoundKey = 0;
 
-  memset(counters,0,sizeof(counters));
+  // CPU threads use the shard devices 0..0x7F, GPUs 0x80..0xFF
+  if (nbCPUThread > 0x80) {
+    printf("Warning, number of CPU thread limited to %d\n", 0x80);
+    nbCPUThread = 0x80;
+  }
+  if (nbGPUThread > 0x80) {
+    printf("Warning, number of GPU limited to %d\n", 0x80);
+    nbGPUThread = 0x80;
+  }
+
+  for (int i = 0; i < 256; i++)
+    stats[i].counter = 0;
+  PROF_INIT();
 
   printf("Number of CPU thread: %d\n", nbCPUThread);
+  if (nbCPUThread > 0) {
+    printf("CPU hash kernel: %s\n", cpuLanes == 16 ? "AVX-512 (16 lanes)" : cpuLanes == 8 ? "AVX2 (8 lanes)" :
+                                     cpuLanes == 4 ? "SSE (4 lanes)" : "Scalar");
+    printf("CPU group kernel: %s\n", groupIFMA ? "AVX-512 IFMA (8 lanes)" : "Scalar");
+  }
+  if (useScheduler) {
+    nbParked = 0;
+    schedDir = 1;
+    schedWait = SCHED_SETTLE + 1;
+    schedLastRate = 0.0;
+    schedHostTime = 0.0;
+    schedLoopTime = 0.0;
+    int nbCore = Timer::getCoreNumber();
+    if (nbGPUThread > 0)
+      printf("Scheduler: GPU threads on cores 0-%d", (nbGPUThread - 1) % nbCore);
+    else
+      printf("Scheduler: no GPU");
+    if (nbCPUThread > 0)
+      printf(", CPU threads on cores %d-%d", nbGPUThread % nbCore, (nbGPUThread + nbCPUThread - 1) % nbCore);
+    if (nbGPUThread > 0 && nbCPUThread > 0)
+      printf(", up to %d CPU thread(s) parked", (nbGPUThread < nbCPUThread) ? nbGPUThread : nbCPUThread);
+    printf("\n");
+  }
+  if (rekey == 0) {
+    printf("Key shards: Base Key + (device << %d) + (thread << %d) + offset", SHARD_DEVICE_SHIFT, SHARD_THREAD_SHIFT);
+    if (nbCPUThread > 0)
+      printf(", CPU devices 0x00-0x%02X", nbCPUThread - 1);
+    if (nbGPUThread > 0)
+      printf(", GPU devices 0x80-0x%02X", 0x80 + nbGPUThread - 1);
+    printf("\n");
+  }
 
   TH_PARAM *params = (TH_PARAM *)malloc((nbCPUThread + nbGPUThread) * sizeof(TH_PARAM));
   memset(params,0,(nbCPUThread + nbGPUThread) * sizeof(TH_PARAM));
 
+  // Launch verification threads
+  endOfVerify = false;
+  TH_PARAM *vParams = (TH_PARAM *)malloc(NB_VERIFY_THREAD * sizeof(TH_PARAM));
+  memset(vParams, 0, NB_VERIFY_THREAD * sizeof(TH_PARAM));
+  for (int i = 0; i < NB_VERIFY_THREAD; i++) {
+    vParams[i].obj = this;
+    vParams[i].threadId = i;
+    vParams[i].isRunning = true;
+#ifdef WIN64
+    DWORD thread_id;
+    vParams[i].thread = CreateThread(NULL, 0, _VerifyKeys, (void*)(vParams + i), 0, &thread_id);
+#else
+    pthread_create(&vParams[i].thread, NULL, &_VerifyKeys, (void*)(vParams + i));
+#endif
+  }
+  nbVerifyThread = NB_VERIFY_THREAD;
+
   // Launch CPU threads
   for (int i = 0; i < nbCPUThread; i++) {
     params[i].obj = this;
@@ -1662,12 +3528,9 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
 
 #ifdef WIN64
     DWORD thread_id;
-    CreateThread(NULL, 0, _FindKey, (void*)(params+i), 0, &thread_id);
-    ghMutex = CreateMutex(NULL, FALSE, NULL);
+    params[i].thread = CreateThread(NULL, 0, _FindKey, (void*)(params+i), 0, &thread_id);
 #else
-    pthread_t thread_id;
-    pthread_create(&thread_id, NULL, &_FindKey, (void*)(params+i));
-    ghMutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_create(&params[i].thread, NULL, &_FindKey, (void*)(params+i));
 #endif
   }
 
@@ -1681,10 +3544,9 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
     params[nbCPUThread+i].gridSizeY = gridSize[2*i+1];
 #ifdef WIN64
     DWORD thread_id;
-    CreateThread(NULL, 0, _FindKeyGPU, (void*)(params+(nbCPUThread+i)), 0, &thread_id);
+    params[nbCPUThread+i].thread = CreateThread(NULL, 0, _FindKeyGPU, (void*)(params+(nbCPUThread+i)), 0, &thread_id);
 #else
-    pthread_t thread_id;
-    pthread_create(&thread_id, NULL, &_FindKeyGPU, (void*)(params+(nbCPUThread+i)));
+    pthread_create(&params[nbCPUThread+i].thread, NULL, &_FindKeyGPU, (void*)(params+(nbCPUThread+i)));
 #endif
   }
 
@@ -1692,7 +3554,7 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
   setvbuf(stdout, NULL, _IONBF, 0);
 #endif
 
-  uint64_t lastCount = 0;
+  uint64_t lastCount = resumeCount;
   uint64_t gpuCount = 0;
   uint64_t lastGPUCount = 0;
 
@@ -1715,17 +3577,28 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
 
   t0 = Timer::get_tick();
   startTime = t0;
+  double lastCheckpoint = t0;
+  lastRekey = resumeCount;
+  lastMetricsTime = t0;
+  startFoundKey = nbFoundKey;
+  memset(lastCounters, 0, sizeof(lastCounters));
+  memset(lastDevMetrics, 0, sizeof(lastDevMetrics));
 
   while (isAlive(params)) {
 
-    int delay = 2000;
-    while (isAlive(params) && delay>0) {
-      Timer::SleepMillis(500);
-      delay -= 500;
+    // Wait for the next report, the end of a search thread wakes the monitor up
+    double tNext = Timer::get_tick() + 2.0;
+    double tNow;
+    while (isAlive(params) && (tNow = Timer::get_tick()) < tNext)
+      waitMonitor((int)((tNext - tNow) * 1000.0) + 1);
+
+    if (stopSignal && !endOfSearch) {
+      printf("\nInterrupted, writing pending results\n");
+      Stop();
     }
 
     gpuCount = getGPUCount();
-    uint64_t count = getCPUCount() + gpuCount;
+    uint64_t count = getCPUCount() + gpuCount + resumeCount;
 
     t1 = Timer::get_tick();
     keyRate = (double)(count - lastCount) / (t1 - t0);
@@ -1748,9 +3621,12 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
     if (isAlive(params)) {
       printf("\r[%.2f Mkey/s][GPU %.2f Mkey/s][Total 2^%.2f]%s[Found %d]  ",
         avgKeyRate / 1000000.0, avgGpuKeyRate / 1000000.0,
-          log2((double)count), GetExpectedTime(avgKeyRate, (double)count).c_str(),nbFoundKey);
+          log2((double)count), GetExpectedTime(avgKeyRate, (double)count).c_str(),nbFoundKey.load());
     }
 
+    if (useScheduler && nbGPUThread > 0 && nbCPUThread > 0)
+      scheduleCPU(params, keyRate);
+
     if (rekey > 0) {
       if ((count - lastRekey) > (1000000 * rekey)) {
         // Rekey request
@@ -1759,14 +3635,60 @@ void VanitySearch::Search(int nbThread,std::vector<int> gpuId,std::vector<int> g
       }
     }
 
+    if (server) {
+      // Report progress to the coordinator
+      char tmp[128];
+      sprintf(tmp, "COUNT %llu %.0f", (unsigned long long)count, avgKeyRate);
+      serverWrite(string(tmp));
+      sendFoundInputs();
+    }
+
+    if (checkpointDelay > 0 && (t1 - lastCheckpoint) > (double)checkpointDelay) {
+      saveCheckpoint(count);
+      lastCheckpoint = t1;
+    }
+
+    if (metricsFile.length() > 0)
+      saveMetrics(count, t1);
+    PROF_POLL();
+
     lastCount = count;
     lastGPUCount = gpuCount;
     t0 = t1;
 
   }
 
+  // The search ends with its first thread (e.g. a GPU that cannot start), wait for
+  // the others, then verify the pending candidates before leaving
+  Stop();
+  for (int i = 0; i < nbCPUThread + nbGPUThread; i++)
+    joinThread(params + i);
+  endOfVerify = true;
+  for (int i = 0; i < NB_VERIFY_THREAD; i++)
+    joinThread(vParams + i);
+  nbVerifyThread = 0;
+  closeOutput();
+  PROF_DUMP();
+
+  // Also saved with -ckpi 0 (no periodic save)
+  if (checkpointFile.length() > 0)
+    saveCheckpoint(getCPUCount() + getGPUCount() + resumeCount);
+
+  if (server) {
+    char tmp[128];
+    sprintf(tmp, "COUNT %llu 0", (unsigned long long)(getCPUCount() + getGPUCount() + resumeCount));
+    serverWrite(string(tmp));
+    sendFoundInputs();
+    server->Close();
+  }
+
+  free(vParams);
   free(params);
 
+  // Signals received from now go to the caller
+  restoreStopHandler();
+  interrupted = (stopSignal != 0);
+
 }
 
 // ----------------------------------------------------------------------------
@@ -1784,3 +3706,473 @@ string VanitySearch::GetHex(vector<unsigned char> &buffer) {
   return ret;
 
 }
+
+// ----------------------------------------------------------------------------
+// Distributed search
+//
+// Line based protocol, in clear text (found private keys included):
+//   server -> worker  AUTH nonce
+//   worker -> server  HELLO prefixHash searchMode searchTypes sha256(nonce:token)
+//   server -> worker  KEY nodeId baseKey | ERR message
+//   worker -> server  COUNT keyCount keyRate
+//   worker -> server  FOUND address privAddr privHex
+//   both directions   PREFIX inputIndex (prefix or pattern found)
+//   server -> worker  STOP
+// ----------------------------------------------------------------------------
+
+#ifdef WIN64
+DWORD WINAPI _AcceptWorkers(LPVOID lpParam) {
+#else
+void *_AcceptWorkers(void *lpParam) {
+#endif
+  TH_PARAM *p = (TH_PARAM *)lpParam;
+  p->obj->AcceptWorkers(p);
+  return 0;
+}
+
+#ifdef WIN64
+DWORD WINAPI _ServeWorker(LPVOID lpParam) {
+#else
+void *_ServeWorker(void *lpParam) {
+#endif
+  TH_PARAM *p = (TH_PARAM *)lpParam;
+  p->obj->ServeWorker(p);
+  return 0;
+}
+
+#ifdef WIN64
+DWORD WINAPI _ReceiveServer(LPVOID lpParam) {
+#else
+void *_ReceiveServer(void *lpParam) {
+#endif
+  TH_PARAM *p = (TH_PARAM *)lpParam;
+  p->obj->ReceiveServer(p);
+  return 0;
+}
+
+void VanitySearch::sendFoundInputs() {
+
+  vector<int> found;
+  lock();
+  for (int i = 0; i < (int)inputPrefixes.size(); i++) {
+    if (!sentFound[i] && isInputFound(i)) {
+      found.push_back(i);
+      sentFound[i] = true;
+    }
+  }
+  unlock();
+
+  char tmp[32];
+  for (int i = 0; i < (int)found.size(); i++) {
+    sprintf(tmp, "PREFIX %d", found[i]);
+    serverWrite(string(tmp));
+  }
+
+}
+
+void VanitySearch::AcceptWorkers(TH_PARAM *ph) {
+
+  TcpSocket *sock;
+
+  while ((sock = listener->Accept()) != NULL) {
+
+    // The node id is assigned by ServeWorker() once the handshake succeeded
+    lock();
+    int slot = 0;
+    while (slot < CLUSTER_MAX_WORKER && workers[slot].used)
+      slot++;
+    if (slot < CLUSTER_MAX_WORKER) {
+      workers[slot].sock = sock;
+      workers[slot].used = true;
+      workers[slot].connected = false;
+      workers[slot].synced = false;
+      workers[slot].writing = false;
+      workers[slot].nodeId = -1;
+      workers[slot].count = 0;
+      workers[slot].keyRate = 0.0;
+    }
+    unlock();
+
+    if (slot == CLUSTER_MAX_WORKER) {
+      sock->WriteLine("ERR too many workers");
+      delete sock;
+      continue;
+    }
+
+    TH_PARAM *p = (TH_PARAM *)malloc(sizeof(TH_PARAM));
+    memset(p, 0, sizeof(TH_PARAM));
+    p->obj = this;
+    p->threadId = slot;
+    p->isRunning = true;
+#ifdef WIN64
+    DWORD thread_id;
+    CreateThread(NULL, 0, _ServeWorker, (void*)p, 0, &thread_id);
+#else
+    pthread_t thread_id;
+    pthread_create(&thread_id, NULL, &_ServeWorker, (void*)p);
+    pthread_detach(thread_id);
+#endif
+
+  }
+
+  ph->isRunning = false;
+
+}
+
+void VanitySearch::releaseWorker(WORKER_INFO *w) {
+
+  lock();
+  doneCount += w->count;
+  w->count = 0;
+  w->keyRate = 0.0;
+  w->connected = false;
+  // sendWorkers() is writing to the socket, it frees the slot once done
+  if (!w->writing)
+    freeWorker(w);
+  unlock();
+
+}
+
+// Global lock held
+void VanitySearch::freeWorker(WORKER_INFO *w) {
+
+  delete w->sock;
+  w->sock = NULL;
+  w->used = false;
+
+}
+
+// Found prefixes (or STOP) to the connected nodes. The lines are built under the
+// lock and sent after unlock(), a node that stops reading is dropped on send timeout.
+// netMutex keeps a single writer per socket (Serve() and the new nodes).
+void VanitySearch::sendWorkers(bool stop) {
+
+  vector<int> slots;
+  vector< vector<string> > lines;
+  char tmp[32];
+
+#ifdef WIN64
+  WaitForSingleObject(netMutex, INFINITE);
+#else
+  pthread_mutex_lock(&netMutex);
+#endif
+
+  lock();
+  vector<bool> wasSent = sentFound;
+  for (int i = 0; i < (int)inputPrefixes.size(); i++)
+    if (isInputFound(i)) sentFound[i] = true;
+  for (int j = 0; j < CLUSTER_MAX_WORKER; j++) {
+    WORKER_INFO *w = workers + j;
+    if (!w->connected)
+      continue;
+    vector<string> l;
+    if (stop) {
+      l.push_back("STOP");
+    } else {
+      // A new node gets all the prefixes already found
+      for (int i = 0; i < (int)inputPrefixes.size(); i++) {
+        if (w->synced ? (sentFound[i] && !wasSent[i]) : isInputFound(i)) {
+          sprintf(tmp, "PREFIX %d", i);
+          l.push_back(string(tmp));
+        }
+      }
+      w->synced = true;
+    }
+    if (l.size() > 0) {
+      w->writing = true;
+      slots.push_back(j);
+      lines.push_back(l);
+    }
+  }
+  unlock();
+
+  for (int k = 0; k < (int)slots.size(); k++) {
+    WORKER_INFO *w = workers + slots[k];
+    bool ok = true;
+    for (int i = 0; ok && i < (int)lines[k].size(); i++)
+      ok = w->sock->WriteLine(lines[k][i]);
+    if (!ok && !stop) {
+      // ServeWorker() leaves its read loop and releases the node
+      printf("\nServer: node #%d does not respond, dropped\n", w->nodeId);
+      w->sock->Shutdown();
+    }
+  }
+
+  lock();
+  for (int k = 0; k < (int)slots.size(); k++) {
+    WORKER_INFO *w = workers + slots[k];
+    w->writing = false;
+    if (!w->connected)
+      freeWorker(w);
+  }
+  unlock();
+
+#ifdef WIN64
+  ReleaseMutex(netMutex);
+#else
+  pthread_mutex_unlock(&netMutex);
+#endif
+
+}
+
+void VanitySearch::ServeWorker(TH_PARAM *ph) {
+
+  WORKER_INFO *w = workers + ph->threadId;
+  free(ph);
+  string line;
+  char tmp[256];
+
+  // Handshake, an idle peer is dropped after TCP_AUTH_TIMEOUT
+  w->sock->SetTimeout(TCP_AUTH_TIMEOUT);
+  string nonce = TcpSocket::NewToken();
+  w->sock->WriteLine("AUTH " + nonce);
+  unsigned long long pHash;
+  int wMode;
+  int wType;
+  char digest[80];
+  if (!w->sock->ReadLine(line) ||
+      sscanf(line.c_str(), "HELLO %llx %d %d %79s", &pHash, &wMode, &wType, digest) != 4) {
+    printf("\nServer: invalid handshake from %s\n", w->sock->GetPeerName().c_str());
+    releaseWorker(w);
+    return;
+  }
+
+  if (!TcpSocket::SameDigest(string(digest), TcpSocket::AuthDigest(nonce, netToken))) {
+    printf("\nServer: authentication failed from %s\n", w->sock->GetPeerName().c_str());
+    w->sock->WriteLine("ERR authentication failed");
+    releaseWorker(w);
+    return;
+  }
+
+  if ((uint64_t)pHash != getPrefixHash() || wMode != searchMode || wType != (int)searchTypes) {
+    w->sock->WriteLine("ERR prefixes or search mode differ from the server");
+    releaseWorker(w);
+    return;
+  }
+  w->sock->SetTimeout(0);
+
+  // Node ids are never reused so key ranges never overlap
+  lock();
+  int nodeId = nbWorker++;
+  w->nodeId = nodeId;
+  unlock();
+
+  Int baseKey(&startKey);
+  Int off((uint64_t)nodeId);
+  off.ShiftL(SHARD_NODE_SHIFT);
+  baseKey.Add(&off);
+
+  sprintf(tmp, "KEY %d %s", nodeId, baseKey.GetBase16().c_str());
+  w->sock->SetSendTimeout(TCP_SEND_TIMEOUT);
+  if (!w->sock->WriteLine(string(tmp))) {
+    releaseWorker(w);
+    return;
+  }
+
+  // Prefixes already found by other nodes, Serve() forwards the next ones
+  lock();
+  w->connected = true;
+  unlock();
+  sendWorkers(false);
+  printf("\nServer: node #%d connected from %s\n", nodeId, w->sock->GetPeerName().c_str());
+
+  while (w->sock->ReadLine(line)) {
+
+    unsigned long long count;
+    double keyRate;
+    int idx;
+    char addr[128];
+    char pAddr[128];
+    char pAddrHex[128];
+
+    if (sscanf(line.c_str(), "COUNT %llu %lf", &count, &keyRate) == 2) {
+      w->count = count;
+      w->keyRate = keyRate;
+    } else if (sscanf(line.c_str(), "FOUND %127s %127s %127s", addr, pAddr, pAddrHex) == 3) {
+      output(string(addr), string(pAddr), string(pAddrHex));
+      nbFoundKey++;
+    } else if (sscanf(line.c_str(), "PREFIX %d", &idx) == 1) {
+      if (idx >= 0 && idx < (int)inputPrefixes.size()) {
+        lock();
+        setInputFound(idx);
+        updateFound();
+        unlock();
+      }
+    }
+
+  }
+
+  printf("\nServer: node #%d disconnected\n", nodeId);
+  releaseWorker(w);
+
+}
+
+void VanitySearch::Serve(int port) {
+
+  if (rekey > 0) {
+    printf("Server: rekey cannot be used with distributed search\n");
+    exit(-1);
+  }
+
+  if (netToken.length() == 0) {
+    netToken = TcpSocket::NewToken();
+    printf("Server: token %s (give it to the workers with -token)\n", netToken.c_str());
+  }
+
+  listener = new TcpSocket();
+  if (!listener->Listen(port, netBind))
+    exit(-1);
+  printf("Server: listening on %s:%d\n", netBind.c_str(), port);
+
+  workers = (WORKER_INFO *)malloc(CLUSTER_MAX_WORKER * sizeof(WORKER_INFO));
+  memset(workers, 0, CLUSTER_MAX_WORKER * sizeof(WORKER_INFO));
+  sentFound.assign(inputPrefixes.size(), false);
+  endOfSearch = false;
+  updateFound();
+
+  TH_PARAM aParam;
+  memset(&aParam, 0, sizeof(TH_PARAM));
+  aParam.obj = this;
+  aParam.isRunning = true;
+#ifdef WIN64
+  DWORD thread_id;
+  CreateThread(NULL, 0, _AcceptWorkers, (void*)&aParam, 0, &thread_id);
+#else
+  setvbuf(stdout, NULL, _IONBF, 0);
+  pthread_t thread_id;
+  pthread_create(&thread_id, NULL, &_AcceptWorkers, (void*)&aParam);
+#endif
+
+  installStopHandler();
+  startTime = Timer::get_tick();
+
+  while (!endOfSearch) {
+
+    Timer::SleepMillis(2000);
+    if (stopSignal) {
+      printf("\nInterrupted, writing pending results\n");
+      break;
+    }
+
+    // Aggregate node reports
+    lock();
+    uint64_t count = doneCount;
+    double keyRate = 0.0;
+    int nbNode = 0;
+    for (int i = 0; i < CLUSTER_MAX_WORKER; i++) {
+      if (workers[i].connected) {
+        count += workers[i].count;
+        keyRate += workers[i].keyRate;
+        nbNode++;
+      }
+    }
+    unlock();
+
+    printf("\r[%.2f Mkey/s][Nodes %d][Total 2^%.2f]%s[Found %d]  ",
+      keyRate / 1000000.0, nbNode, log2((double)count + 1.0),
+      (keyRate > 0.0) ? GetExpectedTime(keyRate, (double)count).c_str() : "", nbFoundKey.load());
+
+    // Forward found prefixes to all nodes
+    sendWorkers(false);
+
+  }
+
+  // All prefixes found (-stop) or interrupted
+  if (endOfSearch)
+    printf("\nServer: all prefixes found, stopping nodes\n");
+  sendWorkers(true);
+  listener->Close();
+  closeOutput();
+  restoreStopHandler();
+
+}
+
+bool VanitySearch::ConnectServer(std::string host, int port) {
+
+  if (rekey > 0) {
+    printf("Worker: rekey cannot be used with distributed search\n");
+    return false;
+  }
+
+  if (netToken.length() == 0) {
+    printf("Worker: no token given, use -token with the one printed by the server\n");
+    return false;
+  }
+
+  server = new TcpSocket();
+  if (!server->Connect(host, port)) {
+    delete server;
+    server = NULL;
+    return false;
+  }
+
+  char tmp[256];
+  char nonce[80];
+  string line;
+  if (!server->ReadLine(line) || sscanf(line.c_str(), "AUTH %79s", nonce) != 1) {
+    printf("Worker: connection refused by server: %s\n", line.c_str());
+    delete server;
+    server = NULL;
+    return false;
+  }
+  sprintf(tmp, "HELLO %llx %d %d %s", (unsigned long long)getPrefixHash(), searchMode, (int)searchTypes,
+    TcpSocket::AuthDigest(string(nonce), netToken).c_str());
+  server->WriteLine(string(tmp));
+
+  int nodeId;
+  char key[80];
+  if (!server->ReadLine(line) || sscanf(line.c_str(), "KEY %d %79s", &nodeId, key) != 2) {
+    printf("Worker: connection refused by server: %s\n", line.c_str());
+    delete server;
+    server = NULL;
+    return false;
+  }
+
+  startKey.SetBase16(key);
+  sentFound.assign(inputPrefixes.size(), false);
+  printf("Worker: node #%d on %s\n", nodeId, server->GetPeerName().c_str());
+  printf("Base Key: %s\n", startKey.GetBase16().c_str());
+
+  TH_PARAM *p = (TH_PARAM *)malloc(sizeof(TH_PARAM));
+  memset(p, 0, sizeof(TH_PARAM));
+  p->obj = this;
+  p->isRunning = true;
+#ifdef WIN64
+  DWORD thread_id;
+  CreateThread(NULL, 0, _ReceiveServer, (void*)p, 0, &thread_id);
+#else
+  pthread_t thread_id;
+  pthread_create(&thread_id, NULL, &_ReceiveServer, (void*)p);
+  pthread_detach(thread_id);
+#endif
+
+  return true;
+
+}
+
+void VanitySearch::ReceiveServer(TH_PARAM *ph) {
+
+  string line;
+  int idx;
+
+  while (server->ReadLine(line)) {
+
+    if (line == "STOP") {
+      // updateFound() would clear a bare endOfSearch
+      Stop();
+    } else if (sscanf(line.c_str(), "PREFIX %d", &idx) == 1) {
+      if (idx >= 0 && idx < (int)inputPrefixes.size()) {
+        // Found by another node
+        lock();
+        setInputFound(idx);
+        sentFound[idx] = true;
+        updateFound();
+        unlock();
+      }
+    }
+
+  }
+
+  free(ph);
+
+}
@@ -22,14 +22,118 @@
 #include <vector>
 #include "SECP256k1.h"
 #include "GPU/GPUEngine.h"
+#include "FoundQueue.h"
+#include "HashTable.h"
+#include "GroupTable.h"
+#include "GroupIFMA.h"
+#include "ResultWriter.h"
+#include "Wildcard.h"
+#include "Network.h"
+#include "MappedFile.h"
 #ifdef WIN64
 #include <Windows.h>
 #endif
 
+// Default CPU group size (number of keys per batch inversion), -cg option
 #define CPU_GRP_SIZE 1024
+#define CPU_GRP_SIZE_MIN 64
+#define CPU_GRP_SIZE_MAX 16384
+
+// Consecutive groups of a CPU thread sharing a single batch inversion, the
+// generator table keeps the size of a group
+#define CPU_GRP_BATCH 2
+
+// Candidate verification (ComputePublicKey and address check) threads
+#define NB_VERIFY_THREAD 2
+#define FOUND_QUEUE_SIZE 16384
+#define VERIFY_BATCH_SIZE 64
+
+// Number of GPU kernel calls per benchmark run
+#define BENCH_LAUNCH 8
+
+// GPU grid autotuning, number of distinct starting keys and timed kernel calls per grid
+#define AUTOTUNE_NB_KEY 256
+#define AUTOTUNE_LAUNCH 4
+
+// Checkpoint file
+#define CHECKPOINT_MAGIC   0x504B4356 // VCKP
+#define CHECKPOINT_VERSION 5
+
+typedef struct {
+
+  uint32_t magic;
+  uint32_t version;
+  uint8_t  baseKey[32];
+  uint64_t count;          // Cumulative key count
+  uint64_t prefixHash;     // Hash of the input prefix list
+  uint32_t nbInput;
+  uint32_t nbFound;
+  int32_t  searchMode;
+  int32_t  searchTypes;
+  uint8_t  startPubKey[64]; // x,y of -sp, zero when not specified
+  uint32_t nbOffset;       // Followed by nbOffset (thId,offset) pairs and nbInput hit counts
+
+} CHECKPOINT_HEADER;
+
+// Keyspace sharding, (node, device, thread) searches from
+// startKey + (node << SHARD_NODE_SHIFT) + (device << SHARD_DEVICE_SHIFT) + (thread << SHARD_THREAD_SHIFT)
+// device is the search thread id (CPU threads 0..127, GPU 0x80+n), thread the GPU thread index (0 on CPU).
+// A device progresses by a common offset (< 2^64, saved in checkpoints) so ranges never overlap.
+#define SHARD_THREAD_SHIFT 80
+#define SHARD_DEVICE_SHIFT 112
+#define SHARD_NODE_SHIFT   128
+
+// Distributed search, node n searches the shards of startKey + (n << SHARD_NODE_SHIFT)
+// CLUSTER_MAX_WORKER is the number of simultaneous connections (slots are reused)
+#define CLUSTER_MAX_WORKER 256
+
+// CPU/GPU scheduler (-sched), monitor periods (2s) to wait after parking or
+// unparking a CPU thread, and after reverting a change which lowered the key rate
+#define SCHED_SETTLE 1
+#define SCHED_HOLD   15
+
+// Share of the GPU feeder loop spent handling results on the host below which
+// the feeders wait for the device only, parking a CPU thread cannot help them
+#define SCHED_HOST_SHARE 0.05
+
+// Per thread counters (indexed by thId), padded to 128 bytes so that two
+// threads never share a cache line (nor an adjacent line prefetch pair)
+#define STATS_SIZE 128
+
+typedef struct {
+
+  uint64_t counter;        // Number of keys computed
+  uint64_t offset;         // Offset of the thread keys from their starting key
+  uint8_t pad[STATS_SIZE - 16];
+
+} THREAD_STATS;
+
+// Per device metrics (indexed as stats)
+typedef struct {
+
+  int gpuId;
+  uint64_t nbLaunch;
+  double waitTime;         // Time blocked in GPUDevice::Launch() (device wait and result copy)
+  double hostTime;         // Time spent handling GPU results on the host
+  uint64_t nbLost;
+
+} DEVICE_METRICS;
 
 class VanitySearch;
 
+typedef struct {
+
+  TcpSocket *sock;
+  bool used;       // Slot taken (handshake in progress or connected)
+  bool connected;  // Authenticated, KEY sent, sendWorkers() writes to sock from now on
+  bool synced;     // Prefixes found before the connection were sent
+  bool writing;    // sendWorkers() writes to sock outside the lock and frees the slot
+  int nodeId;
+  uint64_t count;
+  double keyRate;
+
+} WORKER_INFO;
+
 typedef struct {
 
   VanitySearch *obj;
@@ -37,20 +141,35 @@ typedef struct {
   bool isRunning;
   bool hasStarted;
   bool rekeyRequest;
+  bool isParked;
   int  gridSizeX;
   int  gridSizeY;
   int  gpuId;
+#ifdef WIN64
+  HANDLE thread;   // Joined by Search() before it returns
+#else
+  pthread_t thread;
+#endif
 
 } TH_PARAM;
 
 
+// Address types searched in a single pass (searchTypes bit mask), P2PKH and BECH32
+// share the public key hash160, P2SH is computed from it (script hash160)
+#define TYPE_MASK(type) (1U << (type))
+#define KEY_HASH_TYPES  (TYPE_MASK(P2PKH) | TYPE_MASK(BECH32))
+
 typedef struct {
 
   char *prefix;
   int prefixLength;
   prefix_t sPrefix;
   double difficulty;
-  bool *found;
+  int type;
+
+  // Hash160 interval (big endian) of the addresses starting with prefix
+  uint8_t hash160Min[20];
+  uint8_t hash160Max[20];
 
   // For dreamer ;)
   bool isFull;
@@ -59,80 +178,292 @@ typedef struct {
 
 } PREFIX_ITEM;
 
+// Lookup entry of a decoded prefix, entries of a 16 bit prefix are contiguous.
+// min/max are the 64 high bits of the hash160 interval (coarse filter, the
+// address is checked afterwards), found is the input id (shared by the case
+// variants and duplicates of an input), prefix is an offset in prefixArena.
+// BECH32 entries are checked on the hash160 bits with bech32Mask[mask].
+typedef struct {
+
+  uint64_t min;
+  uint64_t max;
+  uint32_t found;
+  uint32_t prefix;
+  uint16_t prefixLength;
+  uint8_t type;
+  uint32_t mask;
+
+} PREFIX_ENTRY;
+
+// Bech32 prefix or pattern over the hash160, 5 bits per character ('?' leaves
+// its 5 bits out of the mask). Words are loaded from the hash160 bytes (same
+// layout as the GPU hash160 words).
 typedef struct {
 
-  std::vector<PREFIX_ITEM> *items;
-  bool found;
+  uint32_t mask[5];
+  uint32_t value[5];
+
+} BECH32_MASK;
+
+// Prefix decoding thread (large input lists)
+typedef struct {
+
+  VanitySearch *obj;
+  int start;                       // Inputs [start,end)
+  int end;
+  std::vector<PREFIX_ITEM> items;
+  std::vector<uint32_t> nbItem;    // Number of items of each input
+  volatile int nbDone;
+  volatile bool isRunning;
+
+} DECODE_PARAM;
+
+// Letters of a case unsensitive prefix expanded in case combinations
+#define CASE_FOLD_LETTERS 6
+
+#define DECODE_MIN_INPUT  16384
+#define MAX_DECODE_THREAD 64
+
+// Binary prefix index (-ix), decoded items of the input list:
+// header, (nbInput+1) uint32 item starts (8 bytes aligned), items, prefix strings
+#define PREFIX_INDEX_MAGIC   0x58495356 // VSIX
+#define PREFIX_INDEX_VERSION 3
+
+typedef struct {
+
+  uint32_t magic;
+  uint32_t version;
+  uint64_t prefixHash;     // Hash of the input prefix list
+  uint32_t nbInput;
+  uint32_t nbItem;
+  int32_t  searchTypes;    // Address types of the items (TYPE_MASK)
+  int32_t  caseSensitive;
+  uint64_t arenaSize;      // Size of the prefix strings (null terminated)
+
+} PREFIX_INDEX_HEADER;
+
+typedef struct {
+
+  double difficulty;
+  uint32_t prefixOffset;   // Offset in the prefix strings
+  uint16_t prefixLength;
+  prefix_t sPrefix;
+  prefixl_t lPrefix;
+  uint8_t isFull;
+  uint8_t type;
+  uint8_t hash160[20];
+  uint8_t hash160Min[20];
+  uint8_t hash160Max[20];
 
-} PREFIX_TABLE_ITEM;
+} PREFIX_INDEX_ITEM;
 
 class VanitySearch {
 
 public:
 
   VanitySearch(Secp256K1 *secp, std::vector<std::string> &prefix, std::string seed, int searchMode,
-               bool useGpu,bool stop,std::string outputFile, bool useSSE,uint32_t maxFound,uint64_t rekey,
-               bool caseSensitive,Point &startPubKey,bool paranoiacSeed);
+               bool useGpu,bool stop,std::string outputFile, bool useSSE,bool useAVX,int cpuGrpSize,uint32_t maxFound,
+               uint64_t rekey,bool caseSensitive,Point &startPubKey,bool paranoiacSeed,
+               std::string indexFile);
+  ~VanitySearch();
 
+  bool IsValid() { return valid; }
   void Search(int nbThread,std::vector<int> gpuId,std::vector<int> gridSize);
+  void Bench(std::vector<int> gpuId, std::vector<int> gridSize);
+  bool AutoTune(std::vector<int> gpuId, std::vector<int> &gridSize);
+  void SetCheckpoint(std::string fileName, int delay);
+  void SetMetrics(std::string fileName);
+  void SetOutputFormat(int format, int syncPolicy);
+  void SetQuota(uint32_t quota);
+  void SetScheduler(bool enable);
+  void SetNetwork(std::string bindAddr, std::string token);
+  void KeepResults(bool enable);
+  void GetResults(std::vector<std::string> &r);
+  void Stop();
+  // True when the last Search() was stopped by SIGINT/SIGTERM
+  bool IsInterrupted();
+  // Widest hash kernel supported by the CPU and the OS (4, 8 or 16 lanes)
+  static int GetCPUHashLanes();
+  void Serve(int port);
+  bool ConnectServer(std::string host, int port);
+  void AcceptWorkers(TH_PARAM *p);
+  void ServeWorker(TH_PARAM *p);
+  void releaseWorker(WORKER_INFO *w);
+  void freeWorker(WORKER_INFO *w);
+  void sendWorkers(bool stop);
+  void ReceiveServer(TH_PARAM *p);
   void FindKeyCPU(TH_PARAM *p);
   void FindKeyGPU(TH_PARAM *p);
+  void VerifyKeys(TH_PARAM *p);
+  void DecodePrefixes(DECODE_PARAM *p);
 
 private:
 
   std::string GetHex(std::vector<unsigned char> &buffer);
   std::string GetExpectedTime(double keyRate, double keyCount);
   bool checkPrivKey(std::string addr, Int &key, int32_t incr, int endomorphism, bool mode);
-  void checkAddr(int prefIdx, uint8_t *hash160, Int &key, int32_t incr, int endomorphism, bool mode);
+  void checkPrivKeys(int nbItem, FOUND_ITEM *items, std::string *addrs);
+  void getPrivKey(Int &key, int32_t incr, int endomorphism, Int &k, Point &sp);
+  int matchAddr(FOUND_ITEM &it, std::vector<std::string> &addrs);
+  void checkAddr(int prefIdx, uint8_t *hash160, Int &key, int32_t incr, int endomorphism, bool mode, int type);
+  void pushFound(int prefIdx, uint8_t *hash160, Int &key, int32_t incr, int endomorphism, bool mode, int type);
+  void checkPattern(std::string &addr, Int &key, int32_t incr, int endomorphism, bool mode);
+  bool initPatternMask(std::string &pattern, BECH32_MASK *m);
   void checkAddrSSE(uint8_t *h1, uint8_t *h2, uint8_t *h3, uint8_t *h4,
                     int32_t incr1, int32_t incr2, int32_t incr3, int32_t incr4,
-                    Int &key, int endomorphism, bool mode);
-  void checkAddresses(bool compressed, Int key, int i, Point p1);
-  void checkAddressesSSE(bool compressed, Int key, int i, Point p1, Point p2, Point p3, Point p4);
+                    Int &key, int endomorphism, bool mode, int type);
+  void setGPUPrefix(GPUDevice *g);
+  void updateGPUPrefix(GPUDevice *g);
+  double getGridKeyRate(int gpuId, int nbThreadGroup, int nbThreadPerGroup);
+  void checkAddresses(int nbLane, Int key, int i, Int *x, Int *y);
+  void checkHashes(int nbLane, uint8_t h[][20], int type, bool compressed, Int &key, int i, bool sym, int endo);
   void output(std::string addr, std::string pAddr, std::string pAddrHex);
+  void openOutput();
+  void closeOutput();
+  void serverWrite(std::string line);
   bool isAlive(TH_PARAM *p);
   bool isSingularPrefix(std::string pref);
   bool hasStarted(TH_PARAM *p);
   void rekeyRequest(TH_PARAM *p);
+  void scheduleCPU(TH_PARAM *p, double keyRate);
   uint64_t getGPUCount();
   uint64_t getCPUCount();
+  int getAddressType(std::string &prefix);
+  int getPatternTypes(int type, bool mode, int *types);
+  int getGPUSearchType();
   bool initPrefix(std::string &prefix, PREFIX_ITEM *it);
+  int decodePrefix(std::string &prefix, std::vector<PREFIX_ITEM> &items);
+  void decodePrefixes(std::vector<PREFIX_ITEM> &items, std::vector<uint32_t> &itemStart);
+  bool loadPrefixIndex(std::string fileName, uint64_t hash, std::vector<PREFIX_ITEM> &items, std::vector<uint32_t> &itemStart);
+  void savePrefixIndex(std::string fileName, uint64_t hash, std::vector<PREFIX_ITEM> &items, std::vector<uint32_t> &itemStart);
   void dumpPrefixes();
   double getDiffuclty();
   void updateFound();
-  void getCPUStartingKey(int thId, Int& key, Point& startP);
+  bool hitFound(uint32_t id);
+  void setFound(uint32_t id);
+  bool isFound(uint32_t id) { return (foundBits[id >> 6].load(std::memory_order_relaxed) >> (id & 63)) & 1; }
+  bool isPrefixDone(prefix_t p) { return prefixLeft[p].load(std::memory_order_relaxed) == 0; }
+  bool hasPrefix(prefix_t p) { return (prefixBits[p >> 6] >> (p & 63)) & 1; }
+  void getShardKey(int device, int thread, Int &key);
+  void getCPUStartingKey(int thId, Int& key, Point *startP);
   void getGPUStartingKeys(int thId, int groupSize, int nbThread, Int *keys, Point *p);
+  void getGPUStartingTable(int groupSize, int nbThread, Int *keys, std::vector<Point> &table);
   void enumCaseUnsentivePrefix(std::string s, std::vector<std::string> &list);
   bool prefixMatch(char *prefix, char *addr);
+  int getCaseFoldLength(std::string &prefix);
+  int getCaseCount(char c);
+  int32_t getIndexCaseMode() { return (int32_t)caseSensitive | (caseFold ? 2 : 0); }
+  bool isInputFound(int i);
+  void setInputFound(int i);
+  void sendFoundInputs();
+  void lock();
+  void unlock();
+  void notifyMonitor(TH_PARAM *ph = NULL);
+  void waitMonitor(int millis);
+  bool loadCheckpoint();
+  void saveCheckpoint(uint64_t count);
+  uint64_t getPrefixHash();
+  void saveMetrics(uint64_t count, double t);
 
   Secp256K1 *secp;
   Int startKey;
   Point startPubKey;
   bool startPubKeySpecified;
-  uint64_t counters[256];
+  THREAD_STATS stats[256];
+  uint64_t resumeCount;
+  std::string checkpointFile;
+  int checkpointDelay;
+  std::string metricsFile;
+  DEVICE_METRICS devMetrics[256];
+  DEVICE_METRICS lastDevMetrics[256];
+  uint64_t lastCounters[256];
+  double lastMetricsTime;
+  int startFoundKey;
+  std::atomic<uint64_t> nbHit;
+  std::atomic<uint64_t> nbQueued;             // Candidates pushed to the verify queue
+  std::atomic<uint64_t> nbVerified;           // and verified (checkpoint)
+  double verifyTime[NB_VERIFY_THREAD];
+  TcpSocket *server;
+  TcpSocket *listener;
+  std::string netBind;
+  std::string netToken;
+  WORKER_INFO *workers;
+  int nbWorker;                               // Node ids handed out
+  uint64_t doneCount;                         // Keys of the disconnected nodes
+  std::vector<bool> sentFound;
   double startTime;
-  int searchType;
+  uint32_t searchTypes;
   int searchMode;
   bool hasPattern;
   bool caseSensitive;
   bool useGpu;
   bool stopWhenFound;
-  bool endOfSearch;
+  uint32_t quota;
+  std::atomic<uint32_t> prefixVersion;
+  std::atomic<bool> endOfSearch;
+  std::atomic<bool> stopRequest;             // Stop(), the search ends even if prefixes are left
+  bool interrupted;                          // Search() stopped by a signal
+  std::atomic<bool> endOfVerify;
+  int nbVerifyThread;
+  FoundQueue *foundQueue;
   int nbCPUThread;
   int nbGPUThread;
-  int nbFoundKey;
+  bool useScheduler;
+  int nbParked;
+  int schedDir;
+  int schedWait;
+  double schedLastRate;
+  double schedHostTime;
+  double schedLoopTime;
+  std::atomic<int> nbFoundKey;
   uint64_t rekey;
   uint64_t lastRekey;
   uint32_t nbPrefix;
   std::string outputFile;
+  int outputFormat;
+  int outputSync;
+  ResultWriter *resultWriter;
+  bool keepResults;                          // Found keys kept in results (daemon)
+  std::vector<std::string> results;          // "address privAddr privHex"
+  bool valid;                                // false when the input cannot be searched
   bool useSSE;
+  int cpuGrpSize;
+  int cpuLanes;
+  GroupIFMA *groupIFMA;
   bool onlyFull;
   uint32_t maxFound;
+  int gpuBackend;                            // GPUDevice implementation
   double _difficulty;
-  bool *patternFound;
-  std::vector<PREFIX_TABLE_ITEM> prefixes;
+  bool hasDFA;
+  bool caseFold;                             // Case combinations of the first letters only
+  WildcardDFA patternDFA;
+  std::vector<uint16_t> patternTable;
+  bool hasPatternMask;                       // All patterns given as Bech32 masks
+  std::vector<BECH32_MASK> patternMask;      // Bech32 mask of each pattern
+  uint32_t *prefixStart;                     // 65537 entry starts
+  std::vector<PREFIX_ENTRY> prefixEntry;
+  std::vector<double> prefixDifficulty;
+  std::vector<char> prefixArena;
+  std::vector<BECH32_MASK> bech32Mask;       // Masks of the BECH32 entries
+  uint64_t prefixBits[1024];                 // Used 16 bit prefixes
+  std::atomic<uint32_t> *prefixLeft;         // Entries of the prefix not found yet (-stop)
+  std::atomic<uint32_t> nbLeft;              // Prefixes (or patterns) not found yet (-stop)
+  std::vector<uint32_t> inputEntryStart;     // Entries of each input id,
+  std::vector<prefix_t> inputEntryPrefix;    // as their 16 bit prefixes
+  std::vector<uint32_t> diffOrder;           // Entries by increasing difficulty
+  std::atomic<uint32_t> diffCursor;          // First entry of diffOrder not found
+  std::atomic<uint32_t> *inputCount;         // Number of hits of each input
+  std::atomic<uint64_t> *foundBits;          // Found state of each input
   std::vector<prefix_t> usedPrefix;
   std::vector<LPREFIX> usedPrefixL;
+  std::vector<RPREFIX> usedPrefixR;
+  uint32_t nbPrefixRange;
+  std::vector<uint64_t> usedBloomKey;
+  GPUPrefixTable *gpuPrefixTable;
+  MappedFile *prefixIndex;
+  HashTable fullTable;
+  std::vector<uint32_t> fullFound;
+  std::vector<uint8_t> fullType;
   std::vector<std::string> &inputPrefixes;
 
   Int beta;
@@ -142,8 +473,14 @@ private:
 
 #ifdef WIN64
   HANDLE ghMutex;
+  HANDLE netMutex;
+  HANDLE monitorEvent;
 #else
   pthread_mutex_t  ghMutex;
+  pthread_mutex_t  netMutex;
+  pthread_mutex_t  monitorMutex;
+  pthread_cond_t   monitorCond;
+  bool monitorSignaled;
 #endif
 
 };
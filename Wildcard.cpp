@@ -16,6 +16,10 @@
 */
 
 #include "Wildcard.h"
+#include <ctype.h>
+#include <string.h>
+#include <map>
+#include <algorithm>
 
 using namespace std;
 
@@ -62,3 +66,159 @@ starCheck:
   goto loopStart;
 
 }
+
+// ---------------------------------------------------------------------------------
+
+WildcardDFA::WildcardDFA() {
+  nbState = 0;
+}
+
+// NFA state items are (pattern index << 32 | position in pattern)
+#define NFA_ITEM(p,i) (((uint64_t)(p) << 32) | (uint64_t)(i))
+#define NFA_PAT(it) ((uint32_t)((it) >> 32))
+#define NFA_POS(it) ((uint32_t)(it))
+
+void WildcardDFA::closure(std::vector<std::string> &patterns, NFASTATE &s) {
+
+  // '*' also matches the empty string
+  size_t n = s.size();
+  for (size_t j = 0; j < n; j++) {
+    uint32_t p = NFA_PAT(s[j]);
+    uint32_t i = NFA_POS(s[j]);
+    while (i < patterns[p].length() && patterns[p][i] == '*') {
+      i++;
+      s.push_back(NFA_ITEM(p, i));
+    }
+  }
+  sort(s.begin(), s.end());
+  s.erase(unique(s.begin(), s.end()), s.end());
+
+}
+
+bool WildcardDFA::Compile(std::vector<std::string> &patterns, bool caseSensitive) {
+
+  // Character classes: digits 1..10, upper case letters 11..36, lower case letters 37..62.
+  // Other characters go to class 0 which is not matched by '?'.
+  memset(charClass, 0, sizeof(charClass));
+  for (int c = 0; c < 10; c++)
+    charClass['0' + c] = 1 + c;
+  for (int c = 0; c < 26; c++) {
+    charClass['A' + c] = 11 + c;
+    charClass['a' + c] = caseSensitive ? 37 + c : 11 + c;
+  }
+
+  vector<NFASTATE> states;
+  map<NFASTATE, uint32_t> stateIds;
+
+  trans.clear();
+  acceptStart.clear();
+  acceptIds.clear();
+
+  // Dead state and start state
+  NFASTATE s0;
+  states.push_back(s0);
+  stateIds[s0] = 0;
+  for (uint32_t p = 0; p < (uint32_t)patterns.size(); p++)
+    s0.push_back(NFA_ITEM(p, 0));
+  closure(patterns, s0);
+  states.push_back(s0);
+  stateIds[s0] = 1;
+
+  // Subset construction
+  for (size_t cur = 0; cur < states.size(); cur++) {
+
+    for (uint32_t c = 0; c < DFA_NB_CLASS; c++) {
+
+      NFASTATE next;
+      for (size_t j = 0; j < states[cur].size(); j++) {
+        uint32_t p = NFA_PAT(states[cur][j]);
+        uint32_t i = NFA_POS(states[cur][j]);
+        if (i >= patterns[p].length())
+          continue;
+        char pc = patterns[p][i];
+        if (pc == '*') {
+          next.push_back(NFA_ITEM(p, i));
+        } else if (pc == '?') {
+          if (c) next.push_back(NFA_ITEM(p, i + 1));
+        } else if (charClass[pc & 0x7F] == c) {
+          next.push_back(NFA_ITEM(p, i + 1));
+        }
+      }
+      closure(patterns, next);
+
+      uint32_t id;
+      map<NFASTATE, uint32_t>::iterator it = stateIds.find(next);
+      if (it == stateIds.end()) {
+        id = (uint32_t)states.size();
+        if (id > DFA_MAX_STATE) {
+          nbState = 0;
+          return false;
+        }
+        states.push_back(next);
+        stateIds[next] = id;
+      } else {
+        id = it->second;
+      }
+      trans.push_back((uint16_t)id);
+
+    }
+
+  }
+
+  nbState = (int)states.size();
+
+  // Patterns matched in each state
+  for (int i = 0; i < nbState; i++) {
+    acceptStart.push_back((uint32_t)acceptIds.size());
+    for (size_t j = 0; j < states[i].size(); j++) {
+      uint32_t p = NFA_PAT(states[i][j]);
+      if (NFA_POS(states[i][j]) == patterns[p].length())
+        acceptIds.push_back(p);
+    }
+  }
+  acceptStart.push_back((uint32_t)acceptIds.size());
+
+  // Encode flags of the target state in the transitions
+  vector<uint16_t> flags(nbState, 0);
+  for (int i = 1; i < nbState; i++) {
+    if (acceptStart[i + 1] > acceptStart[i]) {
+      flags[i] = DFA_ACCEPT;
+      bool sink = true;
+      for (int c = 0; c < DFA_NB_CLASS && sink; c++)
+        sink = (trans[i * DFA_NB_CLASS + c] == i);
+      if (sink) flags[i] |= DFA_SINK;
+    }
+  }
+  for (size_t i = 0; i < trans.size(); i++)
+    trans[i] |= flags[trans[i]];
+
+  return true;
+
+}
+
+int WildcardDFA::Match(const char *str, const uint32_t **ids) {
+
+  uint32_t s = 1;
+  for (; *str; str++) {
+    uint16_t t = trans[s * DFA_NB_CLASS + charClass[*str & 0x7F]];
+    s = t & DFA_STATE_MASK;
+    if (s == 0) return 0;
+    if (t & DFA_SINK) break;
+  }
+
+  *ids = acceptIds.data() + acceptStart[s];
+  return (int)(acceptStart[s + 1] - acceptStart[s]);
+
+}
+
+int WildcardDFA::GetNbState() {
+  return nbState;
+}
+
+void WildcardDFA::GetTable(std::vector<uint16_t> &table) {
+
+  table.resize(DFA_HEADER_SIZE + trans.size());
+  memcpy(table.data(), charClass, 128);
+  memcpy(table.data() + DFA_HEADER_SIZE, trans.data(), trans.size() * 2);
+
+}
@@ -19,6 +19,18 @@
 #define WILDCARDH
 
 #include <string>
+#include <vector>
+#include <stdint.h>
+
+// Automaton limits and flat table encoding (shared with GPU/GPUWildcard.h)
+// The table starts with a 128 bytes char to class map followed by
+// nbState*DFA_NB_CLASS transitions. State 0 is the dead state, 1 the start state.
+#define DFA_NB_CLASS     64
+#define DFA_HEADER_SIZE  64              // uint16_t
+#define DFA_MAX_STATE    0x3FFF
+#define DFA_STATE_MASK   0x3FFF
+#define DFA_ACCEPT       0x8000          // Next state matches at end of string
+#define DFA_SINK         0x4000          // Next state matches whatever follows
 
 class Wildcard {
 
@@ -32,4 +44,32 @@ public:
 
 };
 
+// All patterns of a search merged into a single deterministic automaton,
+// an address is then checked in one pass whatever the number of patterns
+class WildcardDFA {
+
+public:
+
+  WildcardDFA();
+
+  // Return false if the automaton exceeds DFA_MAX_STATE states
+  bool Compile(std::vector<std::string> &patterns, bool caseSensitive);
+  // Return the number of matching patterns, their indices are returned in ids
+  int Match(const char *str, const uint32_t **ids);
+  int GetNbState();
+  void GetTable(std::vector<uint16_t> &table);
+
+private:
+
+  typedef std::vector<uint64_t> NFASTATE;
+
+  void closure(std::vector<std::string> &patterns, NFASTATE &s);
+  uint8_t charClass[128];
+  std::vector<uint16_t> trans;
+  std::vector<uint32_t> acceptStart;
+  std::vector<uint32_t> acceptIds;
+  int nbState;
+
+};
+
 #endif // WILDCARDH
@@ -484,7 +484,11 @@ void sha256_checksum(uint8_t *input, int length, uint8_t *checksum) {
   uint8_t b[64];
   memcpy(b,input,length);
   memcpy(b + length, _sha256::pad, 56-length);
-  WRITEBE64(b + 56, length << 3);
+  // Length copied with memcpy, a 64 bit store may be reordered after the 32 bit
+  // loads of Transform2() (strict aliasing)
+  uint64_t bitLength;
+  WRITEBE64(&bitLength, (uint64_t)length << 3);
+  memcpy(b + 56, &bitLength, 8);
   _sha256::Transform2(s, b);
   WRITEBE32(checksum,s[0]);
 
@@ -29,6 +29,10 @@ void sha256sse_2B(uint32_t *i0, uint32_t *i1, uint32_t *i2, uint32_t *i3,
   uint8_t *d0, uint8_t *d1, uint8_t *d2, uint8_t *d3);
 void sha256sse_checksum(uint32_t *i0, uint32_t *i1, uint32_t *i2, uint32_t *i3,
   uint8_t *d0, uint8_t *d1, uint8_t *d2, uint8_t *d3);
+void sha256avx2_1B(uint32_t *i[8], uint8_t *d[8]);
+void sha256avx2_2B(uint32_t *i[8], uint8_t *d[8]);
+void sha256avx512_1B(uint32_t *i[16], uint8_t *d[16]);
+void sha256avx512_2B(uint32_t *i[16], uint8_t *d[16]);
 std::string sha256_hex(unsigned char *digest);
 void sha256sse_test();
 
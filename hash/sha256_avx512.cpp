@@ -0,0 +1,183 @@
+/*
+ * This file is part of the VanitySearch distribution (https://github.com/JeanLucPons/VanitySearch).
+ * Copyright (c) 2019 Jean Luc PONS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "sha256.h"
+#include <immintrin.h>
+#include <string.h>
+#include <stdint.h>
+
+// Internal AVX-512 SHA256 implementation (16 lanes).
+// Functions are compiled for AVX-512 whatever the global target is, the caller
+// must check CPU support before calling them.
+namespace _sha256avx512
+{
+
+#ifdef WIN64
+#define AVX512_FUNC
+#else
+#define AVX512_FUNC __attribute__((target("avx512f")))
+#endif
+
+  static const uint32_t K[] = {
+    0x428A2F98,0x71374491,0xB5C0FBCF,0xE9B5DBA5,0x3956C25B,0x59F111F1,0x923F82A4,0xAB1C5ED5,
+    0xD807AA98,0x12835B01,0x243185BE,0x550C7DC3,0x72BE5D74,0x80DEB1FE,0x9BDC06A7,0xC19BF174,
+    0xE49B69C1,0xEFBE4786,0x0FC19DC6,0x240CA1CC,0x2DE92C6F,0x4A7484AA,0x5CB0A9DC,0x76F988DA,
+    0x983E5152,0xA831C66D,0xB00327C8,0xBF597FC7,0xC6E00BF3,0xD5A79147,0x06CA6351,0x14292967,
+    0x27B70A85,0x2E1B2138,0x4D2C6DFC,0x53380D13,0x650A7354,0x766A0ABB,0x81C2C92E,0x92722C85,
+    0xA2BFE8A1,0xA81A664B,0xC24B8B70,0xC76C51A3,0xD192E819,0xD6990624,0xF40E3585,0x106AA070,
+    0x19A4C116,0x1E376C08,0x2748774C,0x34B0BCB5,0x391C0CB3,0x4ED8AA4A,0x5B9CCA4F,0x682E6FF3,
+    0x748F82EE,0x78A5636F,0x84C87814,0x8CC70208,0x90BEFFFA,0xA4506CEB,0xBEF9A3F7,0xC67178F2
+  };
+
+  static const uint32_t _init[] = {
+    0x6a09e667,0xbb67ae85,0x3c6ef372,0xa54ff53a,0x510e527f,0x9b05688c,0x1f83d9ab,0x5be0cd19
+  };
+
+#define Maj(b,c,d) _mm512_ternarylogic_epi32(b, c, d, 0xE8)
+#define Ch(b,c,d)  _mm512_ternarylogic_epi32(b, c, d, 0xCA)
+#define ROR(x,n)   _mm512_ror_epi32(x, n)
+#define SHR(x,n)   _mm512_srli_epi32(x, n)
+
+  /* SHA256 Functions */
+#define	S0(x) (_mm512_ternarylogic_epi32(ROR((x), 2), ROR((x), 13), ROR((x), 22), 0x96))
+#define	S1(x) (_mm512_ternarylogic_epi32(ROR((x), 6), ROR((x), 11), ROR((x), 25), 0x96))
+#define	s0(x) (_mm512_ternarylogic_epi32(ROR((x), 7), ROR((x), 18), SHR((x), 3), 0x96))
+#define	s1(x) (_mm512_ternarylogic_epi32(ROR((x), 17), ROR((x), 19), SHR((x), 10), 0x96))
+
+#define add4(x0, x1, x2, x3) _mm512_add_epi32(_mm512_add_epi32(x0, x1), _mm512_add_epi32(x2, x3))
+#define add3(x0, x1, x2 ) _mm512_add_epi32(_mm512_add_epi32(x0, x1), x2)
+#define add5(x0, x1, x2, x3, x4) _mm512_add_epi32(add3(x0, x1, x2), _mm512_add_epi32(x3, x4))
+
+#define	Round(a, b, c, d, e, f, g, h, i, w)                    \
+    T1 = add5(h, S1(e), Ch(e, f, g), _mm512_set1_epi32(i), w); \
+    d = _mm512_add_epi32(d, T1);                               \
+    T2 = _mm512_add_epi32(S0(a), Maj(a, b, c));                \
+    h = _mm512_add_epi32(T1, T2);
+
+#define LOADW(i) _mm512_setr_epi32(blk[0][i], blk[1][i], blk[2][i], blk[3][i], blk[4][i], blk[5][i], blk[6][i], blk[7][i], \
+  blk[8][i], blk[9][i], blk[10][i], blk[11][i], blk[12][i], blk[13][i], blk[14][i], blk[15][i])
+
+  // Initialise state
+  AVX512_FUNC void Initialize(__m512i *s) {
+    for (int i = 0; i < 8; i++)
+      s[i] = _mm512_set1_epi32(_init[i]);
+  }
+
+  // Perform 16 SHA in parallel using AVX-512
+  AVX512_FUNC void Transform(__m512i *s, uint32_t *blk[16])
+  {
+    __m512i a, b, c, d, e, f, g, h;
+    __m512i w[16];
+    __m512i T1, T2;
+
+    a = s[0];
+    b = s[1];
+    c = s[2];
+    d = s[3];
+    e = s[4];
+    f = s[5];
+    g = s[6];
+    h = s[7];
+
+    for (int i = 0; i < 16; i++)
+      w[i] = LOADW(i);
+
+    for (int k = 0; k < 64; k += 16) {
+
+      if (k > 0) {
+        for (int j = 0; j < 16; j++)
+          w[j] = add4(s1(w[(j + 14) & 15]), w[(j + 9) & 15], s0(w[(j + 1) & 15]), w[j]);
+      }
+
+      Round(a, b, c, d, e, f, g, h, K[k + 0], w[0]);
+      Round(h, a, b, c, d, e, f, g, K[k + 1], w[1]);
+      Round(g, h, a, b, c, d, e, f, K[k + 2], w[2]);
+      Round(f, g, h, a, b, c, d, e, K[k + 3], w[3]);
+      Round(e, f, g, h, a, b, c, d, K[k + 4], w[4]);
+      Round(d, e, f, g, h, a, b, c, K[k + 5], w[5]);
+      Round(c, d, e, f, g, h, a, b, K[k + 6], w[6]);
+      Round(b, c, d, e, f, g, h, a, K[k + 7], w[7]);
+      Round(a, b, c, d, e, f, g, h, K[k + 8], w[8]);
+      Round(h, a, b, c, d, e, f, g, K[k + 9], w[9]);
+      Round(g, h, a, b, c, d, e, f, K[k + 10], w[10]);
+      Round(f, g, h, a, b, c, d, e, K[k + 11], w[11]);
+      Round(e, f, g, h, a, b, c, d, K[k + 12], w[12]);
+      Round(d, e, f, g, h, a, b, c, K[k + 13], w[13]);
+      Round(c, d, e, f, g, h, a, b, K[k + 14], w[14]);
+      Round(b, c, d, e, f, g, h, a, K[k + 15], w[15]);
+
+    }
+
+    s[0] = _mm512_add_epi32(a, s[0]);
+    s[1] = _mm512_add_epi32(b, s[1]);
+    s[2] = _mm512_add_epi32(c, s[2]);
+    s[3] = _mm512_add_epi32(d, s[3]);
+    s[4] = _mm512_add_epi32(e, s[4]);
+    s[5] = _mm512_add_epi32(f, s[5]);
+    s[6] = _mm512_add_epi32(g, s[6]);
+    s[7] = _mm512_add_epi32(h, s[7]);
+
+  }
+
+  // Byte swap the state and write the 16 digests
+  AVX512_FUNC void Unpack(__m512i *s, uint8_t *d[16]) {
+
+#ifdef WIN64
+    __declspec(align(64)) uint32_t st[8][16];
+#else
+    uint32_t st[8][16] __attribute__((aligned(64)));
+#endif
+
+    // bswap32 without AVX512BW: (x rol 8) & 0x00FF00FF | (x ror 8) & 0xFF00FF00
+    for (int j = 0; j < 8; j++) {
+      __m512i x = _mm512_ternarylogic_epi32(_mm512_rol_epi32(s[j], 8), _mm512_ror_epi32(s[j], 8),
+                                            _mm512_set1_epi32(0x00FF00FF), 0xE4);
+      _mm512_store_si512((__m512i *)st[j], x);
+    }
+    for (int l = 0; l < 16; l++)
+      for (int j = 0; j < 8; j++)
+        ((uint32_t *)d[l])[j] = st[j][l];
+
+  }
+
+} // end namespace
+
+AVX512_FUNC void sha256avx512_1B(uint32_t *i[16], uint8_t *d[16]) {
+
+  __m512i s[8];
+
+  _sha256avx512::Initialize(s);
+  _sha256avx512::Transform(s, i);
+  _sha256avx512::Unpack(s, d);
+
+}
+
+AVX512_FUNC void sha256avx512_2B(uint32_t *i[16], uint8_t *d[16]) {
+
+  __m512i s[8];
+  uint32_t *i2[16];
+
+  for (int l = 0; l < 16; l++)
+    i2[l] = i[l] + 16;
+
+  _sha256avx512::Initialize(s);
+  _sha256avx512::Transform(s, i);
+  _sha256avx512::Transform(s, i2);
+  _sha256avx512::Unpack(s, d);
+
+}
@@ -17,7 +17,10 @@
 
 #include "Timer.h"
 #include "Vanity.h"
+#include "Daemon.h"
 #include "SECP256k1.h"
+#include "MappedFile.h"
+#include "Reconstruct.h"
 #include <fstream>
 #include <string>
 #include <string.h>
@@ -45,6 +48,9 @@
 
 #define RELEASE "1.19"
 
+// Grid sizes found by -autotune
+#define GPU_PROFILE_FILE "VanitySearch.gpu"
+
 using namespace std;
 
 // ------------------------------------------------------------------------------------------
@@ -72,23 +78,44 @@ void printUsage() {
   printf("  %s-c%s        Case-insensitive search\n", CLR_GREEN, CLR_RESET);
   printf("  %s-gpu%s      Enable GPU calculation\n", CLR_GREEN, CLR_RESET);
   printf("  %s-stop%s     Stop when all prefixes are found\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-quota%s n  Bulk mode, find n keys per prefix then drop it, stop when all quotas are met\n", CLR_GREEN, CLR_RESET);
   printf("  %s-i%s file   Load prefixes from the specified file\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-ix%s file  Binary index of the decoded prefixes, loaded when it matches the input, else built and saved\n", CLR_GREEN, CLR_RESET);
   printf("  %s-o%s file   Write found addresses and keys to file\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-of%s fmt   Output format: text, jsonl or csv (default: text)\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-osync%s p  Output file sync: none, batch or always (default: none, flush per batch)\n", CLR_GREEN, CLR_RESET);
   printf("  %s-gpuId%s ids  Comma separated list of GPU device IDs to use\n", CLR_GREEN, CLR_RESET);
   printf("  %s-g%s x,y,...  Specify GPU kernel grid sizes (pairs per GPU)\n", CLR_GREEN, CLR_RESET);
-  printf("  %s-m%s value  Maximum number of prefixes found per kernel call\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-gpusync%s m  GPU result wait: poll (default, 1 ms polling), block (thread sleeps) or spin\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-gpukernel%s k  GPU kernel: thread (default, ModInv per thread) or block (ModInv shared by the block)\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-gpugroup%s n  Number of keys per GPU group, 256, 512 or 1024 (default: %d)\n", CLR_GREEN, CLR_RESET, GRP_SIZE);
+  printf("  %s-m%s value  GPU output buffer size in items per kernel call (overflows use a spill buffer)\n", CLR_GREEN, CLR_RESET);
   printf("  %s-s%s seed   Use a deterministic seed for the base key\n", CLR_GREEN, CLR_RESET);
   printf("  %s-ps%s seed  Use a seed combined with a cryptographically secure random seed\n", CLR_GREEN, CLR_RESET);
   printf("  %s-t%s n      Number of CPU threads (default: number of cores)\n", CLR_GREEN, CLR_RESET);
-  printf("  %s-nosse%s    Disable SSE hash functions\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-cg%s size  Number of keys per CPU group, power of 2 in [%d,%d] (default: %d)\n", CLR_GREEN, CLR_RESET,
+         CPU_GRP_SIZE_MIN, CPU_GRP_SIZE_MAX, CPU_GRP_SIZE);
+  printf("  %s-nosse%s    Disable SSE/AVX hash functions\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-noavx%s    Disable AVX2/AVX-512 hash and AVX-512 IFMA group functions (use 4-way SSE)\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-sched%s    Pin search threads to cores and park CPU threads when they slow down the GPUs\n", CLR_GREEN, CLR_RESET);
   printf("  %s-l%s        List CUDA-enabled devices\n", CLR_GREEN, CLR_RESET);
   printf("  %s-check%s    Validate CPU/GPU kernels against CPU implementation\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-autotune%s Find the best grid size of each GPU and save it to " GPU_PROFILE_FILE "\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-bench%s    Measure the throughput of the CPU primitives, CPU and GPU kernels\n", CLR_GREEN, CLR_RESET);
   printf("  %s-cp%s priv  Compute public key from private key (hex or WIF)\n", CLR_GREEN, CLR_RESET);
   printf("  %s-ca%s pub   Compute address from public key (hex)\n", CLR_GREEN, CLR_RESET);
   printf("  %s-kp%s       Generate a key pair from the provided seed\n", CLR_GREEN, CLR_RESET);
   printf("  %s-rp%s priv file  Reconstruct final private key from partial key info\n", CLR_GREEN, CLR_RESET);
   printf("  %s-sp%s pub   Start search using the specified public key (split-key mode)\n", CLR_GREEN, CLR_RESET);
-  printf("  %s-r%s value  Rekey interval in MegaKeys (default disabled)\n\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-r%s value  Rekey interval in MegaKeys (default disabled)\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-ckp%s file  Save progress to file periodically and resume from it if it exists\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-ckpi%s sec  Checkpoint interval in seconds (default 60, 0 saves at the end only)\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-metrics%s file  Export key rates and hit counts to file (JSON lines, Prometheus text if *.prom)\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-server%s port  Distribute the search to workers connecting on port\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-client%s host:port  Search the key range given by the server\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-bind%s addr  Listening address of -server and -daemon (default " TCP_DEFAULT_BIND ", keys are sent in clear text)\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-token%s secret  Shared secret of -server, -client and -daemon clients (printed by the server if not given)\n", CLR_GREEN, CLR_RESET);
+  printf("  %s-daemon%s port  Run queued search jobs submitted on port, device contexts and tables stay warm\n\n", CLR_GREEN, CLR_RESET);
 
   // Footer with hint for further help
   printf("%sExample:%s VanitySearch -gpu -stop 1Test\n\n", CLR_YELLOW, CLR_RESET);
@@ -148,40 +175,40 @@ void getInts(string name,vector<int> &tokens, const string &text, char sep) {
 
 void parseFile(string fileName, vector<string> &lines) {
 
-  // Get file size
-  FILE *fp = fopen(fileName.c_str(), "rb");
-  if (fp == NULL) {
+  // Map the file, lines are split in place
+  MappedFile file;
+  if (!file.Open(fileName)) {
     printf("%sError: Cannot open %s %s%s\n", CLR_RED, fileName.c_str(), strerror(errno), CLR_RESET);
     exit(-1);
   }
-  fseek(fp, 0L, SEEK_END);
-  size_t sz = ftell(fp);
+  size_t sz = file.size;
   size_t nbAddr = sz / 33; /* Upper approximation */
   bool loaddingProgress = sz > 100000;
-  fclose(fp);
 
   // Parse file
   int nbLine = 0;
-  string line;
-  ifstream inFile(fileName);
+  const char *p = file.data;
+  const char *end = file.data + sz;
   lines.reserve(nbAddr);
-  while (getline(inFile, line)) {
+  while (p < end) {
+
+    const char *e = (const char *)memchr(p, '\n', end - p);
+    if (e == NULL) e = end;
 
     // Remove ending \r\n
-    int l = (int)line.length() - 1;
-    while (l >= 0 && isspace(line.at(l))) {
-      line.pop_back();
+    const char *l = e;
+    while (l > p && isspace((unsigned char)l[-1]))
       l--;
-    }
 
-    if (line.length() > 0) {
-      lines.push_back(line);
+    if (l > p) {
+      lines.push_back(string(p, l - p));
       nbLine++;
       if (loaddingProgress) {
         if ((nbLine % 50000) == 0)
-          printf("[Loading input file %5.1f%%]\r", ((double)nbLine*100.0) / ((double)(nbAddr)*33.0 / 34.0));
+          printf("[Loading input file %5.1f%%]\r", ((double)(p - file.data)*100.0) / (double)sz);
       }
     }
+    p = e + 1;
 
   }
 
@@ -226,172 +253,90 @@ void generateKeyPair(Secp256K1 *secp, string seed, int searchMode,bool paranoiac
 }
 
 // ------------------------------------------------------------------------------------------
+// GPU grid profiles, one "gridX gridY device" line per device model and compute capability
 
-void outputAdd(string outputFile, int addrType, string addr, string pAddr, string pAddrHex) {
-
-  FILE *f = stdout;
-  bool needToClose = false;
-
-  if (outputFile.length() > 0) {
-    f = fopen(outputFile.c_str(), "a");
-    if (f == NULL) {
-      printf("%sCannot open %s for writing%s\n", CLR_RED, outputFile.c_str(), CLR_RESET);
-      f = stdout;
-    } else {
-      needToClose = true;
-    }
-  }
-
-  fprintf(f, "\nPub Addr: %s\n", addr.c_str());
+#ifdef WITHGPU
 
+bool getProfileGrid(vector<string> &lines, string &key, int *gx, int *gy) {
 
-  switch (addrType) {
-  case P2PKH:
-    fprintf(f, "Priv (WIF): p2pkh:%s\n", pAddr.c_str());
-    break;
-  case P2SH:
-    fprintf(f, "Priv (WIF): p2wpkh-p2sh:%s\n", pAddr.c_str());
-    break;
-  case BECH32:
-    fprintf(f, "Priv (WIF): p2wpkh:%s\n", pAddr.c_str());
-    break;
+  for (int i = 0; i < (int)lines.size(); i++) {
+    int pos = 0;
+    if (sscanf(lines[i].c_str(), "%d %d %n", gx, gy, &pos) == 2 && lines[i].substr(pos) == key)
+      return true;
   }
-  fprintf(f, "Priv (HEX): 0x%s\n", pAddrHex.c_str());
-
-  if (needToClose)
-    fclose(f);
+  return false;
 
 }
 
-// ------------------------------------------------------------------------------------------
-#define CHECK_ADDR()                                           \
-  fullPriv.ModAddK1order(&e, &partialPrivKey);                 \
-  p = secp->ComputePublicKey(&fullPriv);                       \
-  cAddr = secp->GetAddress(addrType, compressed, p);           \
-  if (cAddr == addr) {                                         \
-    found = true;                                              \
-    string pAddr = secp->GetPrivAddress(compressed, fullPriv); \
-    string pAddrHex = fullPriv.GetBase16();                    \
-    outputAdd(outputFile, addrType, addr, pAddr, pAddrHex);    \
-  }
-
-void reconstructAdd(Secp256K1 *secp, string fileName, string outputFile, string privAddr) {
+void loadGPUProfile(vector<int> &gpuId, vector<int> &gridSize) {
 
-  bool compressed;
-  int addrType;
-  Int lambda;
-  Int lambda2;
-  lambda.SetBase16("5363ad4cc05c30e0a5261c028812645a122e22ea20816678df02967c1b23bd72");
-  lambda2.SetBase16("ac9c52b33fa3cf1f5ad9e3fd77ed9ba4a880b9fc8ec739c2e0cfc810b51283ce");
-
-  Int privKey = secp->DecodePrivateKey((char *)privAddr.c_str(),&compressed);
-  if(privKey.IsNegative())
-    exit(-1);
+  FILE *fp = fopen(GPU_PROFILE_FILE, "r");
+  if (fp == NULL)
+    return;
+  fclose(fp);
 
   vector<string> lines;
-  parseFile(fileName,lines);
-
-  for (int i = 0; i < (int)lines.size(); i+=2) {
-
-    string addr;
-    string partialPrivAddr;
-
-    if (lines[i].substr(0, 12) == "PubAddress: ") {
-
-      addr = lines[i].substr(12);
-
-      switch (addr.data()[0]) {
-      case '1':
-        addrType = P2PKH; break;
-      case '3':
-        addrType = P2SH; break;
-      case 'b':
-      case 'B':
-        addrType = BECH32; break;
-      default:
-        printf("%sInvalid partialkey info file at line %d%s\n", CLR_RED, i, CLR_RESET);
-        printf("%s%s Address format not supported%s\n", CLR_RED, addr.c_str(), CLR_RESET);
-        continue;
-      }
-
-    } else {
-      printf("%sInvalid partialkey info file at line %d (\"PubAddress: \" expected)%s\n", CLR_RED,i, CLR_RESET);
-      exit(-1);
+  parseFile(GPU_PROFILE_FILE, lines);
+
+  for (int i = 0; i < (int)gpuId.size(); i++) {
+    string key;
+    int nbMP;
+    int maxThreadPerGroup;
+    int gx;
+    int gy;
+    if (GPUDevice::GetDeviceInfo(GPU_BACKEND, gpuId[i], key, &nbMP, &maxThreadPerGroup) && getProfileGrid(lines, key, &gx, &gy)) {
+      printf("GPU #%d: Grid(%dx%d) from %s\n", gpuId[i], gx, gy, GPU_PROFILE_FILE);
+      gridSize[2 * i] = gx;
+      gridSize[2 * i + 1] = gy;
     }
+  }
 
-    if (lines[i+1].substr(0, 13) == "PartialPriv: ") {
-      partialPrivAddr = lines[i+1].substr(13);
-    } else {
-      printf("%sInvalid partialkey info file at line %d (\"PartialPriv: \" expected)%s\n", CLR_RED, i, CLR_RESET);
-      exit(-1);
-    }
+}
 
-    bool partialMode;
-    Int partialPrivKey = secp->DecodePrivateKey((char *)partialPrivAddr.c_str(), &partialMode);
-    if (privKey.IsNegative()) {
-      printf("%sInvalid partialkey info file at line %d%s\n", CLR_RED, i, CLR_RESET);
-      exit(-1);
-    }
+void saveGPUProfile(vector<int> &gpuId, vector<int> &gridSize) {
 
-    if (partialMode != compressed) {
+  vector<string> lines;
+  FILE *fp = fopen(GPU_PROFILE_FILE, "r");
+  if (fp != NULL) {
+    fclose(fp);
+    parseFile(GPU_PROFILE_FILE, lines);
+  }
 
-      printf("%sWarning, Invalid partialkey at line %d (Wrong compression mode, ignoring key)%s\n", CLR_YELLOW, i, CLR_RESET);
+  // Replace the entries of the tuned devices
+  char tmp[512];
+  for (int i = 0; i < (int)gpuId.size(); i++) {
+    string key;
+    int nbMP;
+    int maxThreadPerGroup;
+    int gx;
+    int gy;
+    if (!GPUDevice::GetDeviceInfo(GPU_BACKEND, gpuId[i], key, &nbMP, &maxThreadPerGroup))
       continue;
-
-    } else {
-
-      // Reconstruct the address
-      Int fullPriv;
-      Point p;
-      Int e;
-      string cAddr;
-      bool found = false;
-
-      // No sym, no endo
-      e.Set(&privKey);
-      CHECK_ADDR();
-
-      // No sym, endo 1
-      e.Set(&privKey);
-      e.ModMulK1order(&lambda);
-      CHECK_ADDR();
-
-      // No sym, endo 2
-      e.Set(&privKey);
-      e.ModMulK1order(&lambda2);
-      CHECK_ADDR();
-
-      // sym, no endo
-      e.Set(&privKey);
-      e.Neg();
-      e.Add(&secp->order);
-      CHECK_ADDR();
-
-      // sym, endo 1
-      e.Set(&privKey);
-      e.ModMulK1order(&lambda);
-      e.Neg();
-      e.Add(&secp->order);
-      CHECK_ADDR();
-
-      // sym, endo 2
-      e.Set(&privKey);
-      e.ModMulK1order(&lambda2);
-      e.Neg();
-      e.Add(&secp->order);
-      CHECK_ADDR();
-
-      if (!found) {
-        printf("%sUnable to reconstruct final key from partialkey line %d%s\n Addr: %s\n PartKey: %s\n",
-          CLR_RED, i, CLR_RESET, addr.c_str(),partialPrivAddr.c_str());
-      }
-
+    for (int j = 0; j < (int)lines.size(); ) {
+      vector<string> line(1, lines[j]);
+      if (getProfileGrid(line, key, &gx, &gy))
+        lines.erase(lines.begin() + j);
+      else
+        j++;
     }
+    sprintf(tmp, "%d %d %s", gridSize[2 * i], gridSize[2 * i + 1], key.c_str());
+    lines.push_back(string(tmp));
+  }
 
+  fp = fopen(GPU_PROFILE_FILE, "w");
+  if (fp == NULL) {
+    printf("%sCannot open %s for writing%s\n", CLR_RED, GPU_PROFILE_FILE, CLR_RESET);
+    return;
   }
+  for (int i = 0; i < (int)lines.size(); i++)
+    fprintf(fp, "%s\n", lines[i].c_str());
+  fclose(fp);
+  printf("GPU profile saved to %s\n", GPU_PROFILE_FILE);
 
 }
 
+#endif
+
 // ------------------------------------------------------------------------------------------
 
 int main(int argc, char* argv[]) {
@@ -403,6 +348,9 @@ int main(int argc, char* argv[]) {
   // Init SecpK1
   Secp256K1 *secp = new Secp256K1();
   secp->Init();
+#ifdef WITHGPU
+  GPUDevice::InitGroupTable(GPU_BACKEND, secp);
+#endif
 
   // Browse arguments
   if (argc < 2) {
@@ -413,22 +361,40 @@ int main(int argc, char* argv[]) {
   int a = 1;
   bool gpuEnable = false;
   bool stop = false;
+  uint32_t quota = 0;
   int searchMode = SEARCH_COMPRESSED;
   vector<int> gpuId = {0};
   vector<int> gridSize;
   string seed = "";
   vector<string> prefix;
   string outputFile = "";
+  string indexFile = "";
   int nbCPUThread = Timer::getCoreNumber();
   bool tSpecified = false;
   bool sse = true;
+  bool avx = true;
   uint32_t maxFound = 65536;
+  int cpuGrpSize = CPU_GRP_SIZE;
   uint64_t rekey = 0;
   Point startPuKey;
   startPuKey.Clear();
   bool startPubKeyCompressed;
   bool caseSensitive = true;
   bool paranoiacSeed = false;
+  string checkpointFile = "";
+  int checkpointDelay = 60;
+  string metricsFile = "";
+  int outputFormat = OUTPUT_TEXT;
+  int outputSync = SYNC_NONE;
+  bool bench = false;
+  bool autoTune = false;
+  bool sched = false;
+  int serverPort = 0;
+  string serverHost = "";
+  int clientPort = 0;
+  int daemonPort = 0;
+  string bindAddr = TCP_DEFAULT_BIND;
+  string netToken = "";
 
   while (a < argc) {
 
@@ -442,6 +408,15 @@ int main(int argc, char* argv[]) {
     } else if (strcmp(argv[a], "-stop") == 0) {
       stop = true;
       a++;
+    } else if (strcmp(argv[a], "-quota") == 0) {
+      a++;
+      int q = getInt("quota", argv[a]);
+      if (q <= 0) {
+        printf("%sInvalid quota, must be greater than 0%s\n", CLR_RED, CLR_RESET);
+        exit(-1);
+      }
+      quota = (uint32_t)q;
+      a++;
     } else if (strcmp(argv[a], "-c") == 0) {
       caseSensitive = false;
       a++;
@@ -452,23 +427,44 @@ int main(int argc, char* argv[]) {
 
       Int::Check();
       secp->Check();
+      for (int nbLane = 4; nbLane <= VanitySearch::GetCPUHashLanes(); nbLane *= 2)
+        secp->CheckHash160(nbLane);
+      GroupIFMA::Check(secp, cpuGrpSize);
 
 #ifdef WITHGPU
       if (gridSize.size() == 0) {
         gridSize.push_back(-1);
         gridSize.push_back(128);
       }
-      GPUEngine g(gridSize[0],gridSize[1],gpuId[0],maxFound,false);
-      g.SetSearchMode(searchMode);
-      g.Check(secp);
+      // Validate both search kernels
+      for (int k = GPU_KERNEL_THREAD; k <= GPU_KERNEL_BLOCK; k++) {
+        if (!GPUDevice::HasKernelMode(GPU_BACKEND, k))
+          continue;
+        GPUDevice::SetKernelMode(GPU_BACKEND, k);
+        GPUDevice *g = GPUDevice::Create(GPU_BACKEND,gridSize[0],gridSize[1],gpuId[0],maxFound,false);
+        if (g == NULL)
+          break;
+        g->SetSearchMode(searchMode);
+        g->Check(secp);
+        delete g;
+      }
 #else
       printf("%sGPU code not compiled, use -DWITHGPU when compiling.%s\n", CLR_RED, CLR_RESET);
 #endif
       exit(0);
+    } else if (strcmp(argv[a], "-sched") == 0) {
+      sched = true;
+      a++;
+    } else if (strcmp(argv[a], "-autotune") == 0) {
+      autoTune = true;
+      a++;
+    } else if (strcmp(argv[a], "-bench") == 0) {
+      bench = true;
+      a++;
     } else if (strcmp(argv[a], "-l") == 0) {
 
 #ifdef WITHGPU
-      GPUEngine::PrintCudaInfo();
+      GPUDevice::PrintDeviceInfo(GPU_BACKEND);
 #else
       printf("%sGPU code not compiled, use -DWITHGPU when compiling.%s\n", CLR_RED, CLR_RESET);
 #endif
@@ -514,8 +510,8 @@ int main(int argc, char* argv[]) {
       a++;
       string file = string(argv[a]);
       a++;
-      reconstructAdd(secp,file,outputFile,priv);
-      exit(0);
+      KeyReconstructor r(secp, outputFile, nbCPUThread);
+      exit(r.Run(priv, file) ? 0 : -1);
     } else if (strcmp(argv[a], "-u") == 0) {
       searchMode = SEARCH_UNCOMPRESSED;
       a++;
@@ -525,6 +521,9 @@ int main(int argc, char* argv[]) {
     } else if (strcmp(argv[a], "-nosse") == 0) {
       sse = false;
       a++;
+    } else if (strcmp(argv[a], "-noavx") == 0) {
+      avx = false;
+      a++;
     } else if (strcmp(argv[a], "-g") == 0) {
       a++;
       getInts("gridSize",gridSize,string(argv[a]),',');
@@ -542,15 +541,99 @@ int main(int argc, char* argv[]) {
       a++;
       outputFile = string(argv[a]);
       a++;
+    } else if (strcmp(argv[a], "-of") == 0) {
+      a++;
+      if (strcmp(argv[a], "text") == 0) {
+        outputFormat = OUTPUT_TEXT;
+      } else if (strcmp(argv[a], "jsonl") == 0) {
+        outputFormat = OUTPUT_JSONL;
+      } else if (strcmp(argv[a], "csv") == 0) {
+        outputFormat = OUTPUT_CSV;
+      } else {
+        printf("%sInvalid -of argument, text, jsonl or csv expected%s\n", CLR_RED, CLR_RESET);
+        exit(-1);
+      }
+      a++;
+    } else if (strcmp(argv[a], "-osync") == 0) {
+      a++;
+      if (strcmp(argv[a], "none") == 0) {
+        outputSync = SYNC_NONE;
+      } else if (strcmp(argv[a], "batch") == 0) {
+        outputSync = SYNC_BATCH;
+      } else if (strcmp(argv[a], "always") == 0) {
+        outputSync = SYNC_ALWAYS;
+      } else {
+        printf("%sInvalid -osync argument, none, batch or always expected%s\n", CLR_RED, CLR_RESET);
+        exit(-1);
+      }
+      a++;
+    } else if (strcmp(argv[a], "-gpusync") == 0) {
+      a++;
+      int gpuSync = -1;
+      if (strcmp(argv[a], "poll") == 0) {
+        gpuSync = GPU_SYNC_POLL;
+      } else if (strcmp(argv[a], "block") == 0) {
+        gpuSync = GPU_SYNC_BLOCK;
+      } else if (strcmp(argv[a], "spin") == 0) {
+        gpuSync = GPU_SYNC_SPIN;
+      }
+      if (gpuSync < 0) {
+        printf("%sInvalid -gpusync argument, poll, block or spin expected%s\n", CLR_RED, CLR_RESET);
+        exit(-1);
+      }
+#ifdef WITHGPU
+      GPUDevice::SetSyncMode(GPU_BACKEND, gpuSync);
+#endif
+      a++;
+    } else if (strcmp(argv[a], "-gpukernel") == 0) {
+      a++;
+      int gpuKernel = -1;
+      if (strcmp(argv[a], "thread") == 0) {
+        gpuKernel = GPU_KERNEL_THREAD;
+      } else if (strcmp(argv[a], "block") == 0) {
+        gpuKernel = GPU_KERNEL_BLOCK;
+      }
+      if (gpuKernel < 0) {
+        printf("%sInvalid -gpukernel argument, thread or block expected%s\n", CLR_RED, CLR_RESET);
+        exit(-1);
+      }
+#ifdef WITHGPU
+      if (!GPUDevice::HasKernelMode(GPU_BACKEND, gpuKernel)) {
+        printf("%sBlock kernel not compiled, it needs CUDA 9 or above (not available with HIP), use -gpukernel thread%s\n", CLR_RED, CLR_RESET);
+        exit(-1);
+      }
+      GPUDevice::SetKernelMode(GPU_BACKEND, gpuKernel);
+#endif
+      a++;
+    } else if (strcmp(argv[a], "-gpugroup") == 0) {
+      a++;
+      int gpuGrpSize = getInt("gpuGroupSize", argv[a]);
+      if (gpuGrpSize < GRP_SIZE_MIN || gpuGrpSize > GRP_SIZE_MAX || (gpuGrpSize & (gpuGrpSize - 1)) != 0) {
+        printf("%sInvalid GPU group size %d, 256, 512 or 1024 expected%s\n", CLR_RED, gpuGrpSize, CLR_RESET);
+        exit(-1);
+      }
+#ifdef WITHGPU
+      GPUDevice::SetGroupSize(GPU_BACKEND, gpuGrpSize);
+      GPUDevice::InitGroupTable(GPU_BACKEND, secp);
+#endif
+      a++;
     } else if (strcmp(argv[a], "-i") == 0) {
       a++;
       parseFile(string(argv[a]),prefix);
       a++;
+    } else if (strcmp(argv[a], "-ix") == 0) {
+      a++;
+      indexFile = string(argv[a]);
+      a++;
     } else if (strcmp(argv[a], "-t") == 0) {
       a++;
       nbCPUThread = getInt("nbCPUThread",argv[a]);
       a++;
       tSpecified = true;
+    } else if (strcmp(argv[a], "-cg") == 0) {
+      a++;
+      cpuGrpSize = getInt("cpuGroupSize", argv[a]);
+      a++;
     } else if (strcmp(argv[a], "-m") == 0) {
       a++;
       maxFound = getInt("maxFound", argv[a]);
@@ -559,6 +642,45 @@ int main(int argc, char* argv[]) {
       a++;
       rekey = (uint64_t)getInt("rekey", argv[a]);
       a++;
+    } else if (strcmp(argv[a], "-ckp") == 0) {
+      a++;
+      checkpointFile = string(argv[a]);
+      a++;
+    } else if (strcmp(argv[a], "-ckpi") == 0) {
+      a++;
+      checkpointDelay = getInt("checkpointDelay", argv[a]);
+      a++;
+    } else if (strcmp(argv[a], "-metrics") == 0) {
+      a++;
+      metricsFile = string(argv[a]);
+      a++;
+    } else if (strcmp(argv[a], "-server") == 0) {
+      a++;
+      serverPort = getInt("serverPort", argv[a]);
+      a++;
+    } else if (strcmp(argv[a], "-daemon") == 0) {
+      a++;
+      daemonPort = getInt("daemonPort", argv[a]);
+      a++;
+    } else if (strcmp(argv[a], "-bind") == 0) {
+      a++;
+      bindAddr = string(argv[a]);
+      a++;
+    } else if (strcmp(argv[a], "-token") == 0) {
+      a++;
+      netToken = string(argv[a]);
+      a++;
+    } else if (strcmp(argv[a], "-client") == 0) {
+      a++;
+      string host = string(argv[a]);
+      size_t pos = host.find_last_of(':');
+      if (pos == string::npos) {
+        printf("%sInvalid -client argument, host:port expected%s\n", CLR_RED, CLR_RESET);
+        exit(-1);
+      }
+      serverHost = host.substr(0, pos);
+      clientPort = getInt("clientPort", (char *)host.substr(pos + 1).c_str());
+      a++;
     } else if (strcmp(argv[a], "-h") == 0) {
       printUsage();
     } else if (a == argc - 1) {
@@ -571,6 +693,17 @@ int main(int argc, char* argv[]) {
 
   }
 
+  if (autoTune && !gpuEnable) {
+    printf("%s-autotune requires -gpu%s\n", CLR_RED, CLR_RESET);
+    exit(-1);
+  }
+
+  if (cpuGrpSize < CPU_GRP_SIZE_MIN || cpuGrpSize > CPU_GRP_SIZE_MAX || (cpuGrpSize & (cpuGrpSize - 1)) != 0) {
+    printf("%sInvalid CPU group size %d, power of 2 in [%d,%d] expected%s\n", CLR_RED, cpuGrpSize,
+           CPU_GRP_SIZE_MIN, CPU_GRP_SIZE_MAX, CLR_RESET);
+    exit(-1);
+  }
+
   printf("VanitySearch v" RELEASE "\n");
 
   if(gridSize.size()==0) {
@@ -578,6 +711,11 @@ int main(int argc, char* argv[]) {
       gridSize.push_back(-1);
       gridSize.push_back(128);
     }
+#ifdef WITHGPU
+    // Grid sizes found by a previous -autotune
+    if (gpuEnable && !autoTune)
+      loadGPUProfile(gpuId, gridSize);
+#endif
   } else if(gridSize.size() != (int)gpuId.size()*2) {
     printf("%sInvalid gridSize or gpuId argument, must have coherent size%s\n", CLR_RED, CLR_RESET);
     exit(-1);
@@ -595,8 +733,50 @@ int main(int argc, char* argv[]) {
     searchMode = (startPubKeyCompressed)?SEARCH_COMPRESSED:SEARCH_UNCOMPRESSED;
   }
 
+  if (daemonPort > 0) {
+    Daemon d(secp, gpuEnable, gpuId, gridSize, nbCPUThread, sse, avx, cpuGrpSize, maxFound,
+      outputFile, outputFormat, outputSync);
+    d.Run(daemonPort, bindAddr, netToken);
+    return 0;
+  }
+
+  // Benchmark or tune the search of a prefix that will not be found
+  bool noSearch = (prefix.size() == 0);
+  if ((bench || autoTune) && noSearch)
+    prefix.push_back("1Bench1");
+
   VanitySearch *v = new VanitySearch(secp, prefix, seed, searchMode, gpuEnable, stop, outputFile, sse,
-    maxFound, rekey, caseSensitive, startPuKey, paranoiacSeed);
+    avx, cpuGrpSize, maxFound, rekey, caseSensitive, startPuKey, paranoiacSeed, indexFile);
+  if (!v->IsValid())
+    exit(1);
+  if (autoTune) {
+#ifdef WITHGPU
+    if (v->AutoTune(gpuId, gridSize))
+      saveGPUProfile(gpuId, gridSize);
+#endif
+    if (noSearch && !bench)
+      return 0;
+  }
+  if (bench) {
+    secp->Bench();
+    v->Bench(gpuId, gridSize);
+    return 0;
+  }
+  v->SetOutputFormat(outputFormat, outputSync);
+  v->SetScheduler(sched);
+  v->SetNetwork(bindAddr, netToken);
+  if (quota > 0)
+    v->SetQuota(quota);
+  if (serverPort > 0) {
+    v->Serve(serverPort);
+    return 0;
+  }
+  if (clientPort > 0 && !v->ConnectServer(serverHost, clientPort))
+    exit(-1);
+  if (checkpointFile.length() > 0)
+    v->SetCheckpoint(checkpointFile, checkpointDelay);
+  if (metricsFile.length() > 0)
+    v->SetMetrics(metricsFile);
   v->Search(nbCPUThread,gpuId,gridSize);
 
   return 0;